@@ -12,6 +12,7 @@
 #include <functional>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <vector>
 #include "CodepointSet.hpp"
 #include "CodepointConstants.hpp"
@@ -54,11 +55,21 @@ namespace ystring
 
     /**
      * @brief Returns true if @a str contains code point @a chr.
-     * @throw YstringException if str contains an invalid UTF-8 code point.
+     * @note The function searches for the UTF-8 encoding of @a chr,
+     *  it does not check that @a str is valid UTF-8.
      */
     [[nodiscard]]
     YSTRING_API bool contains(std::string_view str, char32_t chr);
 
+    /**
+     * @brief Returns the number of non-overlapping occurrences of @a cmp
+     *  in @a str.
+     *
+     * Returns 0 if @a cmp is empty.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t count(std::string_view str, std::string_view cmp);
+
     /**
      * @brief Returns the number of characters in @a str.
      *
@@ -79,6 +90,47 @@ namespace ystring
     [[nodiscard]]
     YSTRING_API size_t count_codepoints(std::string_view str);
 
+    /**
+     * @brief Returns the number of code points in @a str that are in
+     *  @a chars.
+     *
+     * If @a chars is small (up to 8 code points) the function counts
+     * their UTF-8 encodings rather than decoding @a str, invalid UTF-8
+     * in @a str is then not detected.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t count_of(std::string_view str,
+                                std::u32string_view chars);
+
+    /**
+     * @brief Returns the number of code points in @a str that are in
+     *  @a chars.
+     * @throw YstringException if str contains an invalid UTF-8 code point.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t count_of(std::string_view str,
+                                const CodepointSet& chars);
+
+    /**
+     * @brief Returns the number of code points in @a str where @a pred
+     *  is true.
+     * @throw YstringException if str contains an invalid UTF-8 code point.
+     */
+    template <typename Char32Predicate>
+    [[nodiscard]]
+    size_t count_where(std::string_view str, Char32Predicate pred)
+    {
+        size_t result = 0;
+        auto it = str.begin();
+        char32_t ch;
+        while (safe_decode_next(it, str.end(), ch))
+        {
+            if (pred(ch))
+                ++result;
+        }
+        return result;
+    }
+
     /**
      * @brief Returns true if @a str ends with @a cmp.
      * @note Composed and decomposed versions of the same characters are
@@ -87,6 +139,70 @@ namespace ystring
     [[nodiscard]]
     YSTRING_API bool ends_with(std::string_view str, std::string_view cmp);
 
+    /**
+     * @brief Calls @a callback with every non-overlapping occurrence of
+     *  @a cmp in @a str, from left to right.
+     *
+     * @a callback receives a Subrange. If it returns a bool, the search
+     * stops when it returns false. Nothing is found if @a cmp is empty.
+     */
+    template <typename Callback>
+    void find_all(std::string_view str, std::string_view cmp,
+                  Callback callback)
+    {
+        if (cmp.empty())
+            return;
+
+        size_t pos = 0;
+        while ((pos = str.find(cmp, pos)) != std::string_view::npos)
+        {
+            Subrange match(pos, cmp.size());
+            if constexpr (std::is_void_v<std::invoke_result_t<Callback&, Subrange>>)
+                callback(match);
+            else if (!callback(match))
+                break;
+            pos += cmp.size();
+        }
+    }
+
+    /**
+     * @brief Appends every non-overlapping occurrence of @a cmp in
+     *  @a str to @a matches.
+     *
+     * Reusing @a matches between calls avoids repeated allocations.
+     * @return The number of occurrences that were appended.
+     */
+    YSTRING_API size_t find_all(std::string_view str, std::string_view cmp,
+                                std::vector<Subrange>& matches);
+
+    /**
+     * @brief Returns every non-overlapping occurrence of @a cmp in @a str.
+     */
+    [[nodiscard]]
+    YSTRING_API std::vector<Subrange>
+    find_all(std::string_view str, std::string_view cmp);
+
+    /**
+     * @brief Returns the positions of all the code points in @a str that
+     *  are in @a chars.
+     *
+     * If @a chars is small (up to 8 code points) the function searches
+     * for their UTF-8 encodings rather than decoding @a str, invalid UTF-8
+     * in @a str is then not detected.
+     */
+    [[nodiscard]]
+    YSTRING_API std::vector<Subrange>
+    find_all_of(std::string_view str, std::u32string_view chars);
+
+    /**
+     * @brief Returns the positions of all the code points in @a str that
+     *  are in @a chars.
+     * @throw YstringException if str contains an invalid UTF-8 code point.
+     */
+    [[nodiscard]]
+    YSTRING_API std::vector<Subrange>
+    find_all_of(std::string_view str, const CodepointSet& chars);
+
     /**
      * @brief Returns the first substring in @a str that matches @a cmp.
      * @note Composed and decomposed versions of the same characters are
@@ -113,11 +229,22 @@ namespace ystring
      *   - NEXT LINE (code point 133)
      *   - LINE SEPARATOR (code point 8232)
      *   - PARAGRAPH SEPARATOR (code point 8233)
+     *
+     * The function searches for the UTF-8 encodings of the newline
+     * characters rather than decoding @a str, invalid UTF-8 in @a str
+     * is therefore not detected.
      */
     [[nodiscard]]
     YSTRING_API Subrange find_first_newline(std::string_view str,
                                             size_t offset = 0);
 
+    /**
+     * @brief Returns the first code point in @a str that is in @a chars.
+     *
+     * If @a chars is small (up to 8 code points) the function searches
+     * for their UTF-8 encodings rather than decoding @a str, invalid UTF-8
+     * in @a str is then not detected.
+     */
     [[nodiscard]]
     YSTRING_API std::pair<Subrange, char32_t>
     find_first_of(std::string_view str, std::u32string_view chars,
@@ -125,7 +252,7 @@ namespace ystring
 
     [[nodiscard]]
     YSTRING_API std::pair<Subrange, char32_t>
-    find_first_of(std::string_view str, CodepointSet chars,
+    find_first_of(std::string_view str, const CodepointSet& chars,
                   size_t offset = 0);
 
     template <typename Char32Predicate>
@@ -177,6 +304,13 @@ namespace ystring
     find_last_newline(std::string_view str,
                       size_t offset = std::string_view::npos);
 
+    /**
+     * @brief Returns the last code point in @a str that is in @a chars.
+     *
+     * If @a chars is small (up to 8 code points) the function searches
+     * for their UTF-8 encodings rather than decoding @a str, invalid UTF-8
+     * in @a str is then not detected.
+     */
     [[nodiscard]]
     YSTRING_API std::pair<Subrange, char32_t>
     find_last_of(std::string_view str, std::u32string_view chars,
@@ -184,7 +318,7 @@ namespace ystring
 
     [[nodiscard]]
     YSTRING_API std::pair<Subrange, char32_t>
-    find_last_of(std::string_view str, CodepointSet chars,
+    find_last_of(std::string_view str, const CodepointSet& chars,
                  size_t offset = std::string_view::npos);
 
     /**
@@ -469,8 +603,12 @@ namespace ystring
     constexpr SplitParams IGNORE_EMPTY = {SIZE_MAX, true};
 
     /**
-     * @brief Splits @a str where it contains whitespace characters and
-     *  returns a list of the parts.
+     * @brief Splits @a str where it contains any of the characters in
+     *  @a chars and returns a list of the parts.
+     *
+     * If @a chars is small (up to 8 code points) the function searches
+     * for their UTF-8 encodings rather than decoding @a str, invalid UTF-8
+     * in @a str is then not detected.
      */
     [[nodiscard]]
     YSTRING_API std::vector<std::string_view>
@@ -492,6 +630,9 @@ namespace ystring
     /**
      * @brief Splits @a str at newline characters and returns a list
      *  of the parts.
+     *
+     * The newlines are found with find_first_newline, invalid UTF-8 in
+     * @a str is therefore not detected.
      */
     [[nodiscard]]
     YSTRING_API std::vector<std::string_view>
@@ -540,6 +681,10 @@ namespace ystring
     /**
      * @brief Returns a copy of @a str where all whitespace characters at the
      *  start and end of the string have been removed.
+     *
+     * If @a chars is small (up to 8 code points) the function compares
+     * @a str with their UTF-8 encodings rather than decoding it, invalid
+     * UTF-8 in @a str is then not detected.
      */
     [[nodiscard]]
     YSTRING_API std::string_view
@@ -549,6 +694,10 @@ namespace ystring
     /**
      * @brief Returns a copy of @a str where all characters in @a chars
      *  at the end of the string have been removed.
+     *
+     * If @a chars is small (up to 8 code points) the function compares
+     * @a str with their UTF-8 encodings rather than decoding it, invalid
+     * UTF-8 in @a str is then not detected.
      */
     [[nodiscard]]
     YSTRING_API std::string_view
@@ -572,6 +721,10 @@ namespace ystring
     /**
      * @brief Returns a copy of @a str where all whitespace characters at the
      *  start of the string have been removed.
+     *
+     * If @a chars is small (up to 8 code points) the function compares
+     * @a str with their UTF-8 encodings rather than decoding it, invalid
+     * UTF-8 in @a str is then not detected.
      */
     [[nodiscard]]
     YSTRING_API std::string_view
@@ -623,6 +776,17 @@ namespace ystring
         YSTRING_API int32_t
         compare(std::string_view str, std::string_view cmp);
 
+        /**
+         * @brief Returns the number of non-overlapping substrings in
+         *  @a str that match @a cmp.
+         *
+         * The running time is linear in the lengths of @a str and @a cmp.
+         * @throw YstringException if @a str or @a cmp contains invalid
+         *  UTF-8.
+         */
+        [[nodiscard]]
+        YSTRING_API size_t count(std::string_view str, std::string_view cmp);
+
         /**
          * @brief Returns true if @a str ends with @a cmp.
          * @note Composed and decomposed versions of the same characters are
@@ -645,6 +809,30 @@ namespace ystring
         [[nodiscard]]
         YSTRING_API bool equal(std::string_view str, std::string_view cmp);
 
+        /**
+         * @brief Returns all non-overlapping substrings in @a str that
+         *  match @a cmp, from left to right.
+         *
+         * The running time is linear in the lengths of @a str and @a cmp.
+         * @throw YstringException if @a str or @a cmp contains invalid
+         *  UTF-8.
+         */
+        [[nodiscard]]
+        YSTRING_API std::vector<Subrange>
+        find_all(std::string_view str, std::string_view cmp);
+
+        /**
+         * @brief Appends all non-overlapping substrings in @a str that
+         *  match @a cmp to @a matches.
+         *
+         * @return The number of substrings that were appended.
+         * @throw YstringException if @a str or @a cmp contains invalid
+         *  UTF-8.
+         */
+        YSTRING_API size_t find_all(std::string_view str,
+                                    std::string_view cmp,
+                                    std::vector<Subrange>& matches);
+
         /**
          * @brief Returns the first substring in @a str that matches @a cmp.
          * @note Composed and decomposed versions of the same characters are
@@ -670,7 +858,7 @@ namespace ystring
 
         [[nodiscard]]
         YSTRING_API std::pair<Subrange, char32_t>
-        find_first_of(std::string_view str, CodepointSet chars,
+        find_first_of(std::string_view str, const CodepointSet& chars,
                       size_t offset = 0);
 
         /**
@@ -693,9 +881,23 @@ namespace ystring
 
         [[nodiscard]]
         YSTRING_API std::pair<Subrange, char32_t>
-        find_last_of(std::string_view str, CodepointSet chars,
+        find_last_of(std::string_view str, const CodepointSet& chars,
                      size_t offset = std::string_view::npos);
 
+        /**
+         * @brief Returns a hash value for @a str that ignores any
+         *  differences in letter casing.
+         *
+         * Strings that are equal according to case_insensitive::equal
+         * have the same hash value. The code points are folded one at a
+         * time into a small buffer on the stack while the hash value is
+         * computed, runs of ASCII characters eight at a time, so the
+         * function doesn't allocate memory.
+         * @throw YstringException if str contains an invalid UTF-8 codepoint.
+         */
+        [[nodiscard]]
+        YSTRING_API size_t hash(std::string_view str);
+
         /**
          * @brief Returns true if the upper case version of @a str is less
          *  than @a cmp.
@@ -756,4 +958,39 @@ namespace ystring
         YSTRING_API bool
         starts_with(std::string_view str, std::string_view cmp);
     }
+
+    /**
+     * @brief A hash function for strings that ignores differences in
+     *  letter casing.
+     *
+     * Use it together with CaseInsensitiveStringEqual in unordered
+     * containers. Both are transparent, so containers that use them can
+     * be searched with std::string_view and string literals without
+     * creating temporary strings.
+     */
+    struct CaseInsensitiveHash
+    {
+        using is_transparent = void;
+
+        [[nodiscard]]
+        size_t operator()(std::string_view str) const
+        {
+            return case_insensitive::hash(str);
+        }
+    };
+
+    /**
+     * @brief Compares strings for equality while ignoring differences in
+     *  letter casing.
+     */
+    struct CaseInsensitiveStringEqual
+    {
+        using is_transparent = void;
+
+        [[nodiscard]]
+        bool operator()(std::string_view a, std::string_view b) const
+        {
+            return case_insensitive::equal(a, b);
+        }
+    };
 }
@@ -8,10 +8,15 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+#include "Ystring/Subrange.hpp"
 #include "Ystring/YstringDefinitions.hpp"
 
 /** @file
-  * @brief Defines the CharClass enum and the get_char_class function.
+  * @brief Defines the CharClass enum and functions for getting the
+  *     character classes of code points and strings.
   */
 
 namespace ystring
@@ -111,4 +116,82 @@ namespace ystring
     /** @brief Returns the unicode character class of character @a code_point.
       */
     YSTRING_API CharClass_t get_char_class(char32_t code_point);
+
+    /** @brief Writes the character class of each code point in @a str to
+      *     the position in @a classes that corresponds to the code
+      *     point's first byte.
+      *
+      * The positions of the remaining bytes of multi-byte code points are
+      * set to 0, which makes it possible to index @a classes with byte
+      * offsets in @a str. Only the first str.size() values in
+      * @a classes are written.
+      *
+      * The string is checked for non-ASCII characters eight bytes at a
+      * time, and ASCII characters are classified without decoding, which
+      * makes this much faster than calling get_char_class for each code
+      * point.
+      * @throw YstringException if @a classes is smaller than @a str or
+      *     @a str contains invalid UTF-8.
+      */
+    YSTRING_API void get_char_classes(std::string_view str,
+                                      std::span<CharClass_t> classes);
+
+    /** @brief Returns the character classes of the code points in
+      *     @a str, with one value per byte as described for the other
+      *     overload.
+      *
+      * @throw YstringException if @a str contains invalid UTF-8.
+      */
+    [[nodiscard]]
+    YSTRING_API std::vector<CharClass_t> get_char_classes(std::string_view str);
+
+    /** @brief A sequence of consecutive code points that belong to the
+      *     same character class or group of character classes.
+      */
+    struct CharClassRun
+    {
+        /// The bytes of the code points in the string.
+        Subrange range;
+        /// The code points' character class, or the group it belongs to.
+        uint32_t char_classes = 0;
+    };
+
+    [[nodiscard]]
+    constexpr bool operator==(const CharClassRun& a, const CharClassRun& b)
+    {
+        return a.range == b.range && a.char_classes == b.char_classes;
+    }
+
+    [[nodiscard]]
+    constexpr bool operator!=(const CharClassRun& a, const CharClassRun& b)
+    {
+        return !(a == b);
+    }
+
+    /** @brief Splits @a str into runs of code points with the same
+      *     character class and appends them to @a runs.
+      *
+      * If @a groups isn't empty, each code point's character class is
+      * replaced by the first of the masks in @a groups that contains it,
+      * e.g. {CharClass::LETTER, CharClass::NUMBER} gives runs of letters
+      * and numbers regardless of letter case. Classes that aren't in any
+      * of the masks are kept as they are.
+      *
+      * Reusing @a runs between calls avoids repeated allocations.
+      * @return The number of runs that were appended.
+      * @throw YstringException if @a str contains invalid UTF-8.
+      */
+    YSTRING_API size_t get_char_class_runs(std::string_view str,
+                                           std::vector<CharClassRun>& runs,
+                                           std::span<const uint32_t> groups = {});
+
+    /** @brief Returns the runs of code points in @a str with the same
+      *     character class, or group of character classes.
+      *
+      * @throw YstringException if @a str contains invalid UTF-8.
+      */
+    [[nodiscard]]
+    YSTRING_API std::vector<CharClassRun>
+    get_char_class_runs(std::string_view str,
+                        std::span<const uint32_t> groups = {});
 }
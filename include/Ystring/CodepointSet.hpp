@@ -7,10 +7,12 @@
 //****************************************************************************
 #pragma once
 #include <algorithm>
+#include <cstdint>
 #include <iosfwd>
 #include <string_view>
 #include <vector>
 #include "CaseInsensitive.hpp"
+#include "YstringDefinitions.hpp"
 
 namespace ystring
 {
@@ -18,6 +20,13 @@ namespace ystring
 
     struct CodepointSet
     {
+        /**
+         * @brief The code point ranges in the set.
+         *
+         * The ranges are sorted, and neither overlap nor touch each other.
+         * The member functions preserve this invariant, call canonicalize()
+         * after modifying @a ranges directly.
+         */
         std::vector<CodepointRange> ranges;
         bool negated = false;
 
@@ -27,6 +36,12 @@ namespace ystring
 
         void add_codepoints(std::u32string_view codepoints);
 
+        /**
+         * @brief Sorts @a ranges and merges ranges that overlap or are
+         *  adjacent.
+         */
+        void canonicalize();
+
         [[nodiscard]]
         bool contains(char32_t cp) const;
 
@@ -36,6 +51,67 @@ namespace ystring
 
     std::ostream& operator<<(std::ostream& os, const CodepointSet& set);
 
+    /**
+     * @brief Creates a CodepointSet from an expression like "[a-zA-Z_]"
+     *  or "[^0-9]".
+     *
+     * The characters ']', '-', '^' and '\\' must be escaped with '\\'
+     * when they are members of the set, unless '-' is the first or last
+     * character in the set. This is the same format as the one written by
+     * operator<<.
+     * @throw YstringException if @a str isn't a valid set expression.
+     */
+    [[nodiscard]]
+    YSTRING_API CodepointSet parse_codepoint_set(std::string_view str);
+
+    /**
+     * @brief Returns a set with all the code points that are not in @a set.
+     *
+     * The result is a canonical set where negated is false.
+     */
+    [[nodiscard]]
+    YSTRING_API CodepointSet complement(const CodepointSet& set);
+
+    /**
+     * @brief Returns a set with the code points that are in @a a but
+     *  not in @a b.
+     *
+     * The result is a canonical set where negated is false.
+     */
+    [[nodiscard]]
+    YSTRING_API CodepointSet set_difference(const CodepointSet& a,
+                                            const CodepointSet& b);
+
+    /**
+     * @brief Returns a set with the code points that are in both
+     *  @a a and @a b.
+     *
+     * The result is a canonical set where negated is false.
+     */
+    [[nodiscard]]
+    YSTRING_API CodepointSet set_intersection(const CodepointSet& a,
+                                              const CodepointSet& b);
+
+    /**
+     * @brief Returns a set with the code points that are in @a a, @a b
+     *  or both.
+     *
+     * The result is a canonical set where negated is false.
+     */
+    [[nodiscard]]
+    YSTRING_API CodepointSet set_union(const CodepointSet& a,
+                                       const CodepointSet& b);
+
+    /**
+     * @brief Returns a set with all code points whose character class
+     *  is among @a char_classes.
+     *
+     * @param char_classes A bitwise OR of CharClass values,
+     *  e.g. CharClass::LETTER | CharClass::NUMBER.
+     */
+    [[nodiscard]]
+    YSTRING_API CodepointSet make_codepoint_set(uint32_t char_classes);
+
     [[nodiscard]]
     bool contains(std::u32string_view span, char32_t cp);
 
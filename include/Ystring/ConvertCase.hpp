@@ -7,6 +7,7 @@
 //****************************************************************************
 #pragma once
 #include "Ystring/YstringDefinitions.hpp"
+#include <span>
 #include <string>
 #include <string_view>
 
@@ -21,21 +22,230 @@ namespace ystring
     [[nodiscard]]
     YSTRING_API char32_t to_upper(char32_t codepoint);
 
+    /**
+     * @brief Returns the simple case folding of @a codepoint.
+     *
+     * Code points whose full case folding is several code points (e.g.
+     * U+00DF to "ss") are folded to a single code point, or not at all.
+     */
+    [[nodiscard]]
+    YSTRING_API char32_t fold_case(char32_t codepoint);
+
     /**
      * @brief Returns a lower case copy of @a str.
+     *
+     * Code points whose lower case forms are several code points in
+     * SpecialCasing.txt (i.e. "İ") are converted to all of them, but the
+     * language-specific and context-dependent mappings are not used.
      */
     [[nodiscard]]
     YSTRING_API std::string to_lower(std::string_view str);
 
+    /**
+     * @brief Appends a lower case copy of @a str to @a result.
+     *
+     * @a str must not refer to the contents of @a result.
+     */
+    YSTRING_API std::string& to_lower(std::string_view str,
+                                     std::string& result);
+
+    /**
+     * @brief Writes a lower case copy of @a str to @a buffer.
+     *
+     * @return The size of the lower case copy. If it is greater than the size
+     *  of @a buffer, the contents of @a buffer are unspecified.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t to_lower(std::string_view str, std::span<char> buffer);
+
+    /**
+     * @brief Converts @a str to lower case in place.
+     *
+     * @a str is only reallocated if it reaches a code point whose
+     * converted form has a different length than the code point itself.
+     * @throw YstringException if @a str contains invalid UTF-8, in which
+     *  case @a str may have been partially converted.
+     */
+    YSTRING_API std::string& to_lower_in_place(std::string& str);
+
+    /**
+     * @brief Returns the size of the lower case copy of @a str.
+     *
+     * Use it to allocate the result exactly once when @a str contains
+     * code points whose lower case forms are longer than the code points
+     * themselves.
+     * @throw YstringException if @a str contains invalid UTF-8.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t get_lower_case_size(std::string_view str);
+
     /**
      * @brief Returns a title-cased copy of @a str.
+     *
+     * Code points whose title case forms are several code points in
+     * SpecialCasing.txt (e.g. "ß" and "ﬁ") are converted to all of them,
+     * but the language-specific and context-dependent mappings are not used.
      */
     [[nodiscard]]
     YSTRING_API std::string to_title(std::string_view str);
 
+    /**
+     * @brief Appends a title-cased copy of @a str to @a result.
+     *
+     * @a str must not refer to the contents of @a result.
+     */
+    YSTRING_API std::string& to_title(std::string_view str,
+                                     std::string& result);
+
+    /**
+     * @brief Writes a title-cased copy of @a str to @a buffer.
+     *
+     * @return The size of the title-cased copy. If it is greater than the size
+     *  of @a buffer, the contents of @a buffer are unspecified.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t to_title(std::string_view str, std::span<char> buffer);
+
+    /**
+     * @brief Converts @a str to title case in place.
+     *
+     * @a str is only reallocated if it reaches a code point whose
+     * converted form has a different length than the code point itself.
+     * @throw YstringException if @a str contains invalid UTF-8, in which
+     *  case @a str may have been partially converted.
+     */
+    YSTRING_API std::string& to_title_in_place(std::string& str);
+
+    /**
+     * @brief Returns the size of the title-cased copy of @a str.
+     *
+     * Use it to allocate the result exactly once when @a str contains
+     * code points whose title case forms are longer than the code points
+     * themselves.
+     * @throw YstringException if @a str contains invalid UTF-8.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t get_title_case_size(std::string_view str);
+
     /**
      * @brief Returns a upper case copy of @a str.
+     *
+     * Code points whose upper case forms are several code points in
+     * SpecialCasing.txt (e.g. "ß", "ﬁ" and "ŉ") are converted to all of
+     * them, but the language-specific and context-dependent mappings are
+     * not used.
      */
     [[nodiscard]]
     YSTRING_API std::string to_upper(std::string_view str);
+
+    /**
+     * @brief Appends a upper case copy of @a str to @a result.
+     *
+     * @a str must not refer to the contents of @a result.
+     */
+    YSTRING_API std::string& to_upper(std::string_view str,
+                                     std::string& result);
+
+    /**
+     * @brief Writes a upper case copy of @a str to @a buffer.
+     *
+     * @return The size of the upper case copy. If it is greater than the size
+     *  of @a buffer, the contents of @a buffer are unspecified.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t to_upper(std::string_view str, std::span<char> buffer);
+
+    /**
+     * @brief Converts @a str to upper case in place.
+     *
+     * @a str is only reallocated if it reaches a code point whose
+     * converted form has a different length than the code point itself.
+     * @throw YstringException if @a str contains invalid UTF-8, in which
+     *  case @a str may have been partially converted.
+     */
+    YSTRING_API std::string& to_upper_in_place(std::string& str);
+
+    /**
+     * @brief Returns the size of the upper case copy of @a str.
+     *
+     * Use it to allocate the result exactly once when @a str contains
+     * code points whose upper case forms are longer than the code points
+     * themselves.
+     * @throw YstringException if @a str contains invalid UTF-8.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t get_upper_case_size(std::string_view str);
+
+    /**
+     * @brief Returns a case-folded copy of @a str.
+     *
+     * Uses the full case folding from Unicode's CaseFolding.txt, which
+     * means that strings that only differ in letter case, such as
+     * "Straße" and "STRASSE", have identical folded forms. Folded strings
+     * can therefore be compared with == or memcmp, and strings that are
+     * compared or looked up repeatedly only need to be folded once.
+     * The Turkic mappings of I and İ are not used.
+     */
+    [[nodiscard]]
+    YSTRING_API std::string fold_case(std::string_view str);
+
+    /**
+     * @brief Appends a case-folded copy of @a str to @a result.
+     *
+     * @a str must not refer to the contents of @a result.
+     */
+    YSTRING_API std::string& fold_case(std::string_view str,
+                                      std::string& result);
+
+    /**
+     * @brief Writes a case-folded copy of @a str to @a buffer.
+     *
+     * @return The size of the case-folded copy. If it is greater than the
+     *  size of @a buffer, the contents of @a buffer are unspecified.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t fold_case(std::string_view str, std::span<char> buffer);
+
+    /**
+     * @brief Case-folds @a str in place.
+     *
+     * @a str is only reallocated if it reaches a code point whose
+     * folded form has a different length than the code point itself.
+     * @throw YstringException if @a str contains invalid UTF-8, in which
+     *  case @a str may have been partially converted.
+     */
+    YSTRING_API std::string& fold_case_in_place(std::string& str);
+
+    /**
+     * @brief Returns the size of the case-folded copy of @a str.
+     *
+     * @throw YstringException if @a str contains invalid UTF-8.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t get_case_folded_size(std::string_view str);
+
+    /**
+     * @brief Compares @a folded, which must already be case-folded, with
+     *  the case-folded form of @a str.
+     *
+     * @a str is folded a few code points at a time without allocating
+     * memory, which makes this the cheapest way to compare one fixed
+     * string with many others while ignoring case.
+     * @return A negative number if @a folded comes before the folded
+     *  @a str, 0 if they are equal and a positive number otherwise.
+     * @throw YstringException if @a str contains invalid UTF-8.
+     */
+    [[nodiscard]]
+    YSTRING_API int32_t compare_folded(std::string_view folded,
+                                       std::string_view str);
+
+    /**
+     * @brief Returns true if @a folded, which must already be
+     *  case-folded, is equal to the case-folded form of @a str.
+     *
+     * @throw YstringException if @a str contains invalid UTF-8.
+     */
+    [[nodiscard]]
+    YSTRING_API bool equal_folded(std::string_view folded,
+                                  std::string_view str);
 }
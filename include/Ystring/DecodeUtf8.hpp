@@ -24,7 +24,7 @@ namespace ystring
 {
     template <typename BiIt>
     [[nodiscard]]
-    char32_t decode_next(BiIt& it, BiIt end)
+    constexpr char32_t decode_next(BiIt& it, BiIt end)
     {
         if (it == end)
             return INVALID_CHAR;
@@ -0,0 +1,103 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include "Subrange.hpp"
+#include "YstringDefinitions.hpp"
+
+/** @file
+  * @brief Defines the diff function, which computes the differences
+  *     between two strings.
+  */
+
+namespace ystring
+{
+    /**
+     * @brief The units that diff compares.
+     */
+    enum class DiffUnit
+    {
+        CODEPOINTS,
+        /// A code point followed by any combining marks.
+        CHARS,
+        /// A line including its newline, with the same newlines as
+        /// split_lines.
+        LINES
+    };
+
+    struct DiffParams
+    {
+        DiffUnit unit = DiffUnit::CODEPOINTS;
+    };
+
+    enum class DiffOp
+    {
+        KEEP,
+        REMOVE,
+        INSERT
+    };
+
+    /**
+     * @brief A part of the edit script that turns one string into another.
+     *
+     * @a old_range and @a new_range are byte ranges in the old and new
+     * string. For REMOVE, @a new_range is empty and has the offset in the
+     * new string where the removed text would have been, and likewise
+     * for @a old_range for INSERT.
+     */
+    struct DiffChunk
+    {
+        DiffOp op = DiffOp::KEEP;
+        Subrange old_range;
+        Subrange new_range;
+    };
+
+    [[nodiscard]]
+    constexpr bool operator==(const DiffChunk& a, const DiffChunk& b)
+    {
+        return a.op == b.op && a.old_range == b.old_range
+               && a.new_range == b.new_range;
+    }
+
+    [[nodiscard]]
+    constexpr bool operator!=(const DiffChunk& a, const DiffChunk& b)
+    {
+        return !(a == b);
+    }
+
+    /**
+     * @brief Appends the shortest edit script that turns @a old_str into
+     *  @a new_str to @a chunks.
+     *
+     * Consecutive units with the same operation are merged into a single
+     * chunk, and when there are both removals and insertions between two
+     * KEEP chunks, the removal comes first.
+     *
+     * The common prefix and suffix of the strings are found by comparing
+     * eight bytes at a time, the rest is compared with Myers' O(ND)
+     * algorithm in its linear-space variant.
+     *
+     * Reusing @a chunks between calls avoids repeated allocations.
+     * @return The number of chunks that were appended.
+     * @throw YstringException if either string contains invalid UTF-8.
+     */
+    YSTRING_API size_t diff(std::string_view old_str, std::string_view new_str,
+                            std::vector<DiffChunk>& chunks,
+                            DiffParams params = {});
+
+    /**
+     * @brief Returns the shortest edit script that turns @a old_str into
+     *  @a new_str.
+     */
+    [[nodiscard]]
+    YSTRING_API std::vector<DiffChunk>
+    diff(std::string_view old_str, std::string_view new_str,
+         DiffParams params = {});
+}
@@ -0,0 +1,82 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <string_view>
+#include "Subrange.hpp"
+#include "YstringDefinitions.hpp"
+
+/** @file
+  * @brief Defines functions for Levenshtein distances and approximate
+  *     string search.
+  */
+
+namespace ystring
+{
+    struct EditDistanceParams
+    {
+        /**
+         * @brief If true, differences in letter case are ignored.
+         */
+        bool case_insensitive = false;
+        /**
+         * @brief If true, the distance is counted in characters (a code
+         *  point followed by any combining marks) rather than in code
+         *  points.
+         */
+        bool match_chars = false;
+    };
+
+    /**
+     * @brief Returns the Levenshtein distance between @a a and @a b,
+     *  i.e. the smallest number of insertions, deletions and
+     *  substitutions that turns one into the other.
+     *
+     * Uses Myers' bit-parallel algorithm, which processes 64 code points
+     * (or characters) of the shorter string at a time. Strings that are
+     * pure ASCII are compared byte by byte without decoding.
+     *
+     * @throw YstringException if @a a or @a b contains invalid UTF-8.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t edit_distance(std::string_view a, std::string_view b,
+                                     EditDistanceParams params = {});
+
+    /**
+     * @brief Returns the Levenshtein distance between @a a and @a b if
+     *  it is at most @a max_distance, otherwise a value greater than
+     *  @a max_distance.
+     *
+     * Stops as soon as it's clear that the distance is too large, which
+     * makes it much faster than edit_distance when most strings are far
+     * apart.
+     */
+    [[nodiscard]]
+    YSTRING_API size_t bounded_edit_distance(std::string_view a,
+                                             std::string_view b,
+                                             size_t max_distance,
+                                             EditDistanceParams params = {});
+
+    /**
+     * @brief Returns the first substring of @a str whose edit distance
+     *  to @a pattern is at most @a max_distance.
+     *
+     * "First" means the match that ends first. Of the matches with that
+     * end, the one with the smallest distance is returned, and if there
+     * are several, the shortest one. The offset of the result is npos if
+     * there is no match.
+     *
+     * @throw YstringException if @a str or @a pattern contains invalid
+     *  UTF-8.
+     */
+    [[nodiscard]]
+    YSTRING_API Subrange find_approximate(std::string_view str,
+                                          std::string_view pattern,
+                                          size_t max_distance,
+                                          EditDistanceParams params = {});
+}
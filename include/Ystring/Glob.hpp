@@ -0,0 +1,90 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include "YstringDefinitions.hpp"
+
+/** @file
+  * @brief Defines Glob, a matcher for shell-style wildcard patterns.
+  */
+
+namespace ystring
+{
+    struct GlobParams
+    {
+        /**
+         * @brief If true, differences in letter case are ignored.
+         */
+        bool case_insensitive = false;
+        /**
+         * @brief If true, '?', sets and literals match complete characters
+         *  (a code point followed by any combining marks) rather than
+         *  single code points.
+         */
+        bool match_chars = false;
+    };
+
+    /**
+     * @brief A compiled shell-style wildcard pattern.
+     *
+     * The pattern syntax is:
+     *   - @c * matches any number of code points (or characters).
+     *   - @c ? matches exactly one code point (or character).
+     *   - @c [...] matches one code point in a set, using the syntax
+     *     of parse_codepoint_set, e.g. "[a-z_]" or "[^0-9]".
+     *   - @c \\ makes the next code point a literal.
+     *
+     * The pattern is split into segments at each @c *. The first segment
+     * must match at the start of the string and the last at the end,
+     * the ones in between are searched for from left to right, each
+     * taking the earliest possible match. There is no backtracking.
+     * Segments that are plain literals are found with a substring search,
+     * other segments with a bit-parallel (shift-and) scan. Matching is
+     * linear in the length of the string, the scan uses one 64-bit word
+     * per 64 elements in a segment.
+     */
+    class YSTRING_API Glob
+    {
+    public:
+        /**
+         * @throw YstringException if @a pattern has an invalid set
+         *  or invalid UTF-8.
+         */
+        explicit Glob(std::string_view pattern, GlobParams params = {});
+
+        /**
+         * @brief Returns true if all of @a str matches the pattern.
+         * @throw YstringException if @a str contains invalid UTF-8.
+         */
+        [[nodiscard]]
+        bool match(std::string_view str) const;
+
+        [[nodiscard]]
+        bool operator()(std::string_view str) const
+        {
+            return match(str);
+        }
+    private:
+        struct Data;
+        std::shared_ptr<const Data> m_data;
+    };
+
+    /**
+     * @brief Returns true if all of @a str matches the wildcard
+     *  @a pattern.
+     *
+     * Create a Glob instead when the same pattern is matched against
+     * many strings.
+     */
+    [[nodiscard]]
+    YSTRING_API bool match_glob(std::string_view str,
+                                std::string_view pattern,
+                                GlobParams params = {});
+}
@@ -0,0 +1,96 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "CodepointSet.hpp"
+#include "Subrange.hpp"
+#include "YstringDefinitions.hpp"
+
+/** @file
+  * @brief Multi-threaded versions of some of the search functions,
+  *     intended for very large strings.
+  */
+
+namespace ystring
+{
+    struct ParallelParams
+    {
+        /**
+         * @brief The maximum number of threads, including the calling
+         *  thread. 0 means std::thread::hardware_concurrency().
+         */
+        unsigned max_threads = 0;
+        /**
+         * @brief The minimum number of bytes each thread searches.
+         *
+         * Strings shorter than twice this size are searched by the calling
+         * thread alone.
+         */
+        size_t min_chunk_size = size_t(1) << 20u;
+    };
+
+    /**
+     * @brief Parallel versions of functions in Algorithms.hpp.
+     *
+     * The string is split into one chunk per thread. Chunk boundaries are
+     * moved to the nearest following code point boundary, and searches
+     * for a pattern read up to the pattern's length minus one byte past
+     * the end of their chunk, so matches that cross a boundary are found.
+     * The results are merged in order and are identical to those of the
+     * sequential functions, including any exceptions.
+     */
+    namespace parallel
+    {
+        /**
+         * @brief Returns every non-overlapping occurrence of @a cmp in @a str.
+         * @see ystring::find_all
+         */
+        [[nodiscard]]
+        YSTRING_API std::vector<Subrange>
+        find_all(std::string_view str, std::string_view cmp,
+                 ParallelParams params = {});
+
+        /**
+         * @brief Returns the first occurrence of @a cmp in @a str.
+         * @see ystring::find_first
+         */
+        [[nodiscard]]
+        YSTRING_API Subrange
+        find_first(std::string_view str, std::string_view cmp,
+                   ParallelParams params = {});
+
+        /**
+         * @brief Returns the first code point in @a str that is in @a chars.
+         * @see ystring::find_first_of
+         */
+        [[nodiscard]]
+        YSTRING_API std::pair<Subrange, char32_t>
+        find_first_of(std::string_view str, std::u32string_view chars,
+                      ParallelParams params = {});
+
+        /**
+         * @brief Returns the first code point in @a str that is in @a chars.
+         * @see ystring::find_first_of
+         */
+        [[nodiscard]]
+        YSTRING_API std::pair<Subrange, char32_t>
+        find_first_of(std::string_view str, const CodepointSet& chars,
+                      ParallelParams params = {});
+
+        /**
+         * @brief Returns true if @a str is a valid UTF-8 string.
+         * @see ystring::is_valid_utf8
+         */
+        [[nodiscard]]
+        YSTRING_API bool is_valid_utf8(std::string_view str,
+                                       ParallelParams params = {});
+    }
+}
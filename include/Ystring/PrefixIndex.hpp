@@ -0,0 +1,150 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "YstringDefinitions.hpp"
+
+/** @file
+  * @brief Defines PrefixIndex, an index for finding keys by their
+  *     prefixes.
+  */
+
+namespace ystring
+{
+    struct PrefixIndexParams
+    {
+        /**
+         * @brief If true, differences in letter case are ignored.
+         */
+        bool case_insensitive = false;
+    };
+
+    /**
+     * @brief A key whose contents is a prefix of a string.
+     */
+    struct PrefixMatch
+    {
+        /**
+         * @brief The index of the key in the list the PrefixIndex was
+         *  built from, or npos if there is no match.
+         */
+        size_t key = std::string_view::npos;
+        /**
+         * @brief The number of bytes at the start of the string that
+         *  matched the key.
+         */
+        size_t length = 0;
+
+        constexpr explicit operator bool() const
+        {
+            return key != std::string_view::npos;
+        }
+    };
+
+    [[nodiscard]]
+    constexpr bool operator==(const PrefixMatch& a, const PrefixMatch& b)
+    {
+        return a.key == b.key && a.length == b.length;
+    }
+
+    [[nodiscard]]
+    constexpr bool operator!=(const PrefixMatch& a, const PrefixMatch& b)
+    {
+        return !(a == b);
+    }
+
+    /**
+     * @brief An immutable index over a list of keys that finds the keys
+     *  that start with a given prefix, and the keys that are prefixes of
+     *  a given string.
+     *
+     * The keys are folded (if the index is case-insensitive) and stored
+     * once in a single buffer, sorted, and organized as a compressed trie
+     * where each node is the range of sorted keys that share the node's
+     * prefix. The nodes are stored breadth-first in one array, so the
+     * children of a node are adjacent and are found with a binary search
+     * over their first bytes. A query of @a m bytes visits at most @a m
+     * nodes, and queries are folded one code point at a time while the
+     * trie is traversed, so they don't allocate memory.
+     *
+     * Keys that are equal (after folding) are all kept, in the order
+     * they had in the original list.
+     */
+    class YSTRING_API PrefixIndex
+    {
+    public:
+        PrefixIndex();
+
+        /**
+         * @throw YstringException if the index is case-insensitive and
+         *  one of the keys contains invalid UTF-8.
+         */
+        explicit PrefixIndex(const std::vector<std::string_view>& keys,
+                             PrefixIndexParams params = {});
+
+        /**
+         * @throw YstringException if the index is case-insensitive and
+         *  one of the keys contains invalid UTF-8.
+         */
+        explicit PrefixIndex(const std::vector<std::string>& keys,
+                             PrefixIndexParams params = {});
+
+        /**
+         * @brief Returns the number of keys in the index.
+         */
+        [[nodiscard]]
+        size_t size() const;
+
+        [[nodiscard]]
+        bool empty() const;
+
+        /**
+         * @brief Returns the indices of the keys that start with
+         *  @a prefix.
+         *
+         * The indices refer to the list the index was built from, and
+         * are in the keys' sorted (and folded) order. The returned span
+         * is valid as long as the index.
+         * @throw YstringException if the index is case-insensitive and
+         *  @a prefix contains invalid UTF-8.
+         */
+        [[nodiscard]]
+        std::span<const size_t> find_keys(std::string_view prefix) const;
+
+        /**
+         * @brief Returns the longest key that @a str starts with.
+         *
+         * If there are several equal keys, the one that came first in the
+         * original list is returned.
+         * @throw YstringException if the index is case-insensitive and
+         *  @a str contains invalid UTF-8.
+         */
+        [[nodiscard]]
+        PrefixMatch find_longest_prefix(std::string_view str) const;
+
+        /**
+         * @brief Appends all the keys that @a str starts with to
+         *  @a matches, from the shortest to the longest.
+         *
+         * Reusing @a matches between calls avoids repeated allocations.
+         * @return The number of matches that were appended.
+         * @throw YstringException if the index is case-insensitive and
+         *  @a str contains invalid UTF-8.
+         */
+        size_t find_prefixes(std::string_view str,
+                             std::vector<PrefixMatch>& matches) const;
+    private:
+        struct Data;
+        std::shared_ptr<const Data> m_data;
+    };
+}
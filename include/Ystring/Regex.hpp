@@ -0,0 +1,119 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <vector>
+#include "Subrange.hpp"
+#include "YstringDefinitions.hpp"
+
+/** @file
+  * @brief Defines Regex, a small regular expression engine for UTF-8
+  *     strings.
+  */
+
+namespace ystring
+{
+    struct RegexParams
+    {
+        /**
+         * @brief If true, literals and sets in brackets also match
+         *  the other cases of their code points.
+         */
+        bool case_insensitive = false;
+    };
+
+    /**
+     * @brief A compiled regular expression.
+     *
+     * The supported syntax is:
+     *   - Literal code points. The characters @c .[]()|*+?{}^$\\ must
+     *     be escaped with @c \\.
+     *   - @c . matches any code point except '\\n'.
+     *   - @c [...] matches one code point in a set, using the syntax
+     *     of parse_codepoint_set, e.g. "[a-z_]" or "[^0-9]".
+     *   - @c \\d, @c \\w and @c \\s match decimal digits, word characters
+     *     (letters, marks, digits and connector punctuation) and white
+     *     space. @c \\D, @c \\W and @c \\S match their complements.
+     *   - @c \\p{Lu}, @c \\pL etc. match code points in a Unicode general
+     *     category, @c \\P{..} the ones that aren't.
+     *   - @c \\n, @c \\r, @c \\t, @c \\f, @c \\v and @c \\x{HHHH}.
+     *   - Alternation with @c |, grouping with @c (...) or @c (?:...).
+     *   - Repetition with @c *, @c +, @c ?, @c {n}, @c {n,} and @c {n,m},
+     *     followed by @c ? to make them lazy.
+     *   - The anchors @c ^ and @c $, which match at the start and end
+     *     of the string.
+     *
+     * There are no captures, back-references or look-arounds. In return,
+     * matching time is linear in the length of the string. The pattern
+     * is compiled to an NFA over UTF-8 bytes, and the states of the
+     * corresponding DFA are built on demand while strings are searched.
+     * Searches for patterns that start with a literal skip ahead with
+     * a substring search.
+     *
+     * The leftmost match wins, and among the matches starting there the
+     * one preferred by the order of the alternatives and the greediness
+     * of the repetitions. This gives the same matches as Perl and
+     * ECMAScript, except when the body of a repetition can match an
+     * empty string, which those two don't agree on either. For instance,
+     * @c (?:^|[ab])* matches all of "abb" here and in ECMAScript, but
+     * only the empty string at the start in Perl, while @c (?:a*?)*
+     * matches "a" of "aa" here, but "aa" in ECMAScript. Invalid UTF-8 in
+     * the string never matches anything.
+     *
+     * A Regex updates its DFA cache while it is used, which is why
+     * match, find_first and find_all aren't const. The same Regex must
+     * therefore not be used by several threads at the same time. Give
+     * each thread its own copy instead; copies share the compiled
+     * pattern.
+     */
+    class YSTRING_API Regex
+    {
+    public:
+        /**
+         * @throw YstringException if @a pattern is invalid.
+         */
+        explicit Regex(std::string_view pattern, RegexParams params = {});
+
+        Regex(const Regex& other);
+
+        Regex(Regex&& other) noexcept;
+
+        ~Regex();
+
+        Regex& operator=(const Regex& other);
+
+        Regex& operator=(Regex&& other) noexcept;
+
+        /**
+         * @brief Returns true if all of @a str matches the pattern.
+         */
+        [[nodiscard]]
+        bool match(std::string_view str);
+
+        /**
+         * @brief Returns the first match in @a str that starts at or
+         *  after @a offset.
+         *
+         * The offset of the result is npos if there is no match. Note
+         * that the result of a successful match can be empty.
+         */
+        [[nodiscard]]
+        Subrange find_first(std::string_view str, size_t offset = 0);
+
+        /**
+         * @brief Returns all non-overlapping matches in @a str.
+         */
+        [[nodiscard]]
+        std::vector<Subrange> find_all(std::string_view str);
+    private:
+        struct Data;
+        std::unique_ptr<Data> m_data;
+    };
+}
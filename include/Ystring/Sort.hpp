@@ -0,0 +1,103 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <span>
+#include <string>
+#include <string_view>
+#include "YstringDefinitions.hpp"
+
+/** @file
+  * @brief Defines functions for sorting large numbers of strings.
+  */
+
+namespace ystring
+{
+    /**
+     * @brief Returns a key for @a str that can be compared with other
+     *  keys with memcmp (or std::string's comparison operators) to sort
+     *  strings case-insensitively.
+     *
+     * Comparing two keys gives the same result as case_insensitive::compare
+     * on the original strings, except that strings that are equal when
+     * case is ignored are ordered by their original bytes. The key
+     * consists of the upper case code points of @a str, followed by two
+     * zero bytes and @a str itself. Zero bytes in the first part are
+     * written as a zero byte followed by 0x01.
+     * @throw YstringException if @a str contains invalid UTF-8.
+     */
+    [[nodiscard]]
+    YSTRING_API std::string case_insensitive_sort_key(std::string_view str);
+
+    /**
+     * @brief Appends the case-insensitive sort key for @a str to @a result.
+     *
+     * @a str must not refer to the contents of @a result.
+     * @throw YstringException if @a str contains invalid UTF-8.
+     */
+    YSTRING_API std::string&
+    case_insensitive_sort_key(std::string_view str, std::string& result);
+
+    /**
+     * @brief Sorts @a strs in case-insensitive order.
+     *
+     * The order is the same as with case_insensitive::less, with ties
+     * broken by comparing the original strings. The sort keys are computed
+     * once for each string and stored together in a single buffer, and
+     * the strings are then sorted by their keys. This is much faster than
+     * sorting with case_insensitive::less, which decodes and converts
+     * both strings in every comparison.
+     * @throw YstringException if any of the strings contain invalid UTF-8.
+     */
+    YSTRING_API void sort_case_insensitive(std::span<std::string_view> strs);
+
+    struct RadixSortParams
+    {
+        /**
+         * @brief If true, the strings are sorted in the same order as
+         *  with sort_case_insensitive.
+         */
+        bool case_insensitive = false;
+        /**
+         * @brief The maximum number of threads, including the calling
+         *  thread. 0 means std::thread::hardware_concurrency().
+         */
+        unsigned max_threads = 0;
+        /**
+         * @brief Lists with fewer strings than this are sorted by the
+         *  calling thread alone.
+         */
+        size_t min_parallel_size = size_t(1) << 16u;
+    };
+
+    /**
+     * @brief Sorts @a strs with a multikey quicksort, a radix sort that
+     *  partitions the strings like quicksort.
+     *
+     * The strings are sorted by their bytes, which for valid UTF-8 is the
+     * same as sorting them by their code points. If @a params.case_insensitive
+     * is true, the strings are instead sorted by their upper case code
+     * points, with ties broken by comparing the original strings.
+     * The conversion is done one code point at a time as the sort
+     * reaches it, so the strings are never copied.
+     *
+     * The next eight (converted) bytes of each string are stored next to
+     * the string as an integer, so the partitioning only compares
+     * integers in a contiguous array, and each string is read once per
+     * eight bytes instead of once per comparison. The strings with the
+     * same eight bytes are then sorted by the next eight.
+     * If more than one thread is used, the strings are first divided into
+     * buckets by their first byte, and the buckets are sorted in
+     * parallel.
+     * @throw YstringException if @a params.case_insensitive is true and
+     *  any of the strings contain invalid UTF-8. @a strs is unchanged
+     *  if this happens.
+     */
+    YSTRING_API void radix_sort(std::span<std::string_view> strs,
+                                RadixSortParams params = {});
+}
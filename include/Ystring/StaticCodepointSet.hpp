@@ -0,0 +1,326 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include "Algorithms.hpp"
+#include "CodepointSet.hpp"
+#include "DecodeUtf8.hpp"
+
+/** @file
+  * @brief Defines StaticCodepointSet and the _cps literal that creates
+  *     code point sets at compile time.
+  */
+
+namespace ystring
+{
+    namespace detail
+    {
+        /**
+         * @brief Decodes a code point in a codepoint set expression,
+         *  resolving escape sequences.
+         */
+        constexpr bool next_set_codepoint(std::string_view str, size_t& i,
+                                          char32_t& ch)
+        {
+            if (i == str.size())
+                return false;
+            if (str[i] == '\\')
+            {
+                if (++i == str.size())
+                    return false;
+                switch (str[i])
+                {
+                case 'n': ++i; ch = '\n'; return true;
+                case 'r': ++i; ch = '\r'; return true;
+                case 't': ++i; ch = '\t'; return true;
+                default: break;
+                }
+            }
+            auto it = str.begin() + i;
+            ch = decode_next(it, str.end());
+            i = size_t(it - str.begin());
+            return ch != INVALID_CHAR;
+        }
+
+        /**
+         * @brief Parses a set expression like "[a-z_]" or "[^0-9]" and
+         *  calls @a add_range with each range in it.
+         *
+         * The characters ']', '-', '^' and '\\' must be escaped with '\\'
+         * when they are members of the set, unless '-' is the first or
+         * last character in the set.
+         * @return nullptr on success, otherwise an error message.
+         */
+        template <typename AddRangeFunc>
+        constexpr const char*
+        parse_codepoint_set(std::string_view str, bool& negated,
+                            AddRangeFunc add_range)
+        {
+            if (str.size() < 2 || str.front() != '[' || str.back() != ']')
+                return "Codepoint set must start with '[' and end with ']'.";
+
+            size_t i = 1;
+            size_t end = str.size() - 1;
+            negated = str[i] == '^';
+            if (negated)
+                ++i;
+
+            auto body = str.substr(0, end);
+            while (i != end)
+            {
+                if (str[i] == ']')
+                    return "Unescaped ']' in codepoint set.";
+                char32_t first;
+                if (!next_set_codepoint(body, i, first))
+                    return "Invalid UTF-8 or escape in codepoint set.";
+                if (i + 1 < end && str[i] == '-')
+                {
+                    ++i;
+                    char32_t last;
+                    if (!next_set_codepoint(body, i, last))
+                        return "Invalid UTF-8 or escape in codepoint set.";
+                    if (last < first)
+                        return "Invalid range in codepoint set.";
+                    add_range(first, last);
+                }
+                else
+                {
+                    add_range(first, first);
+                }
+            }
+            return nullptr;
+        }
+
+        template <size_t N>
+        struct FixedString
+        {
+            consteval FixedString(const char (&str)[N])
+            {
+                std::copy_n(str, N, chars);
+            }
+
+            [[nodiscard]]
+            constexpr std::string_view view() const
+            {
+                return {chars, N - 1};
+            }
+
+            char chars[N] = {};
+        };
+
+        /**
+         * @brief Deliberately not constexpr. Calling it from
+         *  a constant expression makes the compilation fail.
+         */
+        inline void invalid_codepoint_set_literal(const char* message)
+        {
+            throw YstringException(message);
+        }
+
+        template <FixedString Str>
+        consteval size_t count_set_ranges()
+        {
+            bool negated = false;
+            size_t count = 0;
+            auto error = parse_codepoint_set(
+                Str.view(), negated, [&](char32_t, char32_t) {++count;});
+            if (error)
+                invalid_codepoint_set_literal(error);
+            return count;
+        }
+
+        /**
+         * @brief Returns the sorted and merged ranges in @a Str, and
+         *  the number of ranges.
+         */
+        template <FixedString Str>
+        consteval auto get_canonical_set_ranges()
+        {
+            std::array<CodepointRange, count_set_ranges<Str>()> ranges{};
+            size_t n = 0;
+            bool negated = false;
+            parse_codepoint_set(Str.view(), negated,
+                                [&](char32_t first, char32_t last)
+                                {ranges[n++] = {first, last};});
+            std::sort(ranges.begin(), ranges.end());
+
+            n = 0;
+            for (auto& range : ranges)
+            {
+                if (n != 0 && range.first <= ranges[n - 1].second + 1)
+                    ranges[n - 1].second = std::max(ranges[n - 1].second,
+                                                    range.second);
+                else
+                    ranges[n++] = range;
+            }
+            return std::pair(ranges, n);
+        }
+    }
+
+    /**
+     * @brief A code point set whose contents are fixed at compile time.
+     *
+     * Instances are normally created with the _cps literal, e.g.
+     * "[a-zA-Z_]"_cps. ASCII membership is stored as a bitmap, the
+     * remaining code points are found by a binary search in @a ranges.
+     */
+    template <size_t N>
+    struct StaticCodepointSet
+    {
+        std::array<CodepointRange, N> ranges = {};
+        uint64_t ascii[2] = {};
+        bool negated = false;
+
+        [[nodiscard]]
+        constexpr bool contains(char32_t cp) const
+        {
+            return in_ranges(cp) != negated;
+        }
+
+        [[nodiscard]]
+        bool case_insensitive_contains(char32_t cp) const
+        {
+            // The negation applies to the set of case variants as a whole.
+            return (in_ranges(cp) || in_ranges(to_upper(cp))
+                    || in_ranges(to_lower(cp)) || in_ranges(to_title(cp)))
+                   != negated;
+        }
+
+        /**
+         * @brief Returns true if @a cp is in @a ranges, disregarding
+         *  @a negated.
+         */
+        [[nodiscard]]
+        constexpr bool in_ranges(char32_t cp) const
+        {
+            if (cp < 128)
+                return ((ascii[cp >> 6u] >> (cp & 63u)) & 1u) != 0;
+
+            size_t lo = 0, hi = N;
+            while (lo < hi)
+            {
+                auto mid = (lo + hi) / 2;
+                if (cp < ranges[mid].first)
+                    hi = mid;
+                else if (ranges[mid].second < cp)
+                    lo = mid + 1;
+                else
+                    return true;
+            }
+            return false;
+        }
+
+        [[nodiscard]]
+        constexpr bool operator()(char32_t cp) const
+        {
+            return contains(cp);
+        }
+
+        [[nodiscard]]
+        CodepointSet to_codepoint_set() const
+        {
+            return {{ranges.begin(), ranges.end()}, negated};
+        }
+    };
+
+    namespace detail
+    {
+        template <FixedString Str>
+        consteval auto make_static_codepoint_set()
+        {
+            constexpr auto canonical = get_canonical_set_ranges<Str>();
+            StaticCodepointSet<canonical.second> result;
+            std::copy_n(canonical.first.begin(), canonical.second,
+                        result.ranges.begin());
+            for (auto [first, last] : result.ranges)
+            {
+                for (auto c = first; c <= last && c < 128; ++c)
+                    result.ascii[c >> 6u] |= uint64_t(1) << (c & 63u);
+            }
+            parse_codepoint_set(Str.view(), result.negated,
+                                [](char32_t, char32_t) {});
+            return result;
+        }
+
+        template <FixedString Str>
+        inline constexpr auto STATIC_CODEPOINT_SET =
+            make_static_codepoint_set<Str>();
+    }
+
+    namespace literals
+    {
+        /**
+         * @brief Returns a reference to a StaticCodepointSet that is
+         *  created at compile time from a set expression like "[a-z_]".
+         */
+        template <detail::FixedString Str>
+        consteval const auto& operator""_cps()
+        {
+            return detail::STATIC_CODEPOINT_SET<Str>;
+        }
+    }
+
+    template <size_t N>
+    [[nodiscard]]
+    size_t count_of(std::string_view str, const StaticCodepointSet<N>& chars)
+    {
+        return count_where(str, chars);
+    }
+
+    template <size_t N>
+    [[nodiscard]]
+    std::vector<Subrange>
+    find_all_of(std::string_view str, const StaticCodepointSet<N>& chars)
+    {
+        std::vector<Subrange> result;
+        size_t offset = 0;
+        while (true)
+        {
+            auto [match, ch] = find_first_where(str, chars, offset);
+            if (!match)
+                break;
+            result.push_back(match);
+            offset = match.end();
+        }
+        return result;
+    }
+
+    template <size_t N>
+    [[nodiscard]]
+    std::pair<Subrange, char32_t>
+    find_first_of(std::string_view str, const StaticCodepointSet<N>& chars,
+                  size_t offset = 0)
+    {
+        return find_first_where(str, chars, offset);
+    }
+
+    template <size_t N>
+    [[nodiscard]]
+    std::pair<Subrange, char32_t>
+    find_last_of(std::string_view str, const StaticCodepointSet<N>& chars,
+                 size_t offset = std::string_view::npos)
+    {
+        return find_last_where(str, chars, offset);
+    }
+
+    template <size_t N>
+    [[nodiscard]]
+    std::vector<std::string_view>
+    split(std::string_view str, const StaticCodepointSet<N>& chars,
+          SplitParams params = {})
+    {
+        return split_where(
+            str,
+            [&](auto s) {return find_first_where(s, chars).first;},
+            params);
+    }
+}
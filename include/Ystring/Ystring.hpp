@@ -11,7 +11,15 @@
 #include "CaseInsensitive.hpp"
 #include "CodepointPredicates.hpp"
 #include "ConvertCase.hpp"
+#include "Diff.hpp"
+#include "EditDistance.hpp"
+#include "Glob.hpp"
 #include "Normalize.hpp"
+#include "Parallel.hpp"
+#include "PrefixIndex.hpp"
+#include "Regex.hpp"
+#include "Sort.hpp"
+#include "StaticCodepointSet.hpp"
 #include "Unescape.hpp"
 #include "Utf32.hpp"
 #include "YstringException.hpp"
@@ -7,11 +7,15 @@
 //****************************************************************************
 #include "Ystring/Algorithms.hpp"
 
+#include <bit>
+#include <cstring>
 #include "Ystring/DecodeUtf8.hpp"
 #include "EncodeUtf8.hpp"
 #include "Ystring/CaseInsensitive.hpp"
-#include "Ystring/CodepointPredicates.hpp"
 #include "AlgorithmUtilities.hpp"
+#include "ByteSearch.hpp"
+#include "CaseInsensitiveSearch.hpp"
+#include "CodepointPropertiesTables.hpp"
 
 namespace ystring
 {
@@ -26,6 +30,68 @@ namespace ystring
             LINE_SEPARATOR,
             PARAGRAPH_SEPARATOR
         };
+
+        /**
+         * @brief Calls @a callback with the position of every code point
+         *  in @a str where @a pred is true.
+         *
+         * @a pred is evaluated once for each ASCII character up front,
+         * ASCII bytes in @a str are then looked up without being decoded.
+         */
+        template <typename Predicate, typename Callback>
+        void for_each_codepoint_where(std::string_view str, Predicate pred,
+                                      Callback callback)
+        {
+            uint64_t ascii[2] = {};
+            for (char32_t c = 0; c < 128; ++c)
+            {
+                if (pred(c))
+                    ascii[c >> 6u] |= uint64_t(1) << (c & 63u);
+            }
+
+            auto it = str.begin();
+            while (it != str.end())
+            {
+                auto byte = uint8_t(*it);
+                if (byte < 0x80)
+                {
+                    if ((ascii[byte >> 6u] >> (byte & 63u)) & 1u)
+                        callback(Subrange(size_t(it - str.begin()), 1));
+                    ++it;
+                    continue;
+                }
+
+                auto start = it;
+                char32_t ch;
+                safe_decode_next(it, str.end(), ch);
+                if (pred(ch))
+                    callback(Subrange(str.begin(), start, it));
+            }
+        }
+
+        template <typename Callback>
+        void for_each_codepoint_of(std::string_view str,
+                                   std::u32string_view chars,
+                                   Callback callback)
+        {
+            if (!EncodedCodepointFinder::is_suitable(chars))
+            {
+                for_each_codepoint_where(
+                    str, [&](auto c) {return contains(chars, c);}, callback);
+                return;
+            }
+
+            EncodedCodepointFinder finder(chars);
+            size_t offset = 0;
+            while (true)
+            {
+                auto [match, ch] = finder.find_first(str, offset);
+                if (!match)
+                    break;
+                callback(match);
+                offset = match.end();
+            }
+        }
     }
 
     std::string& append(std::string& str, char32_t chr)
@@ -44,14 +110,24 @@ namespace ystring
 
     bool contains(std::string_view str, char32_t chr)
     {
-        auto it = str.begin(), end = str.end();
-        char32_t ch;
-        while (safe_decode_next(it, end, ch))
-        {
-            if (ch == chr)
-                return true;
-        }
-        return false;
+        char encoded[4];
+        auto size = encode_utf8(chr, encoded, sizeof(encoded));
+        if (size == 0)
+            return false;
+        if (size == 1)
+            return std::memchr(str.data(), encoded[0], str.size()) != nullptr;
+        return str.find(std::string_view(encoded, size))
+               != std::string_view::npos;
+    }
+
+    size_t count(std::string_view str, std::string_view cmp)
+    {
+        if (cmp.size() == 1)
+            return size_t(std::count(str.begin(), str.end(), cmp[0]));
+
+        size_t result = 0;
+        find_all(str, cmp, [&](Subrange) {++result;});
+        return result;
     }
 
     size_t count_chars(std::string_view str)
@@ -77,45 +153,94 @@ namespace ystring
         return result;
     }
 
+    size_t count_of(std::string_view str, std::u32string_view chars)
+    {
+        if (chars.size() == 1 && chars[0] < 0x80)
+            return size_t(std::count(str.begin(), str.end(), char(chars[0])));
+
+        size_t result = 0;
+        for_each_codepoint_of(str, chars, [&](Subrange) {++result;});
+        return result;
+    }
+
+    size_t count_of(std::string_view str, const CodepointSet& chars)
+    {
+        size_t result = 0;
+        for_each_codepoint_where(
+            str,
+            [&](auto c) {return chars.contains(c);},
+            [&](Subrange) {++result;});
+        return result;
+    }
+
     bool ends_with(std::string_view str, std::string_view cmp)
     {
         return str.size() >= cmp.size()
                && str.substr(str.size() - cmp.size()) == cmp;
     }
 
+    size_t find_all(std::string_view str, std::string_view cmp,
+                    std::vector<Subrange>& matches)
+    {
+        auto size = matches.size();
+        find_all(str, cmp, [&](Subrange match) {matches.push_back(match);});
+        return matches.size() - size;
+    }
+
+    std::vector<Subrange> find_all(std::string_view str, std::string_view cmp)
+    {
+        std::vector<Subrange> result;
+        find_all(str, cmp, result);
+        return result;
+    }
+
+    std::vector<Subrange>
+    find_all_of(std::string_view str, std::u32string_view chars)
+    {
+        std::vector<Subrange> result;
+        for_each_codepoint_of(
+            str, chars, [&](Subrange match) {result.push_back(match);});
+        return result;
+    }
+
+    std::vector<Subrange>
+    find_all_of(std::string_view str, const CodepointSet& chars)
+    {
+        std::vector<Subrange> result;
+        for_each_codepoint_where(
+            str,
+            [&](auto c) {return chars.contains(c);},
+            [&](Subrange match) {result.push_back(match);});
+        return result;
+    }
+
     Subrange find_first(std::string_view str,
                         std::string_view cmp,
                         size_t offset)
     {
-        auto it = std::search(str.begin() + offset, str.end(),
-                              cmp.begin(), cmp.end());
-        if (it == str.end())
+        auto pos = str.find(cmp, offset);
+        if (pos == std::string_view::npos)
             return {str.size(), 0};
-        return {size_t(it - str.begin()), cmp.size()};
+        return {pos, cmp.size()};
     }
 
     Subrange find_first_newline(std::string_view str, size_t offset)
     {
-        auto [s, c] = find_first_of(str, NEWLINES, offset);
-        if (c != '\r')
-            return s;
-        auto it = str.begin() + s.end();
-        char32_t ch;
-        if (safe_decode_next(it, str.end(), ch) && ch == '\n')
-            return {s.start(), (it - str.begin()) - s.start()};
-        return s;
+        return find_first_newline_bytes(str, offset);
     }
 
     std::pair<Subrange, char32_t>
     find_first_of(std::string_view str, std::u32string_view chars, size_t offset)
     {
+        if (EncodedCodepointFinder::is_suitable(chars))
+            return EncodedCodepointFinder(chars).find_first(str, offset);
         return find_first_where(str,
                                 [&](auto c) {return contains(chars, c);},
                                 offset);
     }
 
     std::pair<Subrange, char32_t>
-    find_first_of(std::string_view str, CodepointSet chars, size_t offset)
+    find_first_of(std::string_view str, const CodepointSet& chars, size_t offset)
     {
         return find_first_where(str,
                                 [&](auto c) {return chars.contains(c);},
@@ -148,6 +273,8 @@ namespace ystring
     std::pair<Subrange, char32_t>
     find_last_of(std::string_view str, std::u32string_view chars, size_t offset)
     {
+        if (EncodedCodepointFinder::is_suitable(chars))
+            return EncodedCodepointFinder(chars).find_last(str, offset);
         return find_last_where(
             str,
             [&](auto c) {return contains(chars, c);},
@@ -155,7 +282,7 @@ namespace ystring
     }
 
     std::pair<Subrange, char32_t>
-    find_last_of(std::string_view str, CodepointSet chars, size_t offset)
+    find_last_of(std::string_view str, const CodepointSet& chars, size_t offset)
     {
         return find_last_where(
             str,
@@ -293,7 +420,7 @@ namespace ystring
 
         auto end = it;
         while (safe_decode_next(it, str.end(), codepoint)
-               && is_mark(codepoint))
+               && CODEPOINT_PROPERTY_TABLE.get(codepoint).is(CharClass::MARK))
         {
             end = it;
         }
@@ -306,7 +433,7 @@ namespace ystring
         auto it = str.begin() + offset;
         char32_t codepoint;
         while (safe_decode_prev(str.begin(), it, codepoint)
-               && is_mark(codepoint))
+               && CODEPOINT_PROPERTY_TABLE.get(codepoint).is(CharClass::MARK))
         {
         }
 
@@ -358,18 +485,19 @@ namespace ystring
         std::string result;
         if (max_replacements >= 0)
         {
-            auto it = str.begin();
-            while (max_replacements-- > 0)
+            size_t pos = 0;
+            if (max_replacements != 0)
             {
-                auto match = std::search(it, str.end(), from.begin(), from.end());
-                if (match == str.end())
-                    break;
-                result.append(it, match);
-                result.append(to);
-                it = match + from.size();
+                find_all(str, from, [&](Subrange match)
+                {
+                    result.append(str.substr(pos, match.start() - pos));
+                    result.append(to);
+                    pos = match.end();
+                    return --max_replacements != 0;
+                });
             }
-            if (it != str.end())
-                result.append(it, str.end());
+            if (pos != str.size())
+                result.append(str.substr(pos));
         }
         else
         {
@@ -467,6 +595,14 @@ namespace ystring
     std::vector<std::string_view>
     split(std::string_view str, std::u32string_view chars, SplitParams params)
     {
+        if (EncodedCodepointFinder::is_suitable(chars))
+        {
+            EncodedCodepointFinder finder(chars);
+            return split_where(
+                str,
+                [&](auto s) {return finder.find_first(s).first;},
+                params);
+        }
         return split_where(
             str,
             [&](auto s) {return find_first_of(s, chars).first;},
@@ -497,16 +633,25 @@ namespace ystring
 
     std::string_view trim(std::string_view str, std::u32string_view chars)
     {
+        if (EncodedCodepointFinder::is_suitable(chars))
+        {
+            EncodedCodepointFinder finder(chars);
+            return finder.trim_end(finder.trim_start(str));
+        }
         return trim_end(trim_start(str, chars), chars);
     }
 
     std::string_view trim_end(std::string_view str, std::u32string_view chars)
     {
+        if (EncodedCodepointFinder::is_suitable(chars))
+            return EncodedCodepointFinder(chars).trim_end(str);
         return trim_end_where(str, [&](auto c) {return contains(chars, c);});
     }
 
     std::string_view trim_start(std::string_view str, std::u32string_view chars)
     {
+        if (EncodedCodepointFinder::is_suitable(chars))
+            return EncodedCodepointFinder(chars).trim_start(str);
         return trim_start_where(str, [&](auto c) {return contains(chars, c);});
     }
 
@@ -514,8 +659,9 @@ namespace ystring
     {
         int32_t compare(std::string_view str, std::string_view cmp)
         {
-            auto s_it = str.begin();
-            auto c_it = cmp.begin();
+            auto prefix = ptrdiff_t(get_ascii_case_insensitive_prefix(str, cmp));
+            auto s_it = str.begin() + prefix;
+            auto c_it = cmp.begin() + prefix;
             while (true)
             {
                 char32_t s_ch;
@@ -530,17 +676,32 @@ namespace ystring
             }
         }
 
+        size_t count(std::string_view str, std::string_view cmp)
+        {
+            size_t result = 0;
+            CaseInsensitiveSearcher(cmp).find_all(
+                str,
+                [&](Subrange)
+                {
+                    ++result;
+                    return true;
+                });
+            return result;
+        }
+
         bool ends_with(std::string_view str, std::string_view cmp)
         {
+            auto suffix = ptrdiff_t(get_ascii_case_insensitive_suffix(str, cmp));
             auto [it_str, it_cmp] = prev_case_insensitive_mismatch(
-                str.begin(), str.end(), cmp.begin(), cmp.end());
+                str.begin(), str.end() - suffix, cmp.begin(), cmp.end() - suffix);
             return it_cmp == cmp.begin();
         }
 
         bool equal(std::string_view str, std::string_view cmp)
         {
-            auto s_it = str.begin();
-            auto c_it = cmp.begin();
+            auto prefix = ptrdiff_t(get_ascii_case_insensitive_prefix(str, cmp));
+            auto s_it = str.begin() + prefix;
+            auto c_it = cmp.begin() + prefix;
             while (true)
             {
                 char32_t s_ch;
@@ -555,30 +716,33 @@ namespace ystring
             }
         }
 
+        size_t find_all(std::string_view str, std::string_view cmp,
+                        std::vector<Subrange>& matches)
+        {
+            auto size = matches.size();
+            CaseInsensitiveSearcher(cmp).find_all(
+                str,
+                [&](Subrange match)
+                {
+                    matches.push_back(match);
+                    return true;
+                });
+            return matches.size() - size;
+        }
+
+        std::vector<Subrange> find_all(std::string_view str,
+                                       std::string_view cmp)
+        {
+            std::vector<Subrange> result;
+            case_insensitive::find_all(str, cmp, result);
+            return result;
+        }
+
         Subrange find_first(std::string_view str,
                             std::string_view cmp,
                             size_t offset)
         {
-            auto it_cmp = cmp.begin();
-            char32_t ch_cmp;
-            if (!safe_decode_next(it_cmp, cmp.end(), ch_cmp))
-                return {};
-
-            auto it_str = str.begin() + offset;
-            auto it_str_next = it_str;
-            char32_t ch_str;
-            while (safe_decode_next(it_str_next, str.end(), ch_str))
-            {
-                if (case_insensitive_equal(ch_str, ch_cmp))
-                {
-                    auto [a, b] = next_case_insensitive_mismatch(
-                        it_str_next, str.end(), it_cmp, cmp.end());
-                    if (b == cmp.end())
-                        return {str.begin(), it_str, a};
-                }
-                it_str = it_str_next;
-            }
-            return {};
+            return CaseInsensitiveSearcher(cmp).find_first(str, offset);
         }
 
         std::pair<Subrange, char32_t>
@@ -593,7 +757,7 @@ namespace ystring
         }
 
         std::pair<Subrange, char32_t>
-        find_first_of(std::string_view str, CodepointSet chars, size_t offset)
+        find_first_of(std::string_view str, const CodepointSet& chars, size_t offset)
         {
             return find_first_where(
                 str,
@@ -605,28 +769,7 @@ namespace ystring
                            std::string_view cmp,
                            size_t offset)
         {
-            auto it_cmp = cmp.end();
-            char32_t ch_cmp;
-            if (!safe_decode_prev(cmp.begin(), it_cmp, ch_cmp))
-                return {};
-
-            offset = std::min(offset, str.size());
-
-            auto it_str = str.begin() + offset;
-            auto it_str_prev = it_str;
-            char32_t ch_str;
-            while (safe_decode_prev(str.begin(), it_str_prev, ch_str))
-            {
-                if (case_insensitive_equal(ch_str, ch_cmp))
-                {
-                    auto [a, b] = prev_case_insensitive_mismatch(
-                        str.begin(), it_str_prev, cmp.begin(), it_cmp);
-                    if (b == cmp.begin())
-                        return {str.begin(), a, it_str};
-                }
-                it_str = it_str_prev;
-            }
-            return {};
+            return CaseInsensitiveSearcher(cmp).find_last(str, offset);
         }
 
         std::pair<Subrange, char32_t>
@@ -641,7 +784,7 @@ namespace ystring
         }
 
         std::pair<Subrange, char32_t>
-        find_last_of(std::string_view str, CodepointSet chars, size_t offset)
+        find_last_of(std::string_view str, const CodepointSet& chars, size_t offset)
         {
             return find_last_where(
                 str,
@@ -649,10 +792,74 @@ namespace ystring
                 offset);
         }
 
+        size_t hash(std::string_view str)
+        {
+            // The folded string is hashed in blocks of BLOCK_SIZE bytes.
+            // The block boundaries depend only on the folded string, not on
+            // the lengths of the original code points, so strings that fold
+            // to the same code points get the same hash value.
+            constexpr size_t BLOCK_SIZE = 64;
+            char block[BLOCK_SIZE + 8];
+            size_t block_size = 0;
+            size_t folded_size = 0;
+            uint64_t h = 0x9E3779B97F4A7C15u;
+            auto hash_block = [&]
+            {
+                for (size_t i = 0; i < block_size; i += 8)
+                {
+                    auto word = load_word(block + i);
+                    h = std::rotl(h ^ word, 29) * 0xBF58476D1CE4E5B9u;
+                }
+            };
+            auto add_bytes = [&](size_t size)
+            {
+                block_size += size;
+                folded_size += size;
+                if (block_size < BLOCK_SIZE)
+                    return;
+                auto excess = block_size - BLOCK_SIZE;
+                block_size = BLOCK_SIZE;
+                hash_block();
+                std::memcpy(block, block + BLOCK_SIZE, excess);
+                block_size = excess;
+            };
+
+            auto it = str.begin();
+            while (it != str.end())
+            {
+                if (str.end() - it >= 8)
+                {
+                    auto word = load_word(&*it);
+                    if ((word & HIGH_BITS) == 0)
+                    {
+                        word = to_upper_ascii_word(word);
+                        std::memcpy(block + block_size, &word, 8);
+                        add_bytes(8);
+                        it += 8;
+                        continue;
+                    }
+                }
+
+                char32_t ch;
+                safe_decode_next(it, str.end(), ch);
+                add_bytes(encode_utf8(fold_for_search(ch), block + block_size,
+                                      sizeof(block) - block_size));
+            }
+
+            // Pad the last block with zeros and include the folded length
+            // to tell trailing NUL characters apart from the padding.
+            std::memset(block + block_size, 0, sizeof(block) - block_size);
+            hash_block();
+            h ^= folded_size;
+            h = (h ^ (h >> 31)) * 0x94D049BB133111EBu;
+            return size_t(h ^ (h >> 29));
+        }
+
         bool less(std::string_view str, std::string_view cmp)
         {
-            auto s_it = str.begin();
-            auto c_it = cmp.begin();
+            auto prefix = ptrdiff_t(get_ascii_case_insensitive_prefix(str, cmp));
+            auto s_it = str.begin() + prefix;
+            auto c_it = cmp.begin() + prefix;
             while (true)
             {
                 char32_t s_ch;
@@ -673,32 +880,35 @@ namespace ystring
                             ptrdiff_t max_replacements)
         {
             std::string result;
+            CaseInsensitiveSearcher searcher(from);
             if (max_replacements >= 0)
             {
-                while (max_replacements-- > 0)
+                size_t start = 0;
+                if (max_replacements != 0)
                 {
-                    auto match = find_first(str, from);
-                    if (!match)
-                        break;
-                    result.append(str.substr(0, match.start()));
-                    result.append(to);
-                    str = str.substr(match.end());
+                    searcher.find_all(str, [&](Subrange match)
+                    {
+                        result.append(str.substr(start, match.start() - start));
+                        result.append(to);
+                        start = match.end();
+                        return --max_replacements != 0;
+                    });
                 }
 
-                if (!str.empty())
-                    result.append(str);
+                if (start != str.size())
+                    result.append(str.substr(start));
             }
             else
             {
                 std::vector<Subrange> matches;
-                auto tmp_str = str;
+                auto end = str.size();
                 while (max_replacements++ < 0)
                 {
-                    auto match = find_last(tmp_str, from);
+                    auto match = searcher.find_last(str, end);
                     if (!match)
                         break;
                     matches.push_back(match);
-                    tmp_str = tmp_str.substr(0, match.start());
+                    end = match.start();
                 }
 
                 size_t start = 0;
@@ -727,16 +937,18 @@ namespace ystring
         std::vector<std::string_view>
         split(std::string_view str, std::string_view sep, SplitParams params)
         {
+            CaseInsensitiveSearcher searcher(sep);
             return split_where(
                 str,
-                [&](auto s) {return case_insensitive::find_first(s, sep);},
+                [&](auto s) {return searcher.find_first(s);},
                 params);
         }
 
         bool starts_with(std::string_view str, std::string_view cmp)
         {
+            auto prefix = ptrdiff_t(get_ascii_case_insensitive_prefix(str, cmp));
             auto [it_str, it_cmp] = next_case_insensitive_mismatch(
-                str.begin(), str.end(), cmp.begin(), cmp.end());
+                str.begin() + prefix, str.end(), cmp.begin() + prefix, cmp.end());
             return it_cmp == cmp.end();
         }
     }
@@ -0,0 +1,335 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "ByteSearch.hpp"
+
+#include <algorithm>
+#include "Ystring/CodepointConstants.hpp"
+#include "EncodeUtf8.hpp"
+
+namespace ystring
+{
+    namespace
+    {
+        /**
+         * @brief Returns a non-zero value if @a word might contain the
+         *  first byte of a newline.
+         *
+         * The control characters '\\n', '\\v', '\\f' and '\\r' are 0x0A to
+         * 0x0D. NEXT LINE starts with 0xC2, LINE SEPARATOR and PARAGRAPH
+         * SEPARATOR with 0xE2.
+         */
+        uint64_t get_newline_candidates(uint64_t word)
+        {
+            constexpr uint64_t MASK = LOW_BITS * 0xFE;
+            auto masked = word & MASK;
+            return get_matching_bytes(masked, 0x0A)
+                   | get_matching_bytes(masked, 0x0C)
+                   | get_matching_bytes(word, 0xC2)
+                   | get_matching_bytes(word, 0xE2);
+        }
+
+        /**
+         * @brief Returns the length of the newline starting at @a pos,
+         *  or 0 if there isn't one.
+         */
+        size_t get_newline_length(std::string_view str, size_t pos)
+        {
+            switch (uint8_t(str[pos]))
+            {
+            case 0x0A:
+            case 0x0B:
+            case 0x0C:
+                return 1;
+            case 0x0D:
+                return pos + 1 < str.size() && str[pos + 1] == '\n' ? 2 : 1;
+            case 0xC2:
+                return pos + 1 < str.size() && uint8_t(str[pos + 1]) == 0x85
+                       ? 2 : 0;
+            case 0xE2:
+                return pos + 2 < str.size()
+                       && uint8_t(str[pos + 1]) == 0x80
+                       && (uint8_t(str[pos + 2]) & 0xFEu) == 0xA8
+                       ? 3 : 0;
+            default:
+                return 0;
+            }
+        }
+    }
+
+    size_t get_common_prefix(std::string_view a, std::string_view b)
+    {
+        auto n = std::min(a.size(), b.size());
+        size_t i = 0;
+        while (i + 8 <= n && load_word(a.data() + i) == load_word(b.data() + i))
+            i += 8;
+        while (i < n && a[i] == b[i])
+            ++i;
+        return i;
+    }
+
+    size_t get_common_suffix(std::string_view a, std::string_view b)
+    {
+        auto n = std::min(a.size(), b.size());
+        auto end_a = a.data() + a.size();
+        auto end_b = b.data() + b.size();
+        size_t i = 0;
+        while (i + 8 <= n
+               && load_word(end_a - i - 8) == load_word(end_b - i - 8))
+        {
+            i += 8;
+        }
+        while (i < n && end_a[-ptrdiff_t(i) - 1] == end_b[-ptrdiff_t(i) - 1])
+            ++i;
+        return i;
+    }
+
+    size_t get_ascii_case_insensitive_prefix(std::string_view a,
+                                             std::string_view b)
+    {
+        auto n = std::min(a.size(), b.size());
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            auto word_a = load_word(a.data() + i);
+            auto word_b = load_word(b.data() + i);
+            if ((word_a | word_b) & HIGH_BITS)
+                break;
+            if (word_a != word_b
+                && to_upper_ascii_word(word_a) != to_upper_ascii_word(word_b))
+            {
+                break;
+            }
+        }
+        return i;
+    }
+
+    size_t get_ascii_case_insensitive_suffix(std::string_view a,
+                                             std::string_view b)
+    {
+        auto n = std::min(a.size(), b.size());
+        auto end_a = a.data() + a.size();
+        auto end_b = b.data() + b.size();
+        size_t i = 0;
+        for (; i + 8 <= n; i += 8)
+        {
+            auto word_a = load_word(end_a - i - 8);
+            auto word_b = load_word(end_b - i - 8);
+            if ((word_a | word_b) & HIGH_BITS)
+                break;
+            if (word_a != word_b
+                && to_upper_ascii_word(word_a) != to_upper_ascii_word(word_b))
+            {
+                break;
+            }
+        }
+        return i;
+    }
+
+    bool is_ascii(std::string_view str)
+    {
+        auto data = str.data();
+        size_t i = 0;
+        uint64_t bits = 0;
+        for (; i + 8 <= str.size(); i += 8)
+            bits |= load_word(data + i);
+        for (; i < str.size(); ++i)
+            bits |= uint8_t(data[i]);
+        return (bits & HIGH_BITS) == 0;
+    }
+
+    Subrange find_first_newline_bytes(std::string_view str, size_t offset)
+    {
+        auto data = str.data();
+        // Two words per iteration keeps the number of branches down for
+        // long lines.
+        while (offset + 16 <= str.size())
+        {
+            auto candidates = get_newline_candidates(load_word(data + offset))
+                | get_newline_candidates(load_word(data + offset + 8));
+            if (candidates)
+            {
+                for (size_t i = 0; i < 16; ++i)
+                {
+                    if (auto n = get_newline_length(str, offset + i))
+                        return {offset + i, n};
+                }
+            }
+            offset += 16;
+        }
+
+        for (; offset < str.size(); ++offset)
+        {
+            if (auto n = get_newline_length(str, offset))
+                return {offset, n};
+        }
+        return Subrange(std::string_view::npos);
+    }
+
+    EncodedCodepointFinder::EncodedCodepointFinder(std::u32string_view chars)
+    {
+        for (auto ch : chars.substr(0, MAX_CODEPOINTS))
+        {
+            auto& needle = m_needles[m_needle_count];
+            needle.size = encode_utf8(ch, needle.bytes, sizeof(needle.bytes));
+            if (needle.size == 0)
+                continue;
+            needle.codepoint = ch;
+            ++m_needle_count;
+
+            auto lead = uint8_t(needle.bytes[0]);
+            if (!is_lead_byte(char(lead)))
+            {
+                m_lead_bytes[m_lead_byte_count++] = lead;
+                m_lead_byte_map[lead >> 6u] |= uint64_t(1) << (lead & 63u);
+            }
+        }
+    }
+
+    std::pair<Subrange, char32_t>
+    EncodedCodepointFinder::find_first(std::string_view str,
+                                       size_t offset) const
+    {
+        if (m_lead_byte_count == 1)
+        {
+            auto lead = char(m_lead_bytes[0]);
+            while (offset < str.size())
+            {
+                auto p = static_cast<const char*>(
+                    std::memchr(str.data() + offset, lead, str.size() - offset));
+                if (!p)
+                    break;
+                offset = size_t(p - str.data());
+                if (auto needle = match_at(str, offset))
+                    return make_result(needle, offset);
+                ++offset;
+            }
+            return {Subrange(std::string_view::npos), INVALID_CHAR};
+        }
+
+        auto data = str.data();
+        for (; offset + 8 <= str.size(); offset += 8)
+        {
+            auto word = load_word(data + offset);
+            uint64_t matches = 0;
+            for (size_t i = 0; i < m_lead_byte_count; ++i)
+                matches |= get_matching_bytes(word, m_lead_bytes[i]);
+            if (!matches)
+                continue;
+            for (size_t i = 0; i < 8; ++i)
+            {
+                if (!is_lead_byte(data[offset + i]))
+                    continue;
+                if (auto needle = match_at(str, offset + i))
+                    return make_result(needle, offset + i);
+            }
+        }
+
+        for (; offset < str.size(); ++offset)
+        {
+            if (!is_lead_byte(data[offset]))
+                continue;
+            if (auto needle = match_at(str, offset))
+                return make_result(needle, offset);
+        }
+        return {Subrange(std::string_view::npos), INVALID_CHAR};
+    }
+
+    std::pair<Subrange, char32_t>
+    EncodedCodepointFinder::find_last(std::string_view str,
+                                      size_t offset) const
+    {
+        str = str.substr(0, std::min(offset, str.size()));
+        auto data = str.data();
+        auto pos = str.size();
+        for (; pos >= 8; pos -= 8)
+        {
+            auto word = load_word(data + pos - 8);
+            uint64_t matches = 0;
+            for (size_t i = 0; i < m_lead_byte_count; ++i)
+                matches |= get_matching_bytes(word, m_lead_bytes[i]);
+            if (!matches)
+                continue;
+            for (size_t i = 1; i <= 8; ++i)
+            {
+                if (!is_lead_byte(data[pos - i]))
+                    continue;
+                if (auto needle = match_at(str, pos - i))
+                    return make_result(needle, pos - i);
+            }
+        }
+
+        while (pos-- > 0)
+        {
+            if (!is_lead_byte(data[pos]))
+                continue;
+            if (auto needle = match_at(str, pos))
+                return make_result(needle, pos);
+        }
+        return {Subrange(std::string_view::npos), INVALID_CHAR};
+    }
+
+    std::string_view
+    EncodedCodepointFinder::trim_end(std::string_view str) const
+    {
+        auto end = str.size();
+        while (auto needle = match_before(str, end))
+            end -= needle->size;
+        return str.substr(0, end);
+    }
+
+    std::string_view
+    EncodedCodepointFinder::trim_start(std::string_view str) const
+    {
+        size_t start = 0;
+        while (auto needle = match_at(str, start))
+            start += needle->size;
+        return str.substr(start);
+    }
+
+    const EncodedCodepointFinder::Needle*
+    EncodedCodepointFinder::match_at(std::string_view str, size_t pos) const
+    {
+        if (pos >= str.size())
+            return nullptr;
+        for (size_t i = 0; i < m_needle_count; ++i)
+        {
+            auto& needle = m_needles[i];
+            if (needle.bytes[0] == str[pos]
+                && needle.size <= str.size() - pos
+                && std::memcmp(needle.bytes, str.data() + pos, needle.size) == 0)
+            {
+                return &needle;
+            }
+        }
+        return nullptr;
+    }
+
+    const EncodedCodepointFinder::Needle*
+    EncodedCodepointFinder::match_before(std::string_view str,
+                                         size_t pos) const
+    {
+        for (size_t i = 0; i < m_needle_count; ++i)
+        {
+            auto& needle = m_needles[i];
+            if (needle.size <= pos
+                && std::memcmp(needle.bytes, str.data() + pos - needle.size,
+                               needle.size) == 0)
+            {
+                return &needle;
+            }
+        }
+        return nullptr;
+    }
+
+    std::pair<Subrange, char32_t>
+    EncodedCodepointFinder::make_result(const Needle* needle,
+                                        size_t pos) const
+    {
+        return {{pos, needle->size}, needle->codepoint};
+    }
+}
@@ -0,0 +1,242 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "Ystring/Subrange.hpp"
+
+/** @file
+  * @brief Functions and classes that search UTF-8 strings byte by byte,
+  *     eight bytes at a time where possible, without decoding them.
+  */
+
+namespace ystring
+{
+    constexpr uint64_t LOW_BITS = 0x0101010101010101ull;
+    constexpr uint64_t HIGH_BITS = 0x8080808080808080ull;
+
+    [[nodiscard]]
+    inline uint64_t load_word(const char* p)
+    {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        return word;
+    }
+
+    /**
+     * @brief Returns a non-zero value if at least one of the bytes in
+     *  @a word is zero.
+     *
+     * Only the highest bit in each byte can be set in the result. The
+     * lowest zero byte is always flagged correctly, but bytes above it may
+     * be flagged even if they aren't zero.
+     */
+    [[nodiscard]]
+    constexpr uint64_t get_zero_bytes(uint64_t word)
+    {
+        return (word - LOW_BITS) & ~word & HIGH_BITS;
+    }
+
+    /**
+     * @brief Returns a non-zero value if at least one of the bytes in
+     *  @a word equals @a byte.
+     */
+    [[nodiscard]]
+    constexpr uint64_t get_matching_bytes(uint64_t word, uint8_t byte)
+    {
+        return get_zero_bytes(word ^ (LOW_BITS * byte));
+    }
+
+    /**
+     * @brief Returns a word where the highest bit is set in each byte
+     *  where @a word has one of the letters a-z.
+     *
+     * All the bytes in @a word must be ASCII, i.e. less than 0x80.
+     */
+    [[nodiscard]]
+    constexpr uint64_t get_lower_ascii_letters(uint64_t word)
+    {
+        auto at_least_a = word + LOW_BITS * (0x80 - 'a');
+        auto above_z = word + LOW_BITS * (0x80 - 'z' - 1);
+        return at_least_a & ~above_z & HIGH_BITS;
+    }
+
+    /**
+     * @brief Returns a word where the highest bit is set in each byte
+     *  where @a word has one of the letters A-Z.
+     *
+     * All the bytes in @a word must be ASCII, i.e. less than 0x80.
+     */
+    [[nodiscard]]
+    constexpr uint64_t get_upper_ascii_letters(uint64_t word)
+    {
+        auto at_least_a = word + LOW_BITS * (0x80 - 'A');
+        auto above_z = word + LOW_BITS * (0x80 - 'Z' - 1);
+        return at_least_a & ~above_z & HIGH_BITS;
+    }
+
+    /**
+     * @brief Returns @a word with the letters a-z replaced by A-Z.
+     *
+     * All the bytes in @a word must be ASCII, i.e. less than 0x80.
+     */
+    [[nodiscard]]
+    constexpr uint64_t to_upper_ascii_word(uint64_t word)
+    {
+        return word ^ (get_lower_ascii_letters(word) >> 2u);
+    }
+
+    /**
+     * @brief Returns @a word with the letters A-Z replaced by a-z.
+     *
+     * All the bytes in @a word must be ASCII, i.e. less than 0x80.
+     */
+    [[nodiscard]]
+    constexpr uint64_t to_lower_ascii_word(uint64_t word)
+    {
+        return word ^ (get_upper_ascii_letters(word) >> 2u);
+    }
+
+    /**
+     * @brief Returns the length of the longest common prefix of @a a
+     *  and @a b.
+     *
+     * The strings are compared eight bytes at a time.
+     */
+    [[nodiscard]]
+    size_t get_common_prefix(std::string_view a, std::string_view b);
+
+    /**
+     * @brief Returns the length of the longest common suffix of @a a
+     *  and @a b.
+     *
+     * The strings are compared eight bytes at a time.
+     */
+    [[nodiscard]]
+    size_t get_common_suffix(std::string_view a, std::string_view b);
+
+    /**
+     * @brief Returns the length of the longest prefix of @a a and @a b
+     *  that is ASCII and equal in both strings when letter case is ignored.
+     *
+     * The strings are compared eight bytes at a time, and the result is
+     * a multiple of eight. The remaining bytes must be compared by the
+     * caller.
+     */
+    [[nodiscard]]
+    size_t get_ascii_case_insensitive_prefix(std::string_view a,
+                                             std::string_view b);
+
+    /**
+     * @brief Returns the length of the longest suffix of @a a and @a b
+     *  that is ASCII and equal in both strings when letter case is ignored.
+     *
+     * The strings are compared eight bytes at a time, and the result is
+     * a multiple of eight.
+     */
+    [[nodiscard]]
+    size_t get_ascii_case_insensitive_suffix(std::string_view a,
+                                             std::string_view b);
+
+    /**
+     * @brief Returns true if all the bytes in @a str are ASCII.
+     */
+    [[nodiscard]]
+    bool is_ascii(std::string_view str);
+
+    /**
+     * @brief Returns the first newline in @a str at or after @a offset.
+     *
+     * Recognizes the same newlines as find_first_newline, i.e. "\\r\\n",
+     * '\\n', '\\v', '\\f', '\\r', NEXT LINE, LINE SEPARATOR and PARAGRAPH
+     * SEPARATOR, but searches the bytes directly instead of decoding the
+     * string.
+     */
+    [[nodiscard]]
+    Subrange find_first_newline_bytes(std::string_view str, size_t offset);
+
+    /**
+     * @brief Searches for a small number of code points by comparing
+     *  their UTF-8 encodings with the bytes in a string.
+     *
+     * In a valid UTF-8 string, the encoding of a code point can only
+     * occur at the start of a code point, so there is no need to decode
+     * the string. Invalid UTF-8 is not detected.
+     */
+    class EncodedCodepointFinder
+    {
+    public:
+        static constexpr size_t MAX_CODEPOINTS = 8;
+
+        /**
+         * @brief Returns true if @a chars is small enough to be searched
+         *  for with EncodedCodepointFinder.
+         */
+        [[nodiscard]]
+        static bool is_suitable(std::u32string_view chars)
+        {
+            return chars.size() <= MAX_CODEPOINTS;
+        }
+
+        /**
+         * @brief Prepares a search for the code points in @a chars.
+         *
+         * Code points after the first MAX_CODEPOINTS are ignored, as are
+         * code points that can't be encoded as UTF-8.
+         */
+        explicit EncodedCodepointFinder(std::u32string_view chars);
+
+        [[nodiscard]]
+        std::pair<Subrange, char32_t>
+        find_first(std::string_view str, size_t offset = 0) const;
+
+        [[nodiscard]]
+        std::pair<Subrange, char32_t>
+        find_last(std::string_view str,
+                  size_t offset = std::string_view::npos) const;
+
+        [[nodiscard]]
+        std::string_view trim_end(std::string_view str) const;
+
+        [[nodiscard]]
+        std::string_view trim_start(std::string_view str) const;
+    private:
+        struct Needle
+        {
+            char bytes[4];
+            size_t size;
+            char32_t codepoint;
+        };
+
+        [[nodiscard]]
+        bool is_lead_byte(char c) const
+        {
+            auto b = uint8_t(c);
+            return (m_lead_byte_map[b >> 6u] >> (b & 63u)) & 1u;
+        }
+
+        [[nodiscard]]
+        const Needle* match_at(std::string_view str, size_t pos) const;
+
+        [[nodiscard]]
+        const Needle* match_before(std::string_view str, size_t pos) const;
+
+        [[nodiscard]]
+        std::pair<Subrange, char32_t> make_result(const Needle* needle,
+                                                  size_t pos) const;
+
+        std::array<Needle, MAX_CODEPOINTS> m_needles = {};
+        size_t m_needle_count = 0;
+        std::array<uint8_t, MAX_CODEPOINTS> m_lead_bytes = {};
+        size_t m_lead_byte_count = 0;
+        uint64_t m_lead_byte_map[4] = {};
+    };
+}
@@ -0,0 +1,196 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "CaseInsensitiveSearch.hpp"
+
+#include <algorithm>
+
+namespace ystring
+{
+    namespace
+    {
+        char32_t next_folded(std::string_view str, size_t& pos)
+        {
+            auto byte = uint8_t(str[pos]);
+            if (byte < 0x80)
+            {
+                ++pos;
+                return fold_for_search(byte);
+            }
+
+            auto it = str.begin() + ptrdiff_t(pos);
+            char32_t ch;
+            safe_decode_next(it, str.end(), ch);
+            pos = size_t(it - str.begin());
+            return fold_for_search(ch);
+        }
+
+        char32_t prev_folded(std::string_view str, size_t& pos)
+        {
+            auto byte = uint8_t(str[pos - 1]);
+            if (byte < 0x80)
+            {
+                --pos;
+                return fold_for_search(byte);
+            }
+
+            auto it = str.begin() + ptrdiff_t(pos);
+            char32_t ch;
+            safe_decode_prev(str.begin(), it, ch);
+            pos = size_t(it - str.begin());
+            return fold_for_search(ch);
+        }
+
+        /**
+         * @brief Returns the Knuth-Morris-Pratt failure function for
+         *  @a pattern.
+         *
+         * Element i is the length of the longest proper prefix of
+         * pattern[0..i] that is also a suffix of it. @a get returns the
+         * pattern's i'th code point, which makes it possible to use the
+         * same function for the pattern and its reverse.
+         */
+        template <typename GetFunc>
+        std::vector<size_t> make_skips(size_t size, GetFunc get)
+        {
+            std::vector<size_t> skips(size, 0);
+            size_t j = 0;
+            for (size_t i = 1; i < size; ++i)
+            {
+                while (j != 0 && get(i) != get(j))
+                    j = skips[j - 1];
+                if (get(i) == get(j))
+                    ++j;
+                skips[i] = j;
+            }
+            return skips;
+        }
+
+        /**
+         * @brief Advances @a pos past ASCII characters that don't fold
+         *  to @a ch.
+         */
+        void skip_ascii_mismatches(std::string_view str, size_t& pos,
+                                   char32_t ch)
+        {
+            while (pos < str.size())
+            {
+                auto byte = uint8_t(str[pos]);
+                if (byte >= 0x80 || fold_for_search(byte) == ch)
+                    break;
+                ++pos;
+            }
+        }
+
+        void skip_ascii_mismatches_backward(std::string_view str, size_t& pos,
+                                            char32_t ch)
+        {
+            while (pos > 0)
+            {
+                auto byte = uint8_t(str[pos - 1]);
+                if (byte >= 0x80 || fold_for_search(byte) == ch)
+                    break;
+                --pos;
+            }
+        }
+    }
+
+    CaseInsensitiveSearcher::CaseInsensitiveSearcher(std::string_view pattern)
+    {
+        auto it = pattern.begin();
+        char32_t ch;
+        while (safe_decode_next(it, pattern.end(), ch))
+            m_pattern.push_back(fold_for_search(ch));
+
+        auto n = m_pattern.size();
+        m_forward_skips = make_skips(
+            n, [&](size_t i) {return m_pattern[i];});
+        m_backward_skips = make_skips(
+            n, [&](size_t i) {return m_pattern[n - 1 - i];});
+    }
+
+    Subrange CaseInsensitiveSearcher::find_first(std::string_view str,
+                                                 size_t offset) const
+    {
+        auto end = find_first_end(str, offset);
+        if (end == std::string_view::npos)
+            return {};
+
+        auto it = str.begin() + ptrdiff_t(end);
+        for (size_t i = 0; i < m_pattern.size(); ++i)
+            skip_prev(str.begin(), it);
+        auto start = size_t(it - str.begin());
+        return {start, end - start};
+    }
+
+    Subrange CaseInsensitiveSearcher::find_last(std::string_view str,
+                                                size_t offset) const
+    {
+        auto start = find_last_start(str, offset);
+        if (start == std::string_view::npos)
+            return {};
+
+        auto it = str.begin() + ptrdiff_t(start);
+        for (size_t i = 0; i < m_pattern.size(); ++i)
+            skip_next(it, str.end());
+        return {start, size_t(it - str.begin()) - start};
+    }
+
+    size_t CaseInsensitiveSearcher::find_first_end(std::string_view str,
+                                                   size_t offset) const
+    {
+        auto n = m_pattern.size();
+        if (n == 0)
+            return std::string_view::npos;
+
+        auto pos = offset;
+        size_t j = 0;
+        while (pos < str.size())
+        {
+            if (j == 0)
+            {
+                skip_ascii_mismatches(str, pos, m_pattern[0]);
+                if (pos == str.size())
+                    break;
+            }
+
+            auto ch = next_folded(str, pos);
+            while (j != 0 && ch != m_pattern[j])
+                j = m_forward_skips[j - 1];
+            if (ch == m_pattern[j] && ++j == n)
+                return pos;
+        }
+        return std::string_view::npos;
+    }
+
+    size_t CaseInsensitiveSearcher::find_last_start(std::string_view str,
+                                                    size_t offset) const
+    {
+        auto n = m_pattern.size();
+        if (n == 0)
+            return std::string_view::npos;
+
+        auto pos = std::min(offset, str.size());
+        size_t j = 0;
+        while (pos > 0)
+        {
+            if (j == 0)
+            {
+                skip_ascii_mismatches_backward(str, pos, m_pattern[n - 1]);
+                if (pos == 0)
+                    break;
+            }
+
+            auto ch = prev_folded(str, pos);
+            while (j != 0 && ch != m_pattern[n - 1 - j])
+                j = m_backward_skips[j - 1];
+            if (ch == m_pattern[n - 1 - j] && ++j == n)
+                return pos;
+        }
+        return std::string_view::npos;
+    }
+}
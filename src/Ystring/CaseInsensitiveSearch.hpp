@@ -0,0 +1,116 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Ystring/ConvertCase.hpp"
+#include "Ystring/DecodeUtf8.hpp"
+#include "Ystring/Subrange.hpp"
+
+/** @file
+  * @brief Defines CaseInsensitiveSearcher, a linear-time case-insensitive
+  *     substring search.
+  */
+
+namespace ystring
+{
+    /**
+     * @brief Returns the value that is used to compare @a c with other
+     *  code points when letter case is ignored.
+     */
+    [[nodiscard]]
+    inline char32_t fold_for_search(char32_t c)
+    {
+        if (c < 0x80)
+            return c - 'a' < 26u ? c - 32 : c;
+        return to_upper(c);
+    }
+
+    /**
+     * @brief Searches for a string in other strings, ignoring any
+     *  differences in letter case.
+     *
+     * The pattern is folded once when the searcher is created, the strings
+     * that are searched are folded one code point at a time as the search
+     * proceeds. The search is a Knuth-Morris-Pratt search over the folded
+     * code points: the skip tables tell how much of the pattern still
+     * matches after a mismatch, so no code point is read more than once
+     * and the running time is linear regardless of the input.
+     */
+    class CaseInsensitiveSearcher
+    {
+    public:
+        explicit CaseInsensitiveSearcher(std::string_view pattern);
+
+        [[nodiscard]]
+        bool empty() const
+        {
+            return m_pattern.empty();
+        }
+
+        /**
+         * @brief Returns the first match in @a str that starts at or
+         *  after @a offset.
+         *
+         * Returns an empty Subrange if there is no match.
+         * @throw YstringException if @a str contains invalid UTF-8.
+         */
+        [[nodiscard]]
+        Subrange find_first(std::string_view str, size_t offset = 0) const;
+
+        /**
+         * @brief Returns the last match in @a str that ends at or
+         *  before @a offset.
+         *
+         * Returns an empty Subrange if there is no match.
+         * @throw YstringException if @a str contains invalid UTF-8.
+         */
+        [[nodiscard]]
+        Subrange find_last(std::string_view str,
+                           size_t offset = std::string_view::npos) const;
+
+        /**
+         * @brief Calls @a callback with every non-overlapping match in
+         *  @a str, from left to right.
+         *
+         * The search stops if @a callback returns false.
+         */
+        template <typename Callback>
+        void find_all(std::string_view str, Callback callback) const
+        {
+            size_t offset = 0;
+            while (true)
+            {
+                auto match = find_first(str, offset);
+                if (!match || !callback(match))
+                    break;
+                offset = match.end();
+            }
+        }
+    private:
+        /**
+         * @brief Returns the position after the last code point in the
+         *  first match, or npos.
+         */
+        [[nodiscard]]
+        size_t find_first_end(std::string_view str, size_t offset) const;
+
+        /**
+         * @brief Returns the position of the first code point in the
+         *  last match, or npos.
+         */
+        [[nodiscard]]
+        size_t find_last_start(std::string_view str, size_t offset) const;
+
+        std::u32string m_pattern;
+        std::vector<size_t> m_forward_skips;
+        std::vector<size_t> m_backward_skips;
+    };
+}
@@ -10,17 +10,98 @@
 
 #include <ostream>
 #include <Ystring/Algorithms.hpp>
+#include "Ystring/CodepointConstants.hpp"
+#include "Ystring/StaticCodepointSet.hpp"
 
 namespace ystring
 {
+    namespace
+    {
+        /**
+         * @brief Returns the ranges of @a set with the negation resolved.
+         */
+        std::vector<CodepointRange> get_positive_ranges(const CodepointSet& set)
+        {
+            if (!set.negated)
+                return set.ranges;
+
+            std::vector<CodepointRange> result;
+            char32_t next = 0;
+            for (auto [first, last] : set.ranges)
+            {
+                if (first > UNICODE_MAX)
+                    break;
+                if (first > next)
+                    result.emplace_back(next, first - 1);
+                if (last >= UNICODE_MAX)
+                    return result;
+                next = last + 1;
+            }
+            result.emplace_back(next, UNICODE_MAX);
+            return result;
+        }
+
+        /**
+         * @brief Returns true if @a cp is in one of the sorted @a ranges,
+         *  disregarding whether the set is negated.
+         */
+        bool ranges_contain(const std::vector<CodepointRange>& ranges,
+                            char32_t cp)
+        {
+            auto it = std::upper_bound(
+                ranges.begin(), ranges.end(), cp,
+                [](char32_t c, const CodepointRange& r) {return c < r.first;});
+            return it != ranges.begin() && cp <= std::prev(it)->second;
+        }
+
+        void write_set_codepoint(std::ostream& os, char32_t ch)
+        {
+            switch (ch)
+            {
+            case '-':
+            case '\\':
+            case ']':
+            case '^':
+                os << '\\' << char(ch);
+                break;
+            default:
+                os << from_utf32(ch);
+                break;
+            }
+        }
+    }
+
     void CodepointSet::add_range(char32_t first, char32_t last)
     {
-        ranges.emplace_back(first, last);
+        if (first > last)
+            return;
+
+        // Find the first range that overlaps or is adjacent to the new one.
+        auto it = std::lower_bound(
+            ranges.begin(), ranges.end(), first,
+            [](const CodepointRange& r, char32_t c)
+            {return uint64_t(r.second) + 1 < c;});
+
+        auto end = it;
+        while (end != ranges.end() && end->first <= uint64_t(last) + 1)
+            ++end;
+
+        if (it == end)
+        {
+            ranges.insert(it, {first, last});
+            return;
+        }
+
+        it->first = std::min(it->first, first);
+        it->second = std::max(std::prev(end)->second, last);
+        ranges.erase(std::next(it), end);
     }
 
     void CodepointSet::add_codepoint(char32_t cp)
     {
-        if (!ranges.empty() && ranges.back().second + 1 == cp)
+        if (ranges.empty() || uint64_t(ranges.back().second) + 1 < cp)
+            ranges.emplace_back(cp, cp);
+        else if (ranges.back().second + 1 == cp)
             ranges.back().second = cp;
         else
             add_range(cp, cp);
@@ -28,27 +109,59 @@ namespace ystring
 
     void CodepointSet::add_codepoints(std::u32string_view codepoints)
     {
+        ranges.reserve(ranges.size() + codepoints.size());
         for (char32_t ch : codepoints)
-            add_codepoint(ch);
+            ranges.emplace_back(ch, ch);
+        canonicalize();
+    }
+
+    void CodepointSet::canonicalize()
+    {
+        std::sort(ranges.begin(), ranges.end());
+
+        auto out = ranges.begin();
+        for (auto it = ranges.begin(); it != ranges.end(); ++it)
+        {
+            if (it->first > it->second)
+                continue;
+            if (out != ranges.begin()
+                && it->first <= uint64_t(std::prev(out)->second) + 1)
+            {
+                auto& prev = *std::prev(out);
+                prev.second = std::max(prev.second, it->second);
+            }
+            else
+            {
+                *out++ = *it;
+            }
+        }
+        ranges.erase(out, ranges.end());
     }
 
     bool CodepointSet::contains(char32_t cp) const
     {
-        return std::any_of(ranges.begin(), ranges.end(),
-                           [&](auto& r) {return r.first <= cp && cp <= r.second;})
-               != negated;
+        return ranges_contain(ranges, cp) != negated;
     }
 
     bool CodepointSet::case_insensitive_contains(char32_t cp) const
     {
-        return std::any_of(ranges.begin(), ranges.end(),
-                           [&](auto& r)
-                           {
-                               if (r.first == r.second)
-                                   return case_insensitive_equal(cp, r.first);
-                               return !case_insensitive_less(cp, r.first)
-                                      && !case_insensitive_less(r.second, cp);
-                           }) != negated;
+        // The negation applies to the set of case variants as a whole,
+        // [^a] must not contain 'A' just because 'A' isn't 'a'.
+        auto found = [&]
+        {
+            if (ranges_contain(ranges, cp))
+                return true;
+            auto upper = to_upper(cp);
+            if (upper != cp && ranges_contain(ranges, upper))
+                return true;
+            auto lower = to_lower(cp);
+            if (lower != cp && ranges_contain(ranges, lower))
+                return true;
+            auto title = to_title(cp);
+            return title != cp && title != upper
+                   && ranges_contain(ranges, title);
+        }();
+        return found != negated;
     }
 
     std::ostream& operator<<(std::ostream& os, const CodepointSet& set)
@@ -56,14 +169,71 @@ namespace ystring
         os << (set.negated ? "[^" : "[");
         for (auto& r : set.ranges)
         {
-            if (r.first == r.second)
-                os << from_utf32(r.first);
-            else
-                os << from_utf32(r.first) << '-' << from_utf32(r.second);
+            write_set_codepoint(os, r.first);
+            if (r.first != r.second)
+            {
+                os << '-';
+                write_set_codepoint(os, r.second);
+            }
         }
         return os << ']';
     }
 
+    CodepointSet parse_codepoint_set(std::string_view str)
+    {
+        CodepointSet result;
+        auto error = detail::parse_codepoint_set(
+            str, result.negated,
+            [&](char32_t first, char32_t last)
+            {result.ranges.emplace_back(first, last);});
+        if (error)
+            YSTRING_THROW("Invalid codepoint set: " + std::string(error));
+        result.canonicalize();
+        return result;
+    }
+
+    CodepointSet complement(const CodepointSet& set)
+    {
+        CodepointSet tmp{set.ranges, !set.negated};
+        return {get_positive_ranges(tmp)};
+    }
+
+    CodepointSet set_difference(const CodepointSet& a, const CodepointSet& b)
+    {
+        return set_intersection(a, complement(b));
+    }
+
+    CodepointSet set_intersection(const CodepointSet& a, const CodepointSet& b)
+    {
+        auto a_ranges = get_positive_ranges(a);
+        auto b_ranges = get_positive_ranges(b);
+        CodepointSet result;
+        auto a_it = a_ranges.begin();
+        auto b_it = b_ranges.begin();
+        while (a_it != a_ranges.end() && b_it != b_ranges.end())
+        {
+            auto first = std::max(a_it->first, b_it->first);
+            auto last = std::min(a_it->second, b_it->second);
+            if (first <= last)
+                result.ranges.emplace_back(first, last);
+            if (a_it->second < b_it->second)
+                ++a_it;
+            else
+                ++b_it;
+        }
+        return result;
+    }
+
+    CodepointSet set_union(const CodepointSet& a, const CodepointSet& b)
+    {
+        CodepointSet result{get_positive_ranges(a)};
+        auto b_ranges = get_positive_ranges(b);
+        result.ranges.insert(result.ranges.end(),
+                             b_ranges.begin(), b_ranges.end());
+        result.canonicalize();
+        return result;
+    }
+
     bool contains(std::u32string_view span, char32_t cp)
     {
         return std::find(span.begin(), span.end(), cp) != span.end();
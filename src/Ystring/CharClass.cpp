@@ -8,9 +8,19 @@
 #include "Ystring/CharClass.hpp"
 
 #include <algorithm>
-#include <iterator>
+#include <array>
+#include <bit>
+#include "Ystring/CodepointConstants.hpp"
+#include "Ystring/CodepointSet.hpp"
+#include "Ystring/DecodeUtf8.hpp"
+#include "Ystring/YstringException.hpp"
+#include "ByteSearch.hpp"
 #include "CharClassTables.hpp"
+#include "CodepointPropertiesTables.hpp"
 
+// get_char_class reads the character class in CODEPOINT_PROPERTY_TABLE,
+// while make_codepoint_set uses the ranges in COMPLETE_CHAR_CLASSES.
+//
 // What are the values in the COMPLETE_CHAR_CLASSES table?
 //
 // They are actually a bit field struct:
@@ -56,19 +66,184 @@ namespace ystring
                 return lower_char_class - 1;
             return upper_char_class - 1;
         }
+
+        constexpr auto ASCII_CHAR_CLASS_VALUES = []
+        {
+            std::array<CharClass_t, 128> values = {};
+            for (size_t i = 0; i < values.size(); ++i)
+                values[i] = CharClass_t(1u << ASCII_CHAR_CLASSES[i]);
+            return values;
+        }();
+
+        /**
+         * @brief Calls @a callback with the offset, length and character
+         *  class of each code point in @a str.
+         *
+         * Eight bytes are checked at a time for non-ASCII characters, and
+         * the ASCII ones are looked up directly without decoding.
+         */
+        template <typename Callback>
+        void for_each_char_class(std::string_view str, Callback callback)
+        {
+            const auto* data = str.data();
+            size_t pos = 0;
+            while (pos < str.size())
+            {
+                if (pos + 8 <= str.size()
+                    && (load_word(data + pos) & HIGH_BITS) == 0)
+                {
+                    for (auto end = pos + 8; pos != end; ++pos)
+                    {
+                        auto c = uint8_t(data[pos]);
+                        callback(pos, 1, ASCII_CHAR_CLASS_VALUES[c]);
+                    }
+                    continue;
+                }
+
+                auto c = uint8_t(data[pos]);
+                if (c < 0x80)
+                {
+                    callback(pos, 1, ASCII_CHAR_CLASS_VALUES[c]);
+                    ++pos;
+                    continue;
+                }
+
+                // Decode two- and three-byte sequences here, they are
+                // the vast majority of non-ASCII code points.
+                if ((c & 0xE0u) == 0xC0 && pos + 1 < str.size()
+                    && (uint8_t(data[pos + 1]) & 0xC0u) == 0x80)
+                {
+                    auto ch = char32_t(((c & 0x1Fu) << 6u)
+                                       | (uint8_t(data[pos + 1]) & 0x3Fu));
+                    callback(pos, 2, get_char_class(ch));
+                    pos += 2;
+                    continue;
+                }
+
+                if ((c & 0xF0u) == 0xE0 && pos + 2 < str.size()
+                    && (uint8_t(data[pos + 1]) & 0xC0u) == 0x80
+                    && (uint8_t(data[pos + 2]) & 0xC0u) == 0x80)
+                {
+                    auto ch = char32_t(((c & 0x0Fu) << 12u)
+                                       | ((uint8_t(data[pos + 1]) & 0x3Fu) << 6u)
+                                       | (uint8_t(data[pos + 2]) & 0x3Fu));
+                    callback(pos, 3, get_char_class(ch));
+                    pos += 3;
+                    continue;
+                }
+
+                auto it = str.begin() + ptrdiff_t(pos);
+                char32_t ch;
+                safe_decode_next(it, str.end(), ch);
+                auto next = size_t(it - str.begin());
+                callback(pos, next - pos, get_char_class(ch));
+                pos = next;
+            }
+        }
     }
 
     CharClass_t get_char_class(char32_t code_point)
     {
         if (code_point < 128)
-            return CharClass_t(1u << ASCII_CHAR_CLASSES[code_point]);
-        char32_t key = code_point << CODE_POINT_SHIFT;
-        auto it = std::lower_bound(
-            std::begin(COMPLETE_CHAR_CLASSES),
-            std::end(COMPLETE_CHAR_CLASSES),
-            key);
-        if (it == std::end(COMPLETE_CHAR_CLASSES))
-            return CharClass::UNASSIGNED;
-        return CharClass_t(1u << decode_char_class(code_point, *it));
+            return ASCII_CHAR_CLASS_VALUES[code_point];
+        return CODEPOINT_PROPERTY_TABLE.get(code_point).get_char_class();
+    }
+
+    void get_char_classes(std::string_view str, std::span<CharClass_t> classes)
+    {
+        if (classes.size() < str.size())
+            YSTRING_THROW("The buffer for the character classes is too small.");
+        for_each_char_class(str, [&](size_t pos, size_t length, CharClass_t cls)
+        {
+            classes[pos] = cls;
+            for (size_t i = 1; i < length; ++i)
+                classes[pos + i] = CharClass_t(0);
+        });
+    }
+
+    std::vector<CharClass_t> get_char_classes(std::string_view str)
+    {
+        std::vector<CharClass_t> result(str.size());
+        get_char_classes(str, result);
+        return result;
+    }
+
+    size_t get_char_class_runs(std::string_view str,
+                               std::vector<CharClassRun>& runs,
+                               std::span<const uint32_t> groups)
+    {
+        // The value of each character class in the runs.
+        std::array<uint32_t, 32> run_values = {};
+        for (unsigned i = 0; i < run_values.size(); ++i)
+        {
+            auto cls = 1u << i;
+            auto it = std::find_if(groups.begin(), groups.end(),
+                                   [&](uint32_t g) { return (g & cls) != 0; });
+            run_values[i] = it != groups.end() ? *it : cls;
+        }
+
+        auto initial_size = runs.size();
+        CharClassRun run;
+        for_each_char_class(str, [&](size_t pos, size_t length, CharClass_t cls)
+        {
+            auto value = run_values[std::countr_zero(uint32_t(cls))];
+            if (run.range.length != 0 && value == run.char_classes)
+            {
+                run.range.length += length;
+                return;
+            }
+            if (run.range.length != 0)
+                runs.push_back(run);
+            run = {{pos, length}, value};
+        });
+        if (run.range.length != 0)
+            runs.push_back(run);
+        return runs.size() - initial_size;
+    }
+
+    std::vector<CharClassRun>
+    get_char_class_runs(std::string_view str, std::span<const uint32_t> groups)
+    {
+        std::vector<CharClassRun> result;
+        get_char_class_runs(str, result, groups);
+        return result;
+    }
+
+    CodepointSet make_codepoint_set(uint32_t char_classes)
+    {
+        CodepointSet result;
+        auto add_if_included = [&](char32_t first, char32_t last, unsigned cls)
+        {
+            if (char_classes & (1u << cls))
+                result.add_range(first, last);
+        };
+
+        char32_t first = 0;
+        for (auto encoded : COMPLETE_CHAR_CLASSES)
+        {
+            char32_t last = encoded >> CODE_POINT_SHIFT;
+            auto lower_char_class = (encoded & 0x1Fu) - 1;
+            auto upper_char_class = (encoded >> 5u) & 0x3Fu;
+            if (upper_char_class == 0)
+            {
+                add_if_included(first, last, lower_char_class);
+            }
+            else if (upper_char_class == 0x20)
+            {
+                for (char32_t cp = first; cp <= last; ++cp)
+                    add_if_included(cp, cp, decode_char_class(cp, encoded));
+            }
+            else
+            {
+                if (first != last)
+                    add_if_included(first, last - 1, upper_char_class - 1);
+                add_if_included(last, last, lower_char_class);
+            }
+            first = last + 1;
+        }
+
+        if (first <= UNICODE_MAX && (char_classes & CharClass::UNASSIGNED))
+            result.add_range(first, UNICODE_MAX);
+        return result;
     }
 }
@@ -7,36 +7,92 @@
 //****************************************************************************
 #pragma once
 
-#include <cassert>
 #include <cstdint>
-#include <optional>
-#include "Ystring/YstringDefinitions.hpp"
+#include <cstddef>
+#include <string_view>
 
 namespace ystring
 {
-    struct YSTRING_API CompactCharMapping
+    /**
+     * @brief The number of bits in the part of a code point that is the
+     *  index into a block of a CaseMappingTable.
+     */
+    constexpr unsigned CASE_BLOCK_SHIFT = 6;
+
+    /**
+     * @brief The delta in a UTF-8 CaseMappingTable for code points that
+     *  must be decoded before they can be converted.
+     */
+    constexpr int32_t UTF8_CASE_FALLBACK = INT32_MAX;
+
+    /**
+     * @brief The deltas in a UTF-8 CaseMappingTable from this value and
+     *  up to (but not including) UTF8_CASE_FALLBACK are for code points
+     *  that are converted to several code points. The delta minus this
+     *  value is the index of the code point's mapping in the table's list
+     *  of such mappings.
+     */
+    constexpr int32_t UTF8_CASE_SPECIAL = INT32_MAX - 0xFFFF;
+
+    /**
+     * @brief A three-stage lookup table that maps code points to their
+     *  upper, lower or title case.
+     *
+     * The code point's upper bits select a block, the lower bits an
+     * index in the block, and the index selects the delta that is added
+     * to the code point. Code points beyond the last block map to
+     * themselves.
+     *
+     * The UTF-8 tables have the same layout, but their deltas are added
+     * to the code point's UTF-8 encoding read as a big-endian integer.
+     * As the lower six bits of a code point are its last UTF-8 byte, and
+     * the remaining bits are in the preceding bytes, these tables are
+     * indexed directly by the bytes.
+     */
+    struct CaseMappingTable
     {
-        char32_t segment;
-        char32_t offset;
-        char32_t affected;
-        char32_t ignorable;
+        const uint8_t* blocks;
+        size_t blocks_size;
+        const uint8_t* delta_indexes;
+        const int32_t* deltas;
+
+        [[nodiscard]]
+        constexpr int32_t get_delta(char32_t codepoint) const
+        {
+            auto block = codepoint >> CASE_BLOCK_SHIFT;
+            if (block >= blocks_size)
+                return 0;
+            constexpr char32_t MASK = (1u << CASE_BLOCK_SHIFT) - 1;
+            auto offset = char32_t(blocks[block]) << CASE_BLOCK_SHIFT;
+            return deltas[delta_indexes[offset | (codepoint & MASK)]];
+        }
 
         [[nodiscard]]
-        std::optional<char32_t> get(char32_t codepoint) const
+        constexpr char32_t get(char32_t codepoint) const
         {
-            assert(codepoint - segment < 32);
-            auto mask = char32_t(1) << (codepoint - segment);
-            if (mask & affected)
-                return codepoint + offset;
-            if (mask & ignorable)
-                return codepoint;
-            return {};
+            return char32_t(int32_t(codepoint) + get_delta(codepoint));
         }
     };
 
-    struct CharMapping
+    /**
+     * @brief A code point that maps to several code points, and the
+     *  UTF-8 encoding of those code points.
+     */
+    struct FullCaseMapping
+    {
+        char32_t codepoint;
+        std::string_view mapping;
+    };
+
+    /**
+     * @brief A code point whose lower, title or upper case form is
+     *  several code points, and the UTF-8 encodings of all three forms.
+     */
+    struct SpecialCaseMapping
     {
-        char32_t from_codepoint;
-        char32_t to_codepoint;
+        char32_t codepoint;
+        std::string_view lower;
+        std::string_view title;
+        std::string_view upper;
     };
 }
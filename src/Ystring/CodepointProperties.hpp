@@ -0,0 +1,135 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include "Ystring/CharClass.hpp"
+#include "Ystring/CodepointConstants.hpp"
+
+namespace ystring
+{
+    /**
+     * @brief The number of bits in the part of a code point that is the
+     *  index into a block of record indexes in a CodepointPropertyTable.
+     */
+    constexpr unsigned PROPERTY_BLOCK_SHIFT = 4;
+
+    /**
+     * @brief The number of bits in the part of a code point, above
+     *  PROPERTY_BLOCK_SHIFT, that is the index into a group of blocks in
+     *  a CodepointPropertyTable.
+     */
+    constexpr unsigned PROPERTY_GROUP_SHIFT = 5;
+
+    /**
+     * @brief The properties of a code point that are needed by
+     *  operations that would otherwise look it up in several tables.
+     */
+    struct CodepointProperties
+    {
+        /**
+         * @brief The number of the code point's bit in CharClass_t.
+         */
+        uint8_t char_class;
+        /**
+         * @brief The canonical combining class.
+         */
+        uint8_t combining_class;
+        /**
+         * @brief The indexes of the simple lower, title and upper case
+         *  deltas in the table's list of case deltas.
+         */
+        uint8_t lower_case;
+        uint8_t title_case;
+        uint8_t upper_case;
+        /**
+         * @brief One plus the index in SPECIAL_CASING, or 0 if none of
+         *  the code point's case forms are several code points.
+         */
+        uint8_t special_casing;
+        /**
+         * @brief One plus the index in TO_DECOMPOSED, or 0 if the code
+         *  point has no canonical decomposition into two code points.
+         */
+        uint16_t decomposition;
+
+        [[nodiscard]]
+        constexpr CharClass_t get_char_class() const
+        {
+            return CharClass_t(1u << char_class);
+        }
+
+        [[nodiscard]]
+        constexpr bool is(uint32_t char_classes) const
+        {
+            return ((1u << char_class) & char_classes) != 0;
+        }
+    };
+
+    /**
+     * @brief A four-stage lookup table that maps every code point to its
+     *  CodepointProperties.
+     *
+     * The code point's upper bits select a group of blocks, the next
+     * PROPERTY_GROUP_SHIFT bits select a block in the group, and the
+     * lowest PROPERTY_BLOCK_SHIFT bits select the index of the code
+     * point's record in the block. Identical groups and blocks are
+     * stored only once.
+     */
+    struct CodepointPropertyTable
+    {
+        const uint8_t* groups;
+        const uint16_t* blocks;
+        const uint16_t* record_indexes;
+        const CodepointProperties* records;
+        const int32_t* case_deltas;
+
+        /**
+         * @brief Returns the properties of @a codepoint. Values above
+         *  UNICODE_MAX have the properties of unassigned code points.
+         */
+        [[nodiscard]]
+        constexpr const CodepointProperties& get(char32_t codepoint) const
+        {
+            if (codepoint > UNICODE_MAX)
+                return records[0];
+            constexpr char32_t BLOCK_MASK = (1u << PROPERTY_BLOCK_SHIFT) - 1;
+            constexpr char32_t GROUP_MASK = (1u << PROPERTY_GROUP_SHIFT) - 1;
+            constexpr unsigned GROUP_SHIFT = PROPERTY_BLOCK_SHIFT
+                                             + PROPERTY_GROUP_SHIFT;
+            auto group = char32_t(groups[codepoint >> GROUP_SHIFT]);
+            auto block = blocks[(group << PROPERTY_GROUP_SHIFT)
+                                | ((codepoint >> PROPERTY_BLOCK_SHIFT)
+                                   & GROUP_MASK)];
+            auto index = record_indexes[(char32_t(block) << PROPERTY_BLOCK_SHIFT)
+                                        | (codepoint & BLOCK_MASK)];
+            return records[index];
+        }
+
+        [[nodiscard]]
+        constexpr char32_t to_lower(char32_t codepoint,
+                                    const CodepointProperties& props) const
+        {
+            return char32_t(int32_t(codepoint) + case_deltas[props.lower_case]);
+        }
+
+        [[nodiscard]]
+        constexpr char32_t to_title(char32_t codepoint,
+                                    const CodepointProperties& props) const
+        {
+            return char32_t(int32_t(codepoint) + case_deltas[props.title_case]);
+        }
+
+        [[nodiscard]]
+        constexpr char32_t to_upper(char32_t codepoint,
+                                    const CodepointProperties& props) const
+        {
+            return char32_t(int32_t(codepoint) + case_deltas[props.upper_case]);
+        }
+    };
+}
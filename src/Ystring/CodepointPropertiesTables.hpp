@@ -0,0 +1,3778 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include "CodepointProperties.hpp"
+
+namespace ystring
+{
+    /**
+     * @brief The index of each code point's group of blocks.
+     *
+     * The sizes of the tables, in bytes:
+     *  - groups: 2176
+     *  - blocks: 6720
+     *  - record indexes: 26496
+     *  - records: 10536
+     */
+    constexpr uint8_t CODEPOINT_PROPERTY_GROUPS[] =
+    {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        28, 26, 29, 30, 31, 32, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 34, 34, 34, 34,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39,
+        40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+        26, 56, 57, 58, 58, 58, 58, 59, 26, 26, 60, 26, 26, 26, 26, 26,
+        26, 61, 26, 62, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        63, 58, 58, 58, 26, 64, 65, 66, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 67, 26, 26, 68, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 69, 70, 71, 58, 58, 58, 58, 72, 58,
+        58, 58, 58, 58, 58, 58, 73, 74, 75, 76, 77, 78, 79, 80, 58, 81,
+        82, 83, 84, 85, 86, 58, 87, 88, 89, 90, 79, 91, 92, 93, 58, 58,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 94, 26, 26, 26, 26, 26, 26, 26, 95, 96, 26, 26, 26,
+        26, 26, 26, 26, 26, 26, 26, 97, 26, 26, 26, 26, 26, 26, 26, 26,
+        26, 26, 26, 26, 26, 98, 26, 99, 58, 58, 58, 58, 26, 100, 58, 58,
+        26, 26, 26, 26, 26, 26, 26, 26, 26, 101, 26, 26, 26, 26, 26, 26,
+        26, 102, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        103, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 104,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+        35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 104,
+    };
+
+    constexpr uint16_t CODEPOINT_PROPERTY_BLOCKS[] =
+    {
+        // Block 0
+        0, 0, 1, 2, 3, 4, 5, 6, 0, 0, 7, 8,
+        9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+        21, 22, 23, 24, 25, 26, 27, 28,
+        // Block 1
+        29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+        41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+        53, 54, 55, 56, 57, 58, 59, 60,
+        // Block 2
+        61, 62, 63, 64, 65, 66, 59, 67, 68, 59, 59, 59,
+        69, 70, 71, 72, 59, 59, 59, 73, 74, 75, 76, 77,
+        78, 79, 80, 81, 82, 83, 84, 85,
+        // Block 3
+        86, 87, 88, 83, 89, 90, 91, 92, 83, 83, 83, 83,
+        93, 94, 95, 96, 97, 98, 83, 99, 100, 83, 83, 83,
+        83, 83, 101, 102, 103, 83, 104, 105,
+        // Block 4
+        83, 106, 107, 108, 83, 109, 110, 83, 111, 112, 83, 83,
+        113, 114, 115, 116, 117, 83, 118, 119, 120, 121, 122, 123,
+        124, 125, 126, 127, 128, 129, 130, 131,
+        // Block 5
+        132, 125, 126, 133, 134, 135, 136, 137, 138, 139, 126, 140,
+        141, 142, 130, 143, 144, 125, 126, 145, 146, 147, 130, 148,
+        149, 150, 151, 152, 153, 154, 136, 155,
+        // Block 6
+        156, 157, 126, 158, 159, 160, 130, 161, 162, 157, 126, 163,
+        164, 165, 130, 166, 167, 157, 83, 168, 169, 170, 130, 171,
+        172, 173, 83, 174, 175, 176, 136, 177,
+        // Block 7
+        178, 83, 83, 179, 180, 181, 182, 182, 183, 83, 184, 185,
+        186, 187, 182, 182, 188, 189, 190, 191, 192, 193, 194, 195,
+        196, 197, 198, 199, 200, 201, 182, 182,
+        // Block 8
+        83, 83, 202, 203, 204, 205, 206, 207, 208, 209, 210, 210,
+        211, 212, 212, 213, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 9
+        83, 83, 83, 83, 214, 215, 83, 83, 214, 83, 83, 216,
+        217, 218, 83, 83, 83, 217, 83, 83, 83, 219, 220, 221,
+        83, 222, 223, 223, 223, 223, 223, 224,
+        // Block 10
+        225, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 11
+        83, 83, 83, 83, 83, 83, 226, 83, 227, 228, 83, 83,
+        83, 83, 229, 230, 83, 231, 83, 232, 83, 233, 234, 235,
+        83, 83, 83, 236, 237, 238, 239, 240,
+        // Block 12
+        241, 239, 83, 83, 242, 83, 83, 243, 244, 83, 245, 83,
+        83, 83, 83, 246, 83, 247, 248, 249, 250, 83, 251, 252,
+        83, 83, 253, 83, 254, 255, 256, 256,
+        // Block 13
+        83, 257, 83, 83, 83, 258, 259, 260, 239, 239, 261, 262,
+        263, 182, 182, 182, 264, 265, 83, 266, 267, 204, 268, 269,
+        270, 83, 271, 103, 83, 83, 272, 273,
+        // Block 14
+        83, 83, 274, 275, 276, 103, 83, 277, 278, 279, 279, 280,
+        281, 282, 283, 284, 39, 39, 285, 40, 40, 40, 286, 287,
+        288, 289, 40, 40, 290, 291, 45, 292,
+        // Block 15
+        293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304,
+        305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316,
+        317, 318, 319, 320, 321, 322, 323, 324,
+        // Block 16
+        325, 326, 327, 328, 329, 330, 331, 332, 333, 334, 335, 335,
+        336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347,
+        348, 349, 350, 256, 351, 352, 256, 353,
+        // Block 17
+        354, 355, 356, 355, 357, 355, 358, 359, 360, 355, 361, 355,
+        355, 355, 362, 355, 363, 256, 364, 256, 256, 256, 256, 365,
+        256, 366, 355, 367, 256, 368, 369, 256,
+        // Block 18
+        256, 256, 222, 182, 370, 182, 345, 345, 345, 371, 256, 372,
+        373, 374, 375, 345, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 376, 377, 256, 256, 378,
+        // Block 19
+        256, 256, 256, 256, 256, 256, 379, 256, 256, 256, 256, 256,
+        256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 380, 381,
+        345, 382, 256, 256, 383, 355, 384, 355,
+        // Block 20
+        256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 256, 355, 355, 355, 355, 355, 355, 355, 355,
+        385, 386, 355, 355, 355, 387, 355, 388,
+        // Block 21
+        355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355, 355,
+        355, 389, 355, 355, 256, 256, 256, 355, 390, 256, 256, 391,
+        256, 392, 256, 256, 256, 256, 256, 256,
+        // Block 22
+        74, 74, 74, 77, 77, 77, 393, 394, 59, 59, 59, 59,
+        59, 59, 395, 396, 397, 397, 398, 83, 83, 83, 399, 400,
+        83, 401, 402, 402, 402, 402, 45, 45,
+        // Block 23
+        403, 404, 405, 406, 407, 408, 182, 182, 256, 409, 256, 256,
+        256, 256, 256, 410, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 256, 256, 411, 182, 256,
+        // Block 24
+        412, 413, 414, 415, 416, 417, 418, 419, 83, 420, 421, 422,
+        423, 424, 83, 425, 426, 83, 83, 178, 83, 83, 83, 83,
+        247, 427, 83, 83, 256, 256, 428, 83,
+        // Block 25
+        256, 429, 430, 256, 431, 432, 256, 256, 430, 256, 256, 432,
+        256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 256, 256, 256, 256, 256,
+        // Block 26
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 27
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 256, 256, 256, 256,
+        // Block 28
+        83, 433, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 29
+        83, 83, 83, 83, 83, 83, 83, 83, 434, 256, 256, 256,
+        435, 83, 83, 277, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 30
+        436, 83, 437, 182, 59, 59, 438, 439, 59, 440, 83, 83,
+        83, 83, 441, 442, 44, 443, 444, 445, 59, 59, 59, 446,
+        447, 448, 449, 450, 451, 452, 182, 453,
+        // Block 31
+        454, 83, 455, 456, 83, 83, 83, 457, 458, 83, 83, 459,
+        460, 239, 45, 461, 103, 83, 462, 83, 463, 464, 83, 434,
+        117, 83, 83, 465, 466, 467, 468, 469,
+        // Block 32
+        83, 83, 470, 471, 472, 473, 83, 474, 83, 83, 83, 475,
+        476, 477, 478, 479, 480, 481, 402, 39, 39, 482, 483, 484,
+        484, 484, 484, 484, 83, 83, 485, 239,
+        // Block 33
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 486, 83, 487, 83, 83, 253,
+        // Block 34
+        488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488,
+        488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488, 488,
+        488, 488, 488, 488, 488, 488, 488, 488,
+        // Block 35
+        489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489,
+        489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489,
+        489, 489, 489, 489, 489, 489, 489, 489,
+        // Block 36
+        489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489,
+        489, 489, 489, 489, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 37
+        83, 83, 83, 83, 83, 83, 251, 83, 83, 83, 83, 83,
+        83, 254, 182, 182, 490, 491, 492, 493, 494, 83, 83, 83,
+        83, 83, 83, 495, 496, 497, 83, 83,
+        // Block 38
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 498, 256, 83, 83, 83,
+        83, 499, 83, 83, 500, 182, 182, 501,
+        // Block 39
+        502, 503, 504, 505, 506, 507, 508, 509, 83, 83, 83, 83,
+        83, 83, 83, 510, 511, 2, 3, 4, 5, 512, 513, 514,
+        83, 515, 83, 247, 516, 517, 518, 519,
+        // Block 40
+        520, 83, 218, 521, 251, 251, 182, 182, 83, 83, 83, 83,
+        83, 83, 83, 110, 522, 345, 345, 523, 524, 524, 524, 525,
+        526, 527, 528, 182, 182, 256, 256, 529,
+        // Block 41
+        182, 182, 182, 182, 182, 182, 182, 182, 83, 434, 83, 83,
+        83, 142, 530, 531, 83, 83, 532, 83, 533, 83, 83, 534,
+        83, 535, 83, 83, 536, 537, 182, 182,
+        // Block 42
+        538, 538, 539, 540, 540, 83, 83, 83, 83, 251, 239, 538,
+        538, 541, 540, 542, 83, 83, 543, 83, 83, 83, 544, 545,
+        545, 546, 547, 548, 549, 83, 550, 486,
+        // Block 43
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 401, 83, 246, 543, 182,
+        551, 40, 40, 552, 182, 182, 182, 182,
+        // Block 44
+        553, 83, 83, 554, 83, 555, 83, 556, 83, 247, 557, 182,
+        182, 182, 83, 558, 83, 559, 83, 560, 182, 182, 182, 182,
+        83, 83, 83, 561, 345, 562, 345, 345,
+        // Block 45
+        563, 564, 83, 565, 566, 567, 83, 568, 83, 569, 182, 182,
+        570, 83, 571, 572, 83, 83, 83, 573, 83, 574, 83, 575,
+        83, 576, 577, 182, 182, 182, 182, 182,
+        // Block 46
+        83, 83, 83, 83, 243, 182, 182, 182, 578, 578, 578, 579,
+        580, 580, 580, 581, 83, 83, 582, 239, 583, 63, 584, 65,
+        585, 182, 182, 182, 182, 182, 182, 182,
+        // Block 47
+        182, 182, 182, 182, 182, 182, 345, 586, 83, 83, 587, 588,
+        589, 182, 182, 590, 83, 569, 591, 83, 592, 593, 182, 83,
+        594, 182, 182, 83, 595, 182, 83, 401,
+        // Block 48
+        596, 83, 83, 597, 598, 562, 599, 600, 270, 601, 602, 603,
+        604, 83, 243, 239, 605, 83, 606, 607, 608, 83, 83, 609,
+        270, 83, 83, 610, 611, 612, 613, 614,
+        // Block 49
+        83, 139, 615, 616, 617, 182, 182, 182, 618, 619, 620, 83,
+        83, 621, 622, 239, 623, 125, 126, 624, 625, 626, 627, 628,
+        629, 630, 83, 631, 632, 633, 634, 182,
+        // Block 50
+        83, 83, 83, 635, 636, 637, 588, 182, 83, 83, 83, 638,
+        639, 239, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        83, 83, 640, 641, 642, 643, 182, 182,
+        // Block 51
+        83, 83, 83, 644, 645, 239, 646, 182, 83, 83, 647, 648,
+        239, 649, 650, 182, 83, 651, 652, 653, 401, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 52
+        83, 83, 615, 654, 182, 182, 182, 182, 182, 182, 63, 63,
+        65, 65, 190, 655, 656, 657, 83, 658, 659, 239, 182, 182,
+        182, 182, 660, 83, 83, 661, 662, 182,
+        // Block 53
+        663, 83, 83, 664, 665, 666, 83, 83, 667, 668, 669, 83,
+        83, 83, 83, 243, 670, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 83, 83, 671, 239,
+        // Block 54
+        126, 83, 640, 672, 673, 190, 221, 674, 83, 675, 676, 677,
+        182, 182, 182, 182, 678, 83, 83, 679, 680, 239, 681, 83,
+        682, 683, 239, 182, 182, 182, 182, 182,
+        // Block 55
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 83, 684, 685, 157, 83, 686, 687, 688, 182, 182,
+        182, 182, 182, 142, 345, 689, 690, 691,
+        // Block 56
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 254, 182, 182, 182, 182, 182, 182,
+        // Block 57
+        524, 524, 524, 524, 524, 524, 692, 693, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 486, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 58
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 59
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 83, 83, 83, 83, 83, 83, 694,
+        // Block 60
+        83, 83, 83, 695, 696, 697, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 61
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 110,
+        // Block 62
+        83, 83, 83, 83, 401, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 63
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 83, 698, 699, 239, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 64
+        83, 83, 83, 243, 83, 247, 467, 83, 83, 83, 83, 247,
+        239, 83, 251, 700, 83, 83, 83, 701, 702, 703, 704, 705,
+        83, 182, 182, 182, 182, 182, 182, 182,
+        // Block 65
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 706, 83, 707, 239,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 66
+        182, 182, 182, 182, 63, 63, 65, 65, 345, 708, 182, 182,
+        182, 182, 182, 182, 83, 83, 83, 83, 709, 710, 711, 711,
+        712, 713, 182, 182, 182, 182, 714, 715,
+        // Block 67
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 543,
+        // Block 68
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 246, 182, 716, 243, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 69
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 717,
+        // Block 70
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 718, 719, 182, 720, 721, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 71
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 253, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 72
+        83, 83, 83, 83, 83, 83, 110, 434, 243, 722, 723, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 73
+        256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 239, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 256, 256, 256, 256, 256,
+        // Block 74
+        256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 410,
+        182, 182, 182, 182, 502, 502, 724, 502, 725, 256, 256, 256,
+        256, 256, 256, 256, 410, 182, 182, 182,
+        // Block 75
+        256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 411, 256, 256, 726, 256, 256, 727, 728, 729,
+        730, 256, 731, 732, 733, 256, 370, 182,
+        // Block 76
+        256, 256, 256, 256, 734, 182, 182, 182, 182, 182, 182, 182,
+        345, 735, 345, 735, 256, 256, 256, 256, 256, 435, 345, 566,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 77
+        736, 737, 39, 738, 739, 740, 741, 736, 742, 743, 744, 745,
+        746, 736, 737, 39, 747, 748, 39, 749, 750, 751, 752, 736,
+        753, 39, 736, 737, 39, 738, 739, 39,
+        // Block 78
+        741, 736, 742, 752, 736, 753, 39, 736, 737, 39, 754, 736,
+        755, 756, 757, 758, 39, 759, 736, 760, 761, 762, 763, 39,
+        764, 736, 765, 39, 766, 649, 649, 649,
+        // Block 79
+        256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 256, 256, 256, 256, 256,
+        // Block 80
+        502, 502, 502, 767, 502, 502, 768, 769, 770, 771, 772, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 81
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 773, 774, 775, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 82
+        776, 777, 778, 40, 40, 40, 779, 182, 780, 182, 182, 182,
+        182, 182, 182, 182, 83, 83, 434, 781, 782, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 83
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 83, 783, 182,
+        83, 83, 784, 785, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 84
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 83, 786, 239, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 83, 787, 788,
+        // Block 85
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 789, 247,
+        // Block 86
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        790, 791, 182, 182, 792, 792, 793, 794, 795, 467, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 87
+        182, 182, 182, 182, 182, 182, 182, 613, 345, 345, 796, 797,
+        182, 182, 182, 182, 613, 345, 798, 799, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 88
+        800, 83, 801, 802, 803, 804, 805, 806, 807, 253, 808, 253,
+        182, 182, 182, 809, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 89
+        256, 256, 810, 256, 256, 256, 256, 256, 256, 410, 429, 811,
+        811, 811, 256, 411, 812, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 813, 182, 182, 182, 814, 256,
+        // Block 90
+        815, 256, 256, 810, 816, 817, 411, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 256, 256, 256, 256, 818,
+        // Block 91
+        256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 819, 527, 527, 256, 256, 256, 256, 256, 256, 256, 820,
+        256, 256, 256, 256, 256, 222, 810, 528,
+        // Block 92
+        810, 256, 256, 256, 821, 222, 256, 256, 821, 256, 813, 810,
+        817, 182, 182, 182, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 256, 256, 256, 256, 256, 256, 256,
+        // Block 93
+        256, 256, 256, 256, 256, 410, 813, 527, 822, 256, 256, 256,
+        823, 824, 222, 816, 256, 256, 256, 256, 256, 256, 256, 256,
+        256, 825, 256, 256, 256, 256, 256, 239,
+        // Block 94
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 182, 182, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 95
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 254, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 96
+        83, 251, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 97
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 588, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 98
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 142, 83,
+        // Block 99
+        83, 83, 83, 83, 83, 251, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 100
+        83, 251, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182, 182,
+        182, 182, 182, 182, 182, 182, 182, 182,
+        // Block 101
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 110, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83,
+        // Block 102
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83, 83,
+        83, 83, 83, 182, 182, 182, 182, 182,
+        // Block 103
+        826, 182, 695, 695, 695, 695, 695, 695, 182, 182, 182, 182,
+        182, 182, 182, 182, 502, 502, 502, 502, 502, 502, 502, 502,
+        502, 502, 502, 502, 502, 502, 502, 182,
+        // Block 104
+        489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489,
+        489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489, 489,
+        489, 489, 489, 489, 489, 489, 489, 827,
+    };
+
+    constexpr uint16_t CODEPOINT_PROPERTY_INDEXES[] =
+    {
+        // Block 0
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1,
+        // Block 1
+        2, 3, 3, 3, 4, 3, 3, 3, 5, 6, 3, 7,
+        3, 8, 3, 3,
+        // Block 2
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3,
+        7, 7, 7, 3,
+        // Block 3
+        3, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10,
+        // Block 4
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 5,
+        3, 6, 11, 12,
+        // Block 5
+        11, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13,
+        // Block 6
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 5,
+        7, 6, 7, 1,
+        // Block 7
+        2, 3, 4, 4, 4, 4, 14, 3, 11, 14, 15, 16,
+        7, 17, 14, 11,
+        // Block 8
+        14, 7, 18, 18, 11, 19, 3, 3, 11, 18, 15, 20,
+        18, 18, 18, 3,
+        // Block 9
+        21, 22, 23, 24, 25, 26, 10, 27, 28, 29, 30, 31,
+        32, 33, 34, 35,
+        // Block 10
+        10, 36, 37, 38, 39, 40, 41, 7, 10, 42, 43, 44,
+        45, 46, 10, 47,
+        // Block 11
+        48, 49, 50, 51, 52, 53, 13, 54, 55, 56, 57, 58,
+        59, 60, 61, 62,
+        // Block 12
+        13, 63, 64, 65, 66, 67, 68, 7, 13, 69, 70, 71,
+        72, 73, 13, 74,
+        // Block 13
+        75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+        87, 88, 89, 90,
+        // Block 14
+        91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+        103, 104, 105, 106,
+        // Block 15
+        107, 108, 109, 110, 111, 112, 91, 92, 113, 114, 115, 116,
+        117, 118, 119, 120,
+        // Block 16
+        121, 122, 91, 92, 123, 124, 125, 126, 127, 128, 129, 130,
+        131, 132, 133, 91,
+        // Block 17
+        92, 91, 92, 134, 135, 136, 137, 138, 139, 140, 91, 92,
+        141, 142, 143, 144,
+        // Block 18
+        145, 146, 91, 92, 147, 148, 149, 150, 151, 152, 153, 154,
+        155, 156, 157, 158,
+        // Block 19
+        159, 160, 161, 162, 163, 164, 91, 92, 165, 166, 167, 168,
+        169, 170, 171, 172,
+        // Block 20
+        173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184,
+        185, 186, 187, 188,
+        // Block 21
+        189, 190, 91, 92, 91, 92, 191, 91, 92, 192, 192, 91,
+        92, 127, 193, 194,
+        // Block 22
+        195, 91, 92, 192, 196, 197, 198, 199, 91, 92, 200, 201,
+        198, 202, 203, 204,
+        // Block 23
+        205, 206, 91, 92, 91, 92, 207, 91, 92, 207, 127, 127,
+        91, 92, 207, 208,
+        // Block 24
+        209, 210, 210, 91, 92, 91, 92, 211, 91, 92, 127, 15,
+        91, 92, 127, 212,
+        // Block 25
+        15, 15, 15, 15, 213, 214, 215, 213, 214, 215, 213, 214,
+        215, 216, 217, 218,
+        // Block 26
+        219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230,
+        231, 232, 233, 234,
+        // Block 27
+        235, 236, 237, 238, 91, 92, 239, 240, 241, 242, 243, 244,
+        245, 246, 247, 248,
+        // Block 28
+        249, 213, 214, 215, 250, 251, 252, 253, 254, 255, 256, 257,
+        258, 259, 260, 261,
+        // Block 29
+        262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273,
+        274, 275, 276, 277,
+        // Block 30
+        278, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289,
+        91, 92, 290, 291,
+        // Block 31
+        292, 127, 91, 92, 91, 92, 293, 294, 295, 296, 297, 298,
+        299, 300, 301, 302,
+        // Block 32
+        303, 304, 305, 306, 127, 127, 127, 127, 127, 127, 307, 91,
+        92, 308, 309, 310,
+        // Block 33
+        310, 91, 92, 311, 312, 313, 91, 92, 91, 92, 91, 92,
+        91, 92, 91, 92,
+        // Block 34
+        314, 315, 316, 317, 318, 127, 319, 319, 127, 320, 127, 321,
+        322, 127, 127, 127,
+        // Block 35
+        319, 323, 127, 324, 325, 326, 327, 127, 328, 329, 327, 330,
+        331, 127, 127, 329,
+        // Block 36
+        127, 332, 333, 127, 127, 334, 127, 127, 127, 127, 127, 127,
+        127, 335, 127, 127,
+        // Block 37
+        336, 127, 337, 336, 127, 127, 127, 338, 336, 339, 340, 340,
+        341, 127, 127, 127,
+        // Block 38
+        127, 127, 342, 127, 15, 127, 127, 127, 127, 127, 127, 127,
+        127, 343, 344, 127,
+        // Block 39
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127,
+        // Block 40
+        345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345,
+        345, 345, 345, 345,
+        // Block 41
+        345, 345, 11, 11, 11, 11, 345, 345, 345, 345, 345, 345,
+        345, 345, 345, 345,
+        // Block 42
+        345, 345, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11,
+        // Block 43
+        345, 345, 345, 345, 345, 11, 11, 11, 11, 11, 11, 11,
+        345, 11, 345, 11,
+        // Block 44
+        11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11,
+        // Block 45
+        346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+        346, 346, 346, 346,
+        // Block 46
+        346, 346, 346, 346, 346, 347, 348, 348, 348, 348, 347, 349,
+        348, 348, 348, 348,
+        // Block 47
+        348, 350, 350, 348, 348, 348, 348, 350, 350, 348, 348, 348,
+        348, 348, 348, 348,
+        // Block 48
+        348, 348, 348, 348, 351, 351, 351, 351, 351, 348, 348, 348,
+        348, 346, 346, 346,
+        // Block 49
+        346, 346, 346, 346, 352, 353, 346, 348, 348, 348, 346, 346,
+        346, 348, 348, 354,
+        // Block 50
+        346, 346, 346, 348, 348, 348, 348, 346, 347, 348, 348, 346,
+        355, 356, 356, 355,
+        // Block 51
+        356, 356, 355, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+        346, 346, 346, 346,
+        // Block 52
+        91, 92, 91, 92, 345, 11, 91, 92, 0, 0, 345, 203,
+        203, 203, 3, 357,
+        // Block 53
+        0, 0, 0, 0, 11, 358, 359, 3, 360, 361, 362, 0,
+        363, 0, 364, 365,
+        // Block 54
+        366, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10,
+        // Block 55
+        10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 367, 368,
+        369, 370, 371, 372,
+        // Block 56
+        373, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13,
+        // Block 57
+        13, 13, 374, 13, 13, 13, 13, 13, 13, 13, 375, 376,
+        377, 378, 379, 380,
+        // Block 58
+        381, 382, 383, 384, 385, 386, 387, 388, 91, 92, 91, 92,
+        91, 92, 91, 92,
+        // Block 59
+        91, 92, 91, 92, 91, 92, 91, 92, 91, 92, 91, 92,
+        91, 92, 91, 92,
+        // Block 60
+        389, 390, 391, 392, 393, 394, 7, 91, 92, 395, 91, 92,
+        127, 292, 292, 292,
+        // Block 61
+        396, 397, 398, 399, 398, 398, 398, 400, 398, 398, 398, 398,
+        401, 402, 403, 398,
+        // Block 62
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 404, 10, 10,
+        10, 10, 10, 10,
+        // Block 63
+        10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+        10, 10, 10, 10,
+        // Block 64
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 405, 13, 13,
+        13, 13, 13, 13,
+        // Block 65
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+        13, 13, 13, 13,
+        // Block 66
+        406, 407, 390, 408, 390, 390, 390, 409, 390, 390, 390, 390,
+        410, 411, 412, 390,
+        // Block 67
+        91, 92, 91, 92, 91, 92, 413, 414, 91, 92, 91, 92,
+        91, 92, 91, 92,
+        // Block 68
+        91, 92, 14, 346, 346, 346, 346, 346, 415, 415, 91, 92,
+        91, 92, 91, 92,
+        // Block 69
+        416, 417, 418, 91, 92, 91, 92, 91, 92, 91, 92, 91,
+        92, 91, 92, 419,
+        // Block 70
+        420, 421, 422, 423, 91, 92, 424, 425, 91, 92, 426, 427,
+        428, 429, 430, 431,
+        // Block 71
+        91, 92, 432, 433, 434, 435, 436, 437, 91, 92, 438, 439,
+        440, 441, 442, 443,
+        // Block 72
+        444, 445, 446, 447, 448, 449, 91, 92, 450, 451, 91, 92,
+        91, 92, 91, 92,
+        // Block 73
+        0, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452,
+        452, 452, 452, 452,
+        // Block 74
+        452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 452,
+        452, 452, 452, 452,
+        // Block 75
+        452, 452, 452, 452, 452, 452, 452, 0, 0, 345, 3, 3,
+        3, 3, 3, 3,
+        // Block 76
+        127, 453, 453, 453, 453, 453, 453, 453, 453, 453, 453, 453,
+        453, 453, 453, 453,
+        // Block 77
+        453, 453, 453, 453, 453, 453, 453, 453, 453, 453, 453, 453,
+        453, 453, 453, 453,
+        // Block 78
+        453, 453, 453, 453, 453, 453, 453, 454, 127, 3, 8, 0,
+        0, 14, 14, 4,
+        // Block 79
+        0, 348, 346, 346, 346, 346, 348, 346, 346, 346, 455, 348,
+        346, 346, 346, 346,
+        // Block 80
+        346, 346, 348, 348, 348, 348, 348, 348, 346, 346, 348, 346,
+        346, 455, 456, 346,
+        // Block 81
+        457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 466, 467,
+        468, 469, 8, 470,
+        // Block 82
+        3, 471, 472, 3, 346, 348, 3, 465, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 83
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 84
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+        0, 0, 0, 15,
+        // Block 85
+        15, 15, 15, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 86
+        17, 17, 17, 17, 17, 17, 7, 7, 7, 3, 3, 4,
+        3, 3, 14, 14,
+        // Block 87
+        346, 346, 346, 346, 346, 346, 346, 346, 473, 474, 475, 3,
+        17, 3, 3, 3,
+        // Block 88
+        15, 15, 476, 477, 478, 479, 480, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 89
+        345, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 481,
+        482, 483, 473, 474,
+        // Block 90
+        475, 484, 485, 346, 346, 348, 348, 346, 346, 346, 346, 346,
+        348, 346, 346, 348,
+        // Block 91
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3,
+        3, 3, 15, 15,
+        // Block 92
+        486, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 93
+        487, 15, 488, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 94
+        15, 15, 15, 489, 3, 15, 346, 346, 346, 346, 346, 346,
+        346, 17, 14, 346,
+        // Block 95
+        346, 346, 346, 348, 346, 345, 345, 346, 346, 14, 348, 346,
+        346, 348, 15, 15,
+        // Block 96
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 15, 15,
+        15, 14, 14, 15,
+        // Block 97
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 0, 17,
+        // Block 98
+        15, 490, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 99
+        346, 348, 346, 346, 348, 346, 346, 348, 348, 348, 346, 348,
+        348, 346, 348, 346,
+        // Block 100
+        346, 346, 348, 346, 348, 346, 348, 346, 348, 346, 346, 0,
+        0, 15, 15, 15,
+        // Block 101
+        15, 15, 15, 15, 15, 15, 354, 354, 354, 354, 354, 354,
+        354, 354, 354, 354,
+        // Block 102
+        354, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 103
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 15, 15,
+        15, 15, 15, 15,
+        // Block 104
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 346,
+        346, 346, 346, 346,
+        // Block 105
+        346, 346, 348, 346, 345, 345, 14, 3, 3, 3, 345, 0,
+        0, 348, 4, 4,
+        // Block 106
+        15, 15, 15, 15, 15, 15, 346, 346, 346, 346, 345, 346,
+        346, 346, 346, 346,
+        // Block 107
+        346, 346, 346, 346, 345, 346, 346, 346, 345, 346, 346, 346,
+        346, 346, 0, 0,
+        // Block 108
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 0,
+        // Block 109
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 348, 348, 348,
+        0, 0, 3, 0,
+        // Block 110
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+        0, 0, 0, 0,
+        // Block 111
+        15, 15, 15, 15, 15, 15, 15, 15, 11, 15, 15, 15,
+        15, 15, 15, 0,
+        // Block 112
+        17, 17, 0, 0, 0, 0, 0, 346, 346, 348, 348, 348,
+        346, 346, 346, 346,
+        // Block 113
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 345, 346, 346,
+        346, 346, 346, 348,
+        // Block 114
+        348, 348, 348, 348, 346, 346, 346, 346, 346, 346, 346, 346,
+        346, 346, 346, 346,
+        // Block 115
+        346, 346, 17, 348, 346, 346, 348, 346, 346, 348, 346, 346,
+        346, 348, 348, 348,
+        // Block 116
+        481, 482, 483, 346, 346, 346, 348, 346, 346, 348, 348, 346,
+        346, 346, 346, 346,
+        // Block 117
+        354, 354, 354, 491, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 118
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 492, 15, 15,
+        15, 15, 15, 15,
+        // Block 119
+        15, 493, 15, 15, 494, 15, 15, 15, 15, 15, 354, 491,
+        495, 15, 491, 491,
+        // Block 120
+        491, 354, 354, 354, 354, 354, 354, 354, 354, 491, 491, 491,
+        491, 496, 491, 491,
+        // Block 121
+        15, 346, 348, 346, 346, 354, 354, 354, 497, 498, 499, 500,
+        501, 502, 503, 504,
+        // Block 122
+        15, 15, 354, 354, 3, 3, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9,
+        // Block 123
+        3, 345, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 124
+        15, 354, 491, 491, 0, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 0, 15,
+        // Block 125
+        15, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 126
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 15, 15,
+        15, 15, 15, 15,
+        // Block 127
+        15, 0, 15, 0, 0, 0, 15, 15, 15, 15, 0, 0,
+        495, 15, 491, 491,
+        // Block 128
+        491, 354, 354, 354, 354, 0, 0, 491, 491, 0, 0, 505,
+        506, 496, 15, 0,
+        // Block 129
+        0, 0, 0, 0, 0, 0, 0, 491, 0, 0, 0, 0,
+        507, 508, 0, 509,
+        // Block 130
+        15, 15, 354, 354, 0, 0, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9,
+        // Block 131
+        15, 15, 4, 4, 18, 18, 18, 18, 18, 18, 14, 4,
+        15, 3, 346, 0,
+        // Block 132
+        0, 354, 354, 491, 0, 15, 15, 15, 15, 15, 15, 0,
+        0, 0, 0, 15,
+        // Block 133
+        15, 0, 15, 510, 0, 15, 511, 0, 15, 15, 0, 0,
+        495, 0, 491, 491,
+        // Block 134
+        491, 354, 354, 0, 0, 0, 0, 354, 354, 0, 0, 354,
+        354, 496, 0, 0,
+        // Block 135
+        0, 354, 0, 0, 0, 0, 0, 0, 0, 512, 513, 514,
+        15, 0, 515, 0,
+        // Block 136
+        0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9,
+        // Block 137
+        354, 354, 15, 15, 15, 354, 3, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 138
+        0, 354, 354, 491, 0, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 0, 15,
+        // Block 139
+        15, 15, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 140
+        15, 0, 15, 15, 0, 15, 15, 15, 15, 15, 0, 0,
+        495, 15, 491, 491,
+        // Block 141
+        491, 354, 354, 354, 354, 354, 0, 354, 354, 491, 0, 491,
+        491, 496, 0, 0,
+        // Block 142
+        15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 143
+        3, 4, 0, 0, 0, 0, 0, 0, 0, 15, 354, 354,
+        354, 354, 354, 354,
+        // Block 144
+        0, 354, 491, 491, 0, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 0, 15,
+        // Block 145
+        15, 0, 15, 15, 0, 15, 15, 15, 15, 15, 0, 0,
+        495, 15, 491, 354,
+        // Block 146
+        491, 354, 354, 354, 354, 0, 0, 491, 516, 0, 0, 517,
+        518, 496, 0, 0,
+        // Block 147
+        0, 0, 0, 0, 0, 354, 354, 491, 0, 0, 0, 0,
+        519, 520, 0, 15,
+        // Block 148
+        14, 15, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 149
+        0, 0, 354, 15, 0, 15, 15, 15, 15, 15, 15, 0,
+        0, 0, 15, 15,
+        // Block 150
+        15, 0, 15, 15, 521, 15, 0, 0, 0, 15, 15, 0,
+        15, 0, 15, 15,
+        // Block 151
+        0, 0, 0, 15, 15, 0, 0, 0, 15, 15, 15, 0,
+        0, 0, 15, 15,
+        // Block 152
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+        0, 0, 491, 491,
+        // Block 153
+        354, 491, 491, 0, 0, 0, 491, 491, 491, 0, 522, 523,
+        524, 496, 0, 0,
+        // Block 154
+        15, 0, 0, 0, 0, 0, 0, 491, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 155
+        18, 18, 18, 14, 14, 14, 14, 14, 14, 4, 14, 0,
+        0, 0, 0, 0,
+        // Block 156
+        354, 491, 491, 491, 354, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 15, 15,
+        // Block 157
+        15, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 158
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+        495, 15, 354, 354,
+        // Block 159
+        354, 491, 491, 491, 491, 0, 354, 354, 525, 0, 354, 354,
+        354, 496, 0, 0,
+        // Block 160
+        0, 0, 0, 0, 0, 526, 527, 0, 15, 15, 15, 0,
+        0, 15, 0, 0,
+        // Block 161
+        0, 0, 0, 0, 0, 0, 0, 3, 18, 18, 18, 18,
+        18, 18, 18, 14,
+        // Block 162
+        15, 354, 491, 491, 3, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 15, 15,
+        // Block 163
+        15, 15, 15, 15, 0, 15, 15, 15, 15, 15, 0, 0,
+        495, 15, 491, 354,
+        // Block 164
+        528, 491, 491, 491, 491, 0, 354, 529, 530, 0, 531, 532,
+        354, 496, 0, 0,
+        // Block 165
+        0, 0, 0, 0, 0, 491, 491, 0, 0, 0, 0, 0,
+        0, 15, 15, 0,
+        // Block 166
+        0, 15, 15, 491, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 167
+        354, 354, 491, 491, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 15, 15,
+        // Block 168
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 496,
+        496, 15, 491, 491,
+        // Block 169
+        491, 354, 354, 354, 354, 0, 491, 491, 491, 0, 533, 534,
+        535, 496, 15, 14,
+        // Block 170
+        0, 0, 0, 0, 15, 15, 15, 491, 18, 18, 18, 18,
+        18, 18, 18, 15,
+        // Block 171
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 14, 15, 15,
+        15, 15, 15, 15,
+        // Block 172
+        0, 354, 491, 491, 0, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 173
+        15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 15, 15,
+        15, 15, 15, 15,
+        // Block 174
+        15, 15, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        0, 15, 0, 0,
+        // Block 175
+        15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 496, 0,
+        0, 0, 0, 491,
+        // Block 176
+        491, 491, 354, 354, 354, 0, 354, 0, 491, 491, 536, 491,
+        537, 538, 539, 491,
+        // Block 177
+        0, 0, 491, 491, 3, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 178
+        0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 179
+        15, 354, 15, 15, 354, 354, 354, 354, 540, 540, 496, 0,
+        0, 0, 0, 4,
+        // Block 180
+        15, 15, 15, 15, 15, 15, 345, 354, 541, 541, 541, 541,
+        354, 354, 354, 3,
+        // Block 181
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3,
+        0, 0, 0, 0,
+        // Block 182
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 183
+        0, 15, 15, 0, 15, 0, 15, 15, 15, 15, 15, 0,
+        15, 15, 15, 15,
+        // Block 184
+        15, 15, 15, 15, 0, 15, 0, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 185
+        15, 354, 15, 15, 354, 354, 354, 354, 542, 542, 496, 354,
+        354, 15, 0, 0,
+        // Block 186
+        15, 15, 15, 15, 15, 0, 345, 0, 543, 543, 543, 543,
+        354, 354, 354, 0,
+        // Block 187
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0,
+        15, 15, 15, 15,
+        // Block 188
+        15, 14, 14, 14, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3,
+        // Block 189
+        3, 3, 3, 14, 3, 14, 14, 14, 348, 348, 14, 14,
+        14, 14, 14, 14,
+        // Block 190
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18,
+        18, 18, 18, 18,
+        // Block 191
+        18, 18, 18, 18, 14, 348, 14, 348, 14, 349, 5, 6,
+        5, 6, 491, 491,
+        // Block 192
+        15, 15, 15, 544, 15, 15, 15, 15, 0, 15, 15, 15,
+        15, 545, 15, 15,
+        // Block 193
+        15, 15, 546, 15, 15, 15, 15, 547, 15, 15, 15, 15,
+        548, 15, 15, 15,
+        // Block 194
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 549, 15, 15,
+        15, 0, 0, 0,
+        // Block 195
+        0, 550, 551, 552, 553, 554, 555, 354, 556, 354, 551, 551,
+        551, 551, 354, 491,
+        // Block 196
+        551, 557, 346, 346, 496, 3, 346, 346, 15, 15, 15, 15,
+        15, 354, 354, 354,
+        // Block 197
+        354, 354, 354, 558, 354, 354, 354, 354, 0, 354, 354, 354,
+        354, 559, 354, 354,
+        // Block 198
+        354, 354, 560, 354, 354, 354, 354, 561, 354, 354, 354, 354,
+        562, 354, 354, 354,
+        // Block 199
+        354, 354, 354, 354, 354, 354, 354, 354, 354, 563, 354, 354,
+        354, 0, 14, 14,
+        // Block 200
+        14, 14, 14, 14, 14, 14, 348, 14, 14, 14, 14, 14,
+        14, 0, 14, 14,
+        // Block 201
+        3, 3, 3, 3, 3, 14, 14, 14, 14, 3, 3, 0,
+        0, 0, 0, 0,
+        // Block 202
+        15, 15, 15, 15, 15, 15, 564, 15, 15, 15, 15, 491,
+        491, 354, 354, 354,
+        // Block 203
+        354, 491, 354, 354, 354, 354, 354, 495, 491, 496, 496, 491,
+        491, 354, 354, 15,
+        // Block 204
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3,
+        3, 3, 3, 3,
+        // Block 205
+        15, 15, 15, 15, 15, 15, 491, 491, 354, 354, 15, 15,
+        15, 15, 354, 354,
+        // Block 206
+        354, 15, 491, 491, 491, 15, 15, 491, 491, 491, 491, 491,
+        491, 491, 15, 15,
+        // Block 207
+        15, 354, 354, 354, 354, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 208
+        15, 15, 354, 491, 491, 354, 354, 491, 491, 491, 491, 491,
+        491, 348, 15, 491,
+        // Block 209
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 491, 491,
+        491, 354, 14, 14,
+        // Block 210
+        565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 565, 565,
+        565, 565, 565, 565,
+        // Block 211
+        565, 565, 565, 565, 565, 565, 0, 565, 0, 0, 0, 0,
+        0, 565, 0, 0,
+        // Block 212
+        566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566,
+        566, 566, 566, 566,
+        // Block 213
+        566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 3,
+        345, 566, 566, 566,
+        // Block 214
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 15, 15,
+        15, 15, 0, 0,
+        // Block 215
+        15, 15, 15, 15, 15, 15, 15, 0, 15, 0, 15, 15,
+        15, 15, 0, 0,
+        // Block 216
+        15, 0, 15, 15, 15, 15, 0, 0, 15, 15, 15, 15,
+        15, 15, 15, 0,
+        // Block 217
+        15, 0, 15, 15, 15, 15, 0, 0, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 218
+        15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 219
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+        0, 346, 346, 346,
+        // Block 220
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 221
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 0, 0, 0,
+        // Block 222
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+        0, 0, 0, 0,
+        // Block 223
+        567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567, 567,
+        567, 567, 567, 567,
+        // Block 224
+        380, 380, 380, 380, 380, 380, 0, 0, 388, 388, 388, 388,
+        388, 388, 0, 0,
+        // Block 225
+        8, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 226
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 14, 3, 15,
+        // Block 227
+        2, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 228
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 5,
+        6, 0, 0, 0,
+        // Block 229
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 3,
+        3, 3, 568, 568,
+        // Block 230
+        568, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 231
+        15, 15, 354, 354, 496, 569, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 15,
+        // Block 232
+        15, 15, 354, 354, 569, 3, 3, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 233
+        15, 15, 354, 354, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 234
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 15, 15,
+        // Block 235
+        15, 0, 354, 354, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 236
+        15, 15, 15, 15, 354, 354, 491, 354, 354, 354, 354, 354,
+        354, 354, 491, 491,
+        // Block 237
+        491, 491, 491, 491, 491, 491, 354, 491, 491, 354, 354, 354,
+        354, 354, 354, 354,
+        // Block 238
+        354, 354, 496, 354, 3, 3, 3, 345, 3, 3, 3, 4,
+        15, 346, 0, 0,
+        // Block 239
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0,
+        0, 0, 0, 0,
+        // Block 240
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0,
+        0, 0, 0, 0,
+        // Block 241
+        3, 3, 3, 3, 3, 3, 8, 3, 3, 3, 3, 354,
+        354, 354, 17, 354,
+        // Block 242
+        15, 15, 15, 345, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 243
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 244
+        15, 15, 15, 15, 15, 354, 354, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 245
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 456, 15, 0,
+        0, 0, 0, 0,
+        // Block 246
+        15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 247
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 0,
+        // Block 248
+        354, 354, 354, 491, 491, 491, 491, 354, 354, 491, 491, 491,
+        0, 0, 0, 0,
+        // Block 249
+        491, 491, 354, 491, 491, 491, 491, 491, 491, 455, 346, 348,
+        0, 0, 0, 0,
+        // Block 250
+        14, 0, 0, 0, 3, 3, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9,
+        // Block 251
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 0, 0,
+        // Block 252
+        15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 253
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        0, 0, 0, 0,
+        // Block 254
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+        0, 0, 0, 0,
+        // Block 255
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 0,
+        0, 0, 14, 14,
+        // Block 256
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 257
+        15, 15, 15, 15, 15, 15, 15, 346, 348, 491, 491, 354,
+        0, 0, 3, 3,
+        // Block 258
+        15, 15, 15, 15, 15, 491, 354, 491, 354, 354, 354, 354,
+        354, 354, 354, 0,
+        // Block 259
+        496, 491, 354, 491, 491, 354, 354, 354, 354, 354, 354, 354,
+        354, 491, 491, 491,
+        // Block 260
+        491, 491, 491, 354, 354, 346, 346, 346, 346, 346, 346, 346,
+        346, 0, 0, 348,
+        // Block 261
+        3, 3, 3, 3, 3, 3, 3, 345, 3, 3, 3, 3,
+        3, 3, 0, 0,
+        // Block 262
+        346, 346, 346, 346, 346, 348, 348, 348, 348, 348, 348, 346,
+        346, 348, 415, 348,
+        // Block 263
+        348, 346, 346, 348, 348, 346, 346, 346, 346, 346, 348, 346,
+        346, 346, 346, 0,
+        // Block 264
+        354, 354, 354, 354, 491, 15, 570, 15, 571, 15, 572, 15,
+        573, 15, 574, 15,
+        // Block 265
+        15, 15, 575, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 266
+        15, 15, 15, 15, 495, 491, 354, 354, 354, 354, 354, 576,
+        354, 577, 491, 491,
+        // Block 267
+        578, 579, 354, 580, 569, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 3, 3,
+        // Block 268
+        3, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 346,
+        348, 346, 346, 346,
+        // Block 269
+        346, 346, 346, 346, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 3, 3, 3,
+        // Block 270
+        354, 354, 491, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 271
+        15, 491, 354, 354, 354, 354, 491, 491, 354, 354, 569, 496,
+        354, 354, 15, 15,
+        // Block 272
+        15, 15, 15, 15, 15, 15, 495, 491, 354, 354, 491, 491,
+        491, 354, 491, 354,
+        // Block 273
+        354, 354, 569, 569, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3,
+        // Block 274
+        15, 15, 15, 15, 491, 491, 491, 491, 491, 491, 491, 491,
+        354, 354, 354, 354,
+        // Block 275
+        354, 354, 354, 354, 491, 491, 354, 495, 0, 0, 0, 3,
+        3, 3, 3, 3,
+        // Block 276
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0,
+        0, 15, 15, 15,
+        // Block 277
+        15, 15, 15, 15, 15, 15, 15, 15, 345, 345, 345, 345,
+        345, 345, 3, 3,
+        // Block 278
+        581, 582, 583, 584, 584, 585, 586, 587, 588, 91, 92, 0,
+        0, 0, 0, 0,
+        // Block 279
+        589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589,
+        589, 589, 589, 589,
+        // Block 280
+        589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 589, 0,
+        0, 589, 589, 589,
+        // Block 281
+        3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 282
+        346, 346, 346, 3, 351, 348, 348, 348, 348, 348, 346, 346,
+        348, 348, 348, 348,
+        // Block 283
+        346, 491, 351, 351, 351, 351, 351, 351, 351, 15, 15, 15,
+        15, 348, 15, 15,
+        // Block 284
+        15, 15, 15, 15, 346, 15, 15, 491, 346, 346, 15, 0,
+        0, 0, 0, 0,
+        // Block 285
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        345, 345, 345, 345,
+        // Block 286
+        345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 127,
+        127, 127, 127, 127,
+        // Block 287
+        127, 127, 127, 127, 127, 127, 127, 127, 345, 590, 127, 127,
+        127, 591, 127, 127,
+        // Block 288
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 592, 127,
+        // Block 289
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 345,
+        345, 345, 345, 345,
+        // Block 290
+        346, 346, 348, 346, 346, 346, 346, 346, 346, 346, 348, 346,
+        346, 356, 593, 348,
+        // Block 291
+        350, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+        346, 346, 346, 346,
+        // Block 292
+        346, 346, 346, 346, 346, 346, 347, 456, 456, 348, 594, 346,
+        355, 348, 346, 348,
+        // Block 293
+        595, 596, 597, 598, 599, 600, 601, 602, 603, 604, 605, 606,
+        607, 608, 609, 610,
+        // Block 294
+        611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622,
+        623, 624, 625, 626,
+        // Block 295
+        627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638,
+        639, 640, 641, 642,
+        // Block 296
+        643, 644, 645, 646, 647, 648, 649, 650, 651, 652, 653, 654,
+        655, 656, 657, 658,
+        // Block 297
+        659, 660, 661, 662, 663, 664, 665, 666, 667, 668, 669, 670,
+        671, 672, 673, 674,
+        // Block 298
+        675, 676, 677, 678, 679, 680, 681, 682, 683, 684, 685, 686,
+        687, 688, 689, 690,
+        // Block 299
+        691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702,
+        703, 704, 705, 706,
+        // Block 300
+        707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718,
+        719, 720, 721, 722,
+        // Block 301
+        723, 724, 725, 726, 727, 728, 729, 730, 731, 732, 733, 734,
+        735, 736, 737, 738,
+        // Block 302
+        739, 740, 741, 742, 743, 744, 745, 746, 747, 748, 749, 750,
+        127, 127, 751, 127,
+        // Block 303
+        752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763,
+        764, 765, 766, 767,
+        // Block 304
+        768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779,
+        780, 781, 782, 783,
+        // Block 305
+        784, 785, 786, 787, 788, 789, 790, 791, 792, 793, 794, 795,
+        796, 797, 798, 799,
+        // Block 306
+        800, 801, 802, 803, 804, 805, 806, 807, 808, 809, 810, 811,
+        812, 813, 814, 815,
+        // Block 307
+        816, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827,
+        828, 829, 830, 831,
+        // Block 308
+        832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 91, 92,
+        91, 92, 91, 92,
+        // Block 309
+        842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853,
+        854, 855, 856, 857,
+        // Block 310
+        858, 859, 860, 861, 862, 863, 0, 0, 864, 865, 866, 867,
+        868, 869, 0, 0,
+        // Block 311
+        870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881,
+        882, 883, 884, 885,
+        // Block 312
+        886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897,
+        898, 899, 900, 901,
+        // Block 313
+        902, 903, 904, 905, 906, 907, 0, 0, 908, 909, 910, 911,
+        912, 913, 0, 0,
+        // Block 314
+        914, 915, 916, 917, 918, 919, 920, 921, 0, 922, 0, 923,
+        0, 924, 0, 925,
+        // Block 315
+        926, 927, 928, 929, 930, 931, 932, 933, 934, 935, 936, 937,
+        938, 939, 940, 941,
+        // Block 316
+        942, 943, 944, 945, 946, 945, 947, 948, 949, 950, 951, 952,
+        953, 954, 0, 0,
+        // Block 317
+        955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966,
+        967, 968, 969, 970,
+        // Block 318
+        971, 972, 973, 974, 975, 976, 977, 978, 979, 980, 981, 982,
+        983, 984, 985, 986,
+        // Block 319
+        987, 988, 989, 990, 991, 992, 993, 994, 995, 996, 997, 998,
+        999, 1000, 1001, 1002,
+        // Block 320
+        1003, 1004, 1005, 1006, 1007, 0, 1008, 1009, 1010, 1011, 1012, 1013,
+        1014, 11, 1015, 11,
+        // Block 321
+        11, 1016, 1017, 1018, 1019, 0, 1020, 1021, 1022, 1023, 1024, 1023,
+        1025, 1026, 1027, 1028,
+        // Block 322
+        1029, 1030, 1031, 1032, 0, 0, 1033, 1034, 1035, 1036, 1037, 1038,
+        0, 1039, 1040, 1041,
+        // Block 323
+        1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053,
+        1054, 1055, 11, 11,
+        // Block 324
+        0, 0, 1056, 1057, 1058, 0, 1059, 1060, 1061, 1062, 1063, 1064,
+        1065, 11, 11, 0,
+        // Block 325
+        2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 17,
+        17, 17, 17, 17,
+        // Block 326
+        8, 8, 8, 8, 8, 8, 3, 3, 16, 20, 5, 16,
+        16, 20, 5, 16,
+        // Block 327
+        3, 3, 3, 3, 3, 3, 3, 3, 1066, 1067, 17, 17,
+        17, 17, 17, 2,
+        // Block 328
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 16, 20, 3,
+        3, 3, 3, 12,
+        // Block 329
+        12, 3, 3, 3, 7, 5, 6, 3, 3, 3, 3, 3,
+        3, 3, 3, 3,
+        // Block 330
+        3, 3, 7, 3, 12, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 2,
+        // Block 331
+        17, 17, 17, 17, 17, 0, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17,
+        // Block 332
+        18, 345, 0, 0, 18, 18, 18, 18, 18, 18, 7, 7,
+        7, 5, 6, 345,
+        // Block 333
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 7, 7,
+        7, 5, 6, 0,
+        // Block 334
+        345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345,
+        345, 0, 0, 0,
+        // Block 335
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4,
+        // Block 336
+        4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 337
+        346, 346, 351, 351, 346, 346, 346, 346, 351, 351, 351, 346,
+        346, 415, 415, 415,
+        // Block 338
+        415, 346, 415, 415, 415, 351, 351, 346, 348, 346, 351, 351,
+        348, 348, 348, 348,
+        // Block 339
+        346, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 340
+        14, 14, 383, 14, 14, 14, 14, 383, 14, 14, 127, 383,
+        383, 383, 127, 127,
+        // Block 341
+        383, 383, 383, 127, 14, 383, 14, 14, 7, 383, 383, 383,
+        383, 383, 14, 14,
+        // Block 342
+        14, 14, 14, 14, 383, 14, 1068, 14, 383, 14, 1069, 1070,
+        383, 383, 14, 127,
+        // Block 343
+        383, 383, 1071, 383, 127, 15, 15, 15, 15, 127, 14, 14,
+        127, 127, 383, 383,
+        // Block 344
+        7, 7, 7, 7, 7, 383, 127, 127, 127, 127, 14, 7,
+        14, 14, 1072, 14,
+        // Block 345
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 346
+        1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+        1073, 1073, 1073, 1073,
+        // Block 347
+        1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074,
+        1074, 1074, 1074, 1074,
+        // Block 348
+        568, 568, 568, 91, 92, 568, 568, 568, 568, 18, 14, 14,
+        0, 0, 0, 0,
+        // Block 349
+        7, 7, 7, 7, 7, 14, 14, 14, 14, 14, 1075, 1076,
+        14, 14, 14, 14,
+        // Block 350
+        7, 14, 14, 7, 14, 14, 7, 14, 14, 14, 14, 14,
+        14, 14, 1077, 14,
+        // Block 351
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 1078, 1079, 1080,
+        // Block 352
+        14, 14, 7, 14, 7, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 353
+        14, 14, 14, 14, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7,
+        // Block 354
+        7, 7, 7, 7, 1081, 7, 7, 7, 7, 1082, 7, 7,
+        1083, 7, 7, 7,
+        // Block 355
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 7, 7, 7,
+        // Block 356
+        7, 7, 7, 7, 1084, 7, 1085, 7, 7, 7, 7, 7,
+        7, 7, 7, 7,
+        // Block 357
+        7, 1086, 7, 7, 1087, 7, 7, 1088, 7, 1089, 7, 7,
+        7, 7, 7, 7,
+        // Block 358
+        1090, 7, 1091, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        7, 1092, 1093, 1094,
+        // Block 359
+        1095, 1096, 7, 7, 1097, 1098, 7, 7, 1099, 1100, 7, 7,
+        7, 7, 7, 7,
+        // Block 360
+        1101, 1102, 7, 7, 1103, 1104, 7, 7, 1105, 1106, 7, 7,
+        7, 7, 7, 7,
+        // Block 361
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        1107, 1108, 1109, 1110,
+        // Block 362
+        1111, 1112, 1113, 1114, 7, 7, 7, 7, 7, 7, 1115, 1116,
+        1117, 1118, 7, 7,
+        // Block 363
+        14, 14, 14, 14, 14, 14, 14, 14, 5, 6, 5, 6,
+        14, 14, 14, 14,
+        // Block 364
+        7, 7, 14, 14, 14, 14, 14, 14, 14, 5, 6, 14,
+        14, 14, 14, 14,
+        // Block 365
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        7, 14, 14, 14,
+        // Block 366
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 7,
+        7, 7, 7, 7,
+        // Block 367
+        7, 7, 7, 7, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 368
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        7, 7, 7, 7,
+        // Block 369
+        7, 7, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 370
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0,
+        0, 0, 0, 0,
+        // Block 371
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        14, 14, 14, 14,
+        // Block 372
+        14, 14, 14, 14, 14, 14, 1119, 1119, 1119, 1119, 1119, 1119,
+        1119, 1119, 1119, 1119,
+        // Block 373
+        1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119,
+        1119, 1119, 1119, 1119,
+        // Block 374
+        1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120,
+        1120, 1120, 1120, 1120,
+        // Block 375
+        1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 1120, 18, 18,
+        18, 18, 18, 18,
+        // Block 376
+        14, 14, 14, 14, 14, 14, 14, 7, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 377
+        14, 7, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 378
+        14, 14, 14, 14, 14, 14, 14, 14, 7, 7, 7, 7,
+        7, 7, 7, 7,
+        // Block 379
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 7,
+        // Block 380
+        14, 14, 14, 14, 14, 14, 14, 14, 5, 6, 5, 6,
+        5, 6, 5, 6,
+        // Block 381
+        5, 6, 5, 6, 5, 6, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 382
+        18, 18, 18, 18, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 383
+        7, 7, 7, 7, 7, 5, 6, 7, 7, 7, 7, 7,
+        7, 7, 7, 7,
+        // Block 384
+        7, 7, 7, 7, 7, 7, 5, 6, 5, 6, 5, 6,
+        5, 6, 5, 6,
+        // Block 385
+        7, 7, 7, 5, 6, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5,
+        // Block 386
+        6, 5, 6, 5, 6, 5, 6, 5, 6, 7, 7, 7,
+        7, 7, 7, 7,
+        // Block 387
+        7, 7, 7, 7, 7, 7, 7, 7, 5, 6, 5, 6,
+        7, 7, 7, 7,
+        // Block 388
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        5, 6, 7, 7,
+        // Block 389
+        7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+        1121, 7, 7, 7,
+        // Block 390
+        7, 7, 7, 7, 7, 14, 14, 7, 7, 7, 7, 7,
+        7, 14, 14, 14,
+        // Block 391
+        14, 14, 14, 14, 0, 0, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 392
+        14, 14, 14, 14, 14, 14, 0, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 393
+        91, 92, 1122, 1123, 1124, 1125, 1126, 91, 92, 91, 92, 91,
+        92, 1127, 1128, 1129,
+        // Block 394
+        1130, 127, 91, 92, 127, 91, 92, 127, 127, 127, 127, 127,
+        345, 345, 1131, 1131,
+        // Block 395
+        91, 92, 91, 92, 127, 14, 14, 14, 14, 14, 14, 91,
+        92, 91, 92, 346,
+        // Block 396
+        346, 346, 91, 92, 0, 0, 0, 0, 0, 3, 3, 3,
+        3, 18, 3, 3,
+        // Block 397
+        1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132, 1132,
+        1132, 1132, 1132, 1132,
+        // Block 398
+        1132, 1132, 1132, 1132, 1132, 1132, 0, 1132, 0, 0, 0, 0,
+        0, 1132, 0, 0,
+        // Block 399
+        15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0,
+        0, 0, 0, 345,
+        // Block 400
+        3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 496,
+        // Block 401
+        15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 402
+        15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 15,
+        15, 15, 15, 0,
+        // Block 403
+        3, 3, 16, 20, 16, 20, 3, 3, 3, 16, 20, 3,
+        16, 20, 3, 3,
+        // Block 404
+        3, 3, 3, 3, 3, 3, 3, 8, 3, 3, 8, 3,
+        16, 20, 3, 3,
+        // Block 405
+        16, 20, 5, 6, 5, 6, 5, 6, 5, 6, 3, 3,
+        3, 3, 3, 345,
+        // Block 406
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 8, 8,
+        3, 3, 3, 3,
+        // Block 407
+        8, 3, 5, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3,
+        // Block 408
+        14, 14, 3, 3, 3, 5, 6, 5, 6, 5, 6, 5,
+        6, 8, 0, 0,
+        // Block 409
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 14,
+        14, 14, 14, 14,
+        // Block 410
+        14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 411
+        14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 412
+        2, 3, 3, 3, 14, 345, 15, 568, 5, 6, 5, 6,
+        5, 6, 5, 6,
+        // Block 413
+        5, 6, 14, 14, 5, 6, 5, 6, 5, 6, 5, 6,
+        8, 5, 6, 6,
+        // Block 414
+        14, 568, 568, 568, 568, 568, 568, 568, 568, 568, 594, 456,
+        347, 455, 1133, 1133,
+        // Block 415
+        8, 345, 345, 345, 345, 345, 14, 14, 568, 568, 568, 345,
+        15, 3, 14, 14,
+        // Block 416
+        0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        1134, 15, 1135, 15,
+        // Block 417
+        1136, 15, 1137, 15, 1138, 15, 1139, 15, 1140, 15, 1141, 15,
+        1142, 15, 1143, 15,
+        // Block 418
+        1144, 15, 1145, 15, 15, 1146, 15, 1147, 15, 1148, 15, 15,
+        15, 15, 15, 15,
+        // Block 419
+        1149, 1150, 15, 1151, 1152, 15, 1153, 1154, 15, 1155, 1156, 15,
+        1157, 1158, 15, 15,
+        // Block 420
+        15, 15, 15, 15, 1159, 15, 15, 0, 0, 1160, 1160, 11,
+        11, 345, 1161, 15,
+        // Block 421
+        8, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        1162, 15, 1163, 15,
+        // Block 422
+        1164, 15, 1165, 15, 1166, 15, 1167, 15, 1168, 15, 1169, 15,
+        1170, 15, 1171, 15,
+        // Block 423
+        1172, 15, 1173, 15, 15, 1174, 15, 1175, 15, 1176, 15, 15,
+        15, 15, 15, 15,
+        // Block 424
+        1177, 1178, 15, 1179, 1180, 15, 1181, 1182, 15, 1183, 1184, 15,
+        1185, 1186, 15, 15,
+        // Block 425
+        15, 15, 15, 15, 1187, 15, 15, 1188, 1189, 1190, 1191, 3,
+        345, 345, 1192, 15,
+        // Block 426
+        0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 427
+        14, 14, 18, 18, 18, 18, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 428
+        14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 14,
+        // Block 429
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 0,
+        // Block 430
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 14, 14,
+        14, 14, 14, 14,
+        // Block 431
+        14, 14, 14, 14, 14, 14, 14, 14, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 432
+        14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 433
+        15, 15, 15, 15, 15, 345, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 434
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 0, 0,
+        // Block 435
+        14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 436
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        345, 3, 3, 3,
+        // Block 437
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 15, 15,
+        0, 0, 0, 0,
+        // Block 438
+        91, 92, 91, 92, 91, 92, 91, 92, 91, 92, 91, 92,
+        91, 92, 15, 346,
+        // Block 439
+        415, 415, 415, 3, 346, 346, 346, 346, 346, 346, 346, 346,
+        346, 346, 3, 345,
+        // Block 440
+        91, 92, 91, 92, 91, 92, 91, 92, 91, 92, 91, 92,
+        345, 345, 346, 346,
+        // Block 441
+        15, 15, 15, 15, 15, 15, 568, 568, 568, 568, 568, 568,
+        568, 568, 568, 568,
+        // Block 442
+        346, 346, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 443
+        11, 11, 11, 11, 11, 11, 11, 345, 345, 345, 345, 345,
+        345, 345, 345, 345,
+        // Block 444
+        11, 11, 91, 92, 91, 92, 91, 92, 91, 92, 91, 92,
+        91, 92, 91, 92,
+        // Block 445
+        127, 127, 91, 92, 91, 92, 91, 92, 91, 92, 91, 92,
+        91, 92, 91, 92,
+        // Block 446
+        345, 127, 127, 127, 127, 127, 127, 127, 127, 91, 92, 91,
+        92, 1193, 91, 92,
+        // Block 447
+        91, 92, 91, 92, 91, 92, 91, 92, 345, 11, 11, 91,
+        92, 1194, 127, 15,
+        // Block 448
+        91, 92, 91, 92, 1195, 127, 91, 92, 91, 92, 91, 92,
+        91, 92, 91, 92,
+        // Block 449
+        91, 92, 91, 92, 91, 92, 91, 92, 91, 92, 1196, 1197,
+        1198, 1199, 1196, 127,
+        // Block 450
+        1200, 1201, 1202, 1203, 91, 92, 91, 92, 91, 92, 91, 92,
+        91, 92, 91, 92,
+        // Block 451
+        91, 92, 91, 92, 1204, 1205, 1206, 91, 92, 91, 92, 1207,
+        91, 92, 0, 0,
+        // Block 452
+        91, 92, 0, 127, 0, 127, 91, 92, 91, 92, 91, 92,
+        1208, 0, 0, 0,
+        // Block 453
+        0, 0, 345, 345, 345, 91, 92, 15, 345, 345, 127, 15,
+        15, 15, 15, 15,
+        // Block 454
+        15, 15, 354, 15, 15, 15, 496, 15, 15, 15, 15, 354,
+        15, 15, 15, 15,
+        // Block 455
+        15, 15, 15, 491, 491, 354, 354, 491, 14, 14, 14, 14,
+        496, 0, 0, 0,
+        // Block 456
+        18, 18, 18, 18, 18, 18, 14, 14, 4, 14, 0, 0,
+        0, 0, 0, 0,
+        // Block 457
+        15, 15, 15, 15, 3, 3, 3, 3, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 458
+        491, 491, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 459
+        15, 15, 15, 15, 491, 491, 491, 491, 491, 491, 491, 491,
+        491, 491, 491, 491,
+        // Block 460
+        491, 491, 491, 491, 496, 354, 0, 0, 0, 0, 0, 0,
+        0, 0, 3, 3,
+        // Block 461
+        346, 346, 15, 15, 15, 15, 15, 15, 3, 3, 3, 15,
+        3, 15, 15, 354,
+        // Block 462
+        15, 15, 15, 15, 15, 15, 354, 354, 354, 354, 354, 348,
+        348, 348, 3, 3,
+        // Block 463
+        15, 15, 15, 15, 15, 15, 15, 354, 354, 354, 354, 354,
+        354, 354, 354, 354,
+        // Block 464
+        354, 354, 491, 569, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3,
+        // Block 465
+        15, 15, 15, 495, 491, 491, 354, 354, 354, 354, 491, 491,
+        354, 354, 491, 491,
+        // Block 466
+        569, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 0, 345,
+        // Block 467
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0,
+        0, 0, 3, 3,
+        // Block 468
+        15, 15, 15, 15, 15, 354, 345, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 469
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 15, 15,
+        15, 15, 15, 0,
+        // Block 470
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 354, 354, 354,
+        354, 354, 354, 491,
+        // Block 471
+        491, 354, 354, 491, 491, 354, 354, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 472
+        15, 15, 15, 354, 15, 15, 15, 15, 15, 15, 15, 15,
+        354, 491, 0, 0,
+        // Block 473
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0,
+        3, 3, 3, 3,
+        // Block 474
+        345, 15, 15, 15, 15, 15, 15, 14, 14, 14, 15, 491,
+        354, 491, 15, 15,
+        // Block 475
+        346, 15, 346, 346, 348, 15, 15, 346, 346, 15, 15, 15,
+        15, 15, 346, 346,
+        // Block 476
+        15, 346, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 477
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15,
+        15, 345, 3, 3,
+        // Block 478
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 491,
+        354, 354, 491, 491,
+        // Block 479
+        3, 3, 15, 345, 345, 491, 496, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 480
+        0, 15, 15, 15, 15, 15, 15, 0, 0, 15, 15, 15,
+        15, 15, 15, 0,
+        // Block 481
+        0, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 482
+        127, 127, 127, 1209, 127, 127, 127, 127, 127, 127, 127, 11,
+        345, 345, 345, 345,
+        // Block 483
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 345, 11, 11,
+        0, 0, 0, 0,
+        // Block 484
+        1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210,
+        1210, 1210, 1210, 1210,
+        // Block 485
+        15, 15, 15, 491, 491, 354, 491, 491, 354, 491, 491, 3,
+        491, 496, 0, 0,
+        // Block 486
+        15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 487
+        15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 15,
+        15, 15, 15, 15,
+        // Block 488
+        1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+        1211, 1211, 1211, 1211,
+        // Block 489
+        1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212,
+        1212, 1212, 1212, 1212,
+        // Block 490
+        1213, 1214, 1215, 1216, 1217, 1218, 1219, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 491
+        0, 0, 0, 1220, 1221, 1222, 1223, 1224, 0, 0, 0, 0,
+        0, 1225, 1226, 1227,
+        // Block 492
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 7, 1228, 1229,
+        1230, 1231, 1232, 1233,
+        // Block 493
+        1234, 1235, 1236, 1237, 1238, 1239, 1240, 0, 1241, 1242, 1243, 1244,
+        1245, 0, 1246, 0,
+        // Block 494
+        1247, 1248, 0, 1249, 1250, 0, 1251, 1252, 1253, 1254, 1255, 1256,
+        1257, 1258, 1259, 15,
+        // Block 495
+        15, 15, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+        11, 11, 11, 11,
+        // Block 496
+        11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 497
+        0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 498
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 6, 5,
+        // Block 499
+        0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 500
+        15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0,
+        0, 0, 0, 14,
+        // Block 501
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        4, 14, 14, 14,
+        // Block 502
+        354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+        354, 354, 354, 354,
+        // Block 503
+        3, 3, 3, 3, 3, 3, 3, 5, 6, 3, 0, 0,
+        0, 0, 0, 0,
+        // Block 504
+        346, 346, 346, 346, 346, 346, 346, 348, 348, 348, 348, 348,
+        348, 348, 346, 346,
+        // Block 505
+        3, 8, 8, 12, 12, 5, 6, 5, 6, 5, 6, 5,
+        6, 5, 6, 5,
+        // Block 506
+        6, 5, 6, 5, 6, 3, 3, 5, 6, 3, 3, 3,
+        3, 12, 12, 12,
+        // Block 507
+        3, 3, 3, 0, 3, 3, 3, 3, 8, 5, 6, 5,
+        6, 5, 6, 3,
+        // Block 508
+        3, 3, 7, 8, 7, 7, 7, 0, 3, 4, 3, 3,
+        0, 0, 0, 0,
+        // Block 509
+        15, 15, 15, 15, 15, 0, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 510
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 0, 17,
+        // Block 511
+        0, 3, 3, 3, 4, 3, 3, 3, 5, 6, 3, 7,
+        3, 8, 3, 3,
+        // Block 512
+        13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 5,
+        7, 6, 7, 5,
+        // Block 513
+        6, 3, 5, 6, 3, 3, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 514
+        345, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 515
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 345, 345,
+        // Block 516
+        0, 0, 15, 15, 15, 15, 15, 15, 0, 0, 15, 15,
+        15, 15, 15, 15,
+        // Block 517
+        0, 0, 15, 15, 15, 15, 15, 15, 0, 0, 15, 15,
+        15, 0, 0, 0,
+        // Block 518
+        4, 4, 7, 11, 14, 4, 4, 0, 14, 7, 7, 7,
+        7, 14, 14, 0,
+        // Block 519
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17,
+        14, 14, 0, 0,
+        // Block 520
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        0, 15, 15, 15,
+        // Block 521
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+        15, 15, 0, 15,
+        // Block 522
+        3, 3, 3, 0, 0, 0, 0, 18, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 523
+        18, 18, 18, 18, 0, 0, 0, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 524
+        568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568,
+        568, 568, 568, 568,
+        // Block 525
+        568, 568, 568, 568, 568, 18, 18, 18, 18, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 526
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 18, 18,
+        14, 14, 14, 0,
+        // Block 527
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 0, 0, 0,
+        // Block 528
+        14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 529
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 348, 0, 0,
+        // Block 530
+        348, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 531
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        0, 0, 0, 0,
+        // Block 532
+        18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 15, 15, 15,
+        // Block 533
+        15, 568, 15, 15, 15, 15, 15, 15, 15, 15, 568, 0,
+        0, 0, 0, 0,
+        // Block 534
+        15, 15, 15, 15, 15, 15, 346, 346, 346, 346, 346, 0,
+        0, 0, 0, 0,
+        // Block 535
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 0, 3,
+        // Block 536
+        15, 15, 15, 15, 0, 0, 0, 0, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 537
+        3, 568, 568, 568, 568, 568, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 538
+        1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260,
+        1260, 1260, 1260, 1260,
+        // Block 539
+        1260, 1260, 1260, 1260, 1260, 1260, 1260, 1260, 1261, 1261, 1261, 1261,
+        1261, 1261, 1261, 1261,
+        // Block 540
+        1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+        1261, 1261, 1261, 1261,
+        // Block 541
+        1260, 1260, 1260, 1260, 0, 0, 0, 0, 1261, 1261, 1261, 1261,
+        1261, 1261, 1261, 1261,
+        // Block 542
+        1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261, 1261,
+        0, 0, 0, 0,
+        // Block 543
+        15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 544
+        15, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3,
+        // Block 545
+        1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 1262, 0,
+        1262, 1262, 1262, 1262,
+        // Block 546
+        1262, 1262, 1262, 0, 1262, 1262, 0, 1263, 1263, 1263, 1263, 1263,
+        1263, 1263, 1263, 1263,
+        // Block 547
+        1263, 1263, 0, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 1263,
+        1263, 1263, 1263, 1263,
+        // Block 548
+        1263, 1263, 0, 1263, 1263, 1263, 1263, 1263, 1263, 1263, 0, 1263,
+        1263, 0, 0, 0,
+        // Block 549
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 1264, 15, 15,
+        15, 15, 15, 15,
+        // Block 550
+        15, 15, 15, 15, 1265, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 551
+        345, 345, 345, 345, 345, 345, 0, 345, 345, 345, 345, 345,
+        345, 345, 345, 345,
+        // Block 552
+        345, 0, 345, 345, 345, 345, 345, 345, 345, 345, 345, 0,
+        0, 0, 0, 0,
+        // Block 553
+        15, 15, 15, 15, 15, 15, 0, 0, 15, 0, 15, 15,
+        15, 15, 15, 15,
+        // Block 554
+        15, 15, 15, 15, 15, 15, 0, 15, 15, 0, 0, 0,
+        15, 0, 0, 15,
+        // Block 555
+        15, 15, 15, 15, 15, 15, 0, 3, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 556
+        15, 15, 15, 15, 15, 15, 15, 14, 14, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 557
+        0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 558
+        15, 15, 15, 0, 15, 15, 0, 0, 0, 0, 0, 18,
+        18, 18, 18, 18,
+        // Block 559
+        15, 15, 15, 15, 15, 15, 18, 18, 18, 18, 18, 18,
+        0, 0, 0, 3,
+        // Block 560
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+        0, 0, 0, 3,
+        // Block 561
+        15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0,
+        18, 18, 15, 15,
+        // Block 562
+        0, 0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 563
+        15, 354, 354, 354, 0, 354, 354, 0, 0, 0, 0, 0,
+        354, 348, 354, 346,
+        // Block 564
+        15, 15, 15, 15, 0, 15, 15, 15, 0, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 565
+        15, 15, 15, 15, 15, 15, 0, 0, 346, 351, 348, 0,
+        0, 0, 0, 496,
+        // Block 566
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 567
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 568
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 18, 18, 3,
+        // Block 569
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 18, 18, 18,
+        // Block 570
+        15, 15, 15, 15, 15, 15, 15, 15, 14, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 571
+        15, 15, 15, 15, 15, 346, 348, 0, 0, 0, 0, 18,
+        18, 18, 18, 18,
+        // Block 572
+        3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 573
+        15, 15, 15, 15, 15, 15, 0, 0, 0, 3, 3, 3,
+        3, 3, 3, 3,
+        // Block 574
+        15, 15, 15, 15, 15, 15, 0, 0, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 575
+        15, 15, 15, 0, 0, 0, 0, 0, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 576
+        15, 15, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3,
+        3, 0, 0, 0,
+        // Block 577
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 578
+        1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266,
+        1266, 1266, 1266, 1266,
+        // Block 579
+        1266, 1266, 1266, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 580
+        1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267,
+        1267, 1267, 1267, 1267,
+        // Block 581
+        1267, 1267, 1267, 0, 0, 0, 0, 0, 0, 0, 18, 18,
+        18, 18, 18, 18,
+        // Block 582
+        15, 15, 15, 15, 346, 346, 346, 346, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 583
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 15, 15,
+        15, 15, 345, 15,
+        // Block 584
+        10, 10, 10, 10, 10, 10, 0, 0, 0, 346, 346, 346,
+        346, 346, 8, 345,
+        // Block 585
+        13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0,
+        0, 0, 7, 7,
+        // Block 586
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 0,
+        // Block 587
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 346,
+        346, 8, 0, 0,
+        // Block 588
+        15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 589
+        0, 0, 15, 15, 15, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 590
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        354, 348, 348, 348,
+        // Block 591
+        18, 18, 18, 18, 18, 18, 18, 15, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 592
+        15, 15, 15, 15, 15, 15, 348, 348, 346, 346, 346, 348,
+        346, 348, 348, 348,
+        // Block 593
+        348, 18, 18, 18, 18, 3, 3, 3, 3, 3, 0, 0,
+        0, 0, 0, 0,
+        // Block 594
+        15, 15, 346, 348, 346, 348, 3, 3, 3, 3, 0, 0,
+        0, 0, 0, 0,
+        // Block 595
+        15, 15, 15, 15, 15, 18, 18, 18, 18, 18, 18, 18,
+        0, 0, 0, 0,
+        // Block 596
+        491, 354, 491, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 597
+        15, 15, 15, 15, 15, 15, 15, 15, 354, 354, 354, 354,
+        354, 354, 354, 354,
+        // Block 598
+        354, 354, 354, 354, 354, 354, 496, 3, 3, 3, 3, 3,
+        3, 3, 0, 0,
+        // Block 599
+        18, 18, 18, 18, 18, 18, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9,
+        // Block 600
+        496, 15, 15, 354, 354, 15, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 496,
+        // Block 601
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 1268, 15,
+        1269, 15, 15, 15,
+        // Block 602
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 1270,
+        15, 15, 15, 15,
+        // Block 603
+        491, 491, 491, 354, 354, 354, 354, 491, 491, 496, 495, 3,
+        3, 17, 3, 3,
+        // Block 604
+        3, 3, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 17, 0, 0,
+        // Block 605
+        346, 346, 346, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 606
+        15, 15, 15, 15, 15, 15, 15, 354, 354, 354, 354, 354,
+        491, 354, 1271, 1272,
+        // Block 607
+        354, 354, 354, 496, 496, 0, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9,
+        // Block 608
+        3, 3, 3, 3, 15, 491, 491, 15, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 609
+        15, 15, 15, 495, 3, 3, 15, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 610
+        15, 15, 15, 491, 491, 491, 354, 354, 354, 354, 354, 354,
+        354, 354, 354, 491,
+        // Block 611
+        569, 15, 15, 15, 15, 3, 3, 3, 3, 354, 495, 354,
+        354, 3, 491, 354,
+        // Block 612
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 15, 3,
+        15, 3, 3, 3,
+        // Block 613
+        0, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 614
+        18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 615
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        491, 491, 491, 354,
+        // Block 616
+        354, 354, 491, 491, 354, 569, 495, 354, 3, 3, 3, 3,
+        3, 3, 354, 15,
+        // Block 617
+        15, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 618
+        15, 15, 15, 15, 15, 15, 15, 0, 15, 0, 15, 15,
+        15, 15, 0, 15,
+        // Block 619
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 0, 15,
+        // Block 620
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 3, 0, 0,
+        0, 0, 0, 0,
+        // Block 621
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 354,
+        // Block 622
+        491, 491, 491, 354, 354, 354, 354, 354, 354, 495, 496, 0,
+        0, 0, 0, 0,
+        // Block 623
+        354, 354, 491, 491, 0, 15, 15, 15, 15, 15, 15, 15,
+        15, 0, 0, 15,
+        // Block 624
+        15, 0, 15, 15, 0, 15, 15, 15, 15, 15, 0, 495,
+        495, 15, 491, 491,
+        // Block 625
+        354, 491, 491, 491, 491, 0, 0, 491, 491, 0, 0, 1273,
+        1274, 569, 0, 0,
+        // Block 626
+        15, 0, 0, 0, 0, 0, 0, 491, 0, 0, 0, 0,
+        0, 15, 15, 15,
+        // Block 627
+        15, 15, 491, 491, 0, 0, 346, 346, 346, 346, 346, 346,
+        346, 0, 0, 0,
+        // Block 628
+        346, 346, 346, 346, 346, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 629
+        15, 15, 15, 1275, 15, 1276, 15, 15, 15, 15, 0, 15,
+        0, 0, 1277, 0,
+        // Block 630
+        15, 1278, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 631
+        15, 15, 15, 15, 15, 15, 0, 15, 491, 491, 491, 354,
+        354, 354, 354, 354,
+        // Block 632
+        354, 0, 491, 0, 0, 1279, 0, 1280, 1281, 491, 491, 0,
+        491, 491, 496, 569,
+        // Block 633
+        496, 15, 354, 15, 3, 3, 0, 3, 3, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 634
+        0, 354, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 635
+        15, 15, 15, 15, 15, 491, 491, 491, 354, 354, 354, 354,
+        354, 354, 354, 354,
+        // Block 636
+        491, 491, 496, 354, 354, 491, 495, 15, 15, 15, 15, 3,
+        3, 3, 3, 3,
+        // Block 637
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 3, 3,
+        0, 3, 346, 15,
+        // Block 638
+        491, 491, 491, 354, 354, 354, 354, 354, 354, 491, 354, 1282,
+        1283, 491, 1284, 354,
+        // Block 639
+        354, 491, 496, 495, 15, 15, 3, 15, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 640
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 491,
+        // Block 641
+        491, 491, 354, 354, 354, 354, 0, 0, 491, 491, 1285, 1286,
+        354, 354, 491, 496,
+        // Block 642
+        495, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3,
+        // Block 643
+        3, 3, 3, 3, 3, 3, 3, 3, 15, 15, 15, 15,
+        354, 354, 0, 0,
+        // Block 644
+        491, 491, 491, 354, 354, 354, 354, 354, 354, 354, 354, 491,
+        491, 354, 491, 496,
+        // Block 645
+        354, 3, 3, 3, 15, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 646
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 0, 0, 0,
+        // Block 647
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 354,
+        491, 354, 491, 491,
+        // Block 648
+        354, 354, 354, 354, 354, 354, 569, 495, 15, 3, 0, 0,
+        0, 0, 0, 0,
+        // Block 649
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+        9, 9, 9, 9,
+        // Block 650
+        9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 651
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+        0, 354, 491, 354,
+        // Block 652
+        491, 491, 354, 354, 354, 354, 491, 354, 354, 354, 354, 496,
+        0, 0, 0, 0,
+        // Block 653
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18,
+        3, 3, 3, 14,
+        // Block 654
+        354, 354, 354, 354, 354, 354, 354, 354, 491, 496, 495, 3,
+        0, 0, 0, 0,
+        // Block 655
+        18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 15,
+        // Block 656
+        15, 15, 15, 15, 15, 15, 15, 0, 0, 15, 0, 0,
+        15, 15, 15, 15,
+        // Block 657
+        15, 15, 15, 15, 0, 15, 15, 0, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 658
+        491, 491, 491, 491, 491, 491, 0, 491, 1287, 0, 0, 354,
+        354, 569, 496, 15,
+        // Block 659
+        491, 15, 491, 495, 3, 3, 3, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 660
+        15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 15, 15,
+        15, 15, 15, 15,
+        // Block 661
+        15, 491, 491, 491, 354, 354, 354, 354, 0, 0, 354, 354,
+        491, 491, 491, 491,
+        // Block 662
+        496, 15, 3, 15, 491, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 663
+        15, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 15,
+        15, 15, 15, 15,
+        // Block 664
+        15, 15, 15, 354, 496, 354, 354, 354, 354, 491, 15, 354,
+        354, 354, 354, 3,
+        // Block 665
+        3, 3, 3, 3, 3, 3, 3, 496, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 666
+        15, 354, 354, 354, 354, 354, 354, 491, 491, 354, 354, 354,
+        15, 15, 15, 15,
+        // Block 667
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 354, 354,
+        354, 354, 354, 354,
+        // Block 668
+        354, 354, 354, 354, 354, 354, 354, 491, 354, 496, 3, 3,
+        3, 15, 3, 3,
+        // Block 669
+        3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 670
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0,
+        0, 0, 0, 0,
+        // Block 671
+        15, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 672
+        354, 354, 354, 354, 354, 354, 354, 0, 354, 354, 354, 354,
+        354, 354, 491, 496,
+        // Block 673
+        15, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 674
+        3, 3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 675
+        0, 0, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+        354, 354, 354, 354,
+        // Block 676
+        354, 354, 354, 354, 354, 354, 354, 354, 0, 491, 354, 354,
+        354, 354, 354, 354,
+        // Block 677
+        354, 491, 354, 354, 491, 354, 354, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 678
+        15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 0, 15,
+        15, 15, 15, 15,
+        // Block 679
+        15, 354, 354, 354, 354, 354, 354, 0, 0, 0, 354, 0,
+        354, 354, 0, 354,
+        // Block 680
+        354, 354, 495, 354, 496, 496, 15, 354, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 681
+        15, 15, 15, 15, 15, 15, 0, 15, 15, 0, 15, 15,
+        15, 15, 15, 15,
+        // Block 682
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 491, 491,
+        491, 491, 491, 0,
+        // Block 683
+        354, 354, 0, 491, 491, 354, 491, 496, 15, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 684
+        15, 15, 15, 354, 354, 491, 491, 3, 3, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 685
+        354, 354, 15, 491, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 686
+        15, 15, 15, 15, 491, 491, 354, 354, 354, 354, 354, 0,
+        0, 0, 491, 491,
+        // Block 687
+        354, 569, 496, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3,
+        // Block 688
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 354, 0,
+        0, 0, 0, 0,
+        // Block 689
+        18, 18, 18, 18, 18, 14, 14, 14, 14, 14, 14, 14,
+        14, 4, 4, 4,
+        // Block 690
+        4, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 691
+        14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 3,
+        // Block 692
+        568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568, 568,
+        568, 568, 568, 0,
+        // Block 693
+        3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 694
+        15, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 695
+        17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+        17, 17, 17, 17,
+        // Block 696
+        354, 15, 15, 15, 15, 15, 15, 354, 354, 354, 354, 354,
+        354, 354, 354, 354,
+        // Block 697
+        354, 354, 354, 354, 354, 354, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 698
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 354, 354,
+        // Block 699
+        354, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 354, 491, 491,
+        491, 354, 354, 496,
+        // Block 700
+        351, 351, 351, 351, 351, 3, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 701
+        346, 346, 346, 346, 346, 346, 346, 3, 3, 3, 3, 3,
+        14, 14, 14, 14,
+        // Block 702
+        345, 345, 345, 345, 3, 14, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 703
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 18,
+        18, 18, 18, 18,
+        // Block 704
+        18, 18, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 705
+        15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0,
+        0, 15, 15, 15,
+        // Block 706
+        345, 345, 345, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 707
+        15, 15, 15, 15, 15, 15, 15, 15, 1296, 1297, 1298, 345,
+        345, 3, 3, 3,
+        // Block 708
+        18, 18, 18, 18, 18, 18, 18, 3, 3, 3, 3, 0,
+        0, 0, 0, 0,
+        // Block 709
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+        0, 0, 0, 354,
+        // Block 710
+        15, 491, 491, 491, 491, 491, 491, 491, 491, 491, 491, 491,
+        491, 491, 491, 491,
+        // Block 711
+        491, 491, 491, 491, 491, 491, 491, 491, 491, 491, 491, 491,
+        491, 491, 491, 491,
+        // Block 712
+        491, 491, 491, 491, 491, 491, 491, 491, 0, 0, 0, 0,
+        0, 0, 0, 354,
+        // Block 713
+        354, 354, 354, 345, 345, 345, 345, 345, 345, 345, 345, 345,
+        345, 345, 345, 345,
+        // Block 714
+        345, 345, 3, 345, 354, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 715
+        1299, 1299, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 716
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 15,
+        // Block 717
+        345, 345, 345, 345, 0, 345, 345, 345, 345, 345, 345, 345,
+        0, 345, 345, 0,
+        // Block 718
+        15, 15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 719
+        0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 720
+        15, 15, 15, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 721
+        0, 0, 0, 0, 15, 15, 15, 15, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 722
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+        14, 354, 351, 3,
+        // Block 723
+        17, 17, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 724
+        354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+        354, 354, 0, 0,
+        // Block 725
+        354, 354, 354, 354, 354, 354, 354, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 726
+        14, 14, 14, 14, 14, 14, 14, 0, 0, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 727
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 1300, 1301,
+        // Block 728
+        1302, 1303, 1304, 1305, 1306, 1307, 1307, 351, 351, 351, 14, 14,
+        14, 1308, 1307, 1307,
+        // Block 729
+        1307, 1307, 1307, 17, 17, 17, 17, 17, 17, 17, 17, 348,
+        348, 348, 348, 348,
+        // Block 730
+        348, 348, 348, 14, 14, 346, 346, 346, 346, 346, 348, 348,
+        14, 14, 14, 14,
+        // Block 731
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 346, 346,
+        346, 346, 14, 14,
+        // Block 732
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 1309,
+        1310, 1311, 1312, 1313,
+        // Block 733
+        1314, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 734
+        14, 14, 346, 346, 346, 14, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 735
+        18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 736
+        383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+        383, 383, 383, 383,
+        // Block 737
+        383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 127, 127,
+        127, 127, 127, 127,
+        // Block 738
+        127, 127, 127, 127, 383, 383, 383, 383, 383, 383, 383, 383,
+        383, 383, 383, 383,
+        // Block 739
+        383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+        383, 383, 127, 127,
+        // Block 740
+        127, 127, 127, 127, 127, 0, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127,
+        // Block 741
+        127, 127, 127, 127, 127, 127, 127, 127, 383, 383, 383, 383,
+        383, 383, 383, 383,
+        // Block 742
+        383, 383, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127,
+        // Block 743
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        383, 0, 383, 383,
+        // Block 744
+        0, 0, 383, 0, 0, 383, 383, 0, 0, 383, 383, 383,
+        383, 0, 383, 383,
+        // Block 745
+        383, 383, 383, 383, 383, 383, 127, 127, 127, 127, 0, 127,
+        0, 127, 127, 127,
+        // Block 746
+        127, 127, 127, 127, 0, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127,
+        // Block 747
+        127, 127, 127, 127, 383, 383, 0, 383, 383, 383, 383, 0,
+        0, 383, 383, 383,
+        // Block 748
+        383, 383, 383, 383, 383, 0, 383, 383, 383, 383, 383, 383,
+        383, 0, 127, 127,
+        // Block 749
+        127, 127, 127, 127, 127, 127, 127, 127, 383, 383, 0, 383,
+        383, 383, 383, 0,
+        // Block 750
+        383, 383, 383, 383, 383, 0, 383, 0, 0, 0, 383, 383,
+        383, 383, 383, 383,
+        // Block 751
+        383, 0, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127,
+        // Block 752
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        383, 383, 383, 383,
+        // Block 753
+        383, 383, 383, 383, 383, 383, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127,
+        // Block 754
+        127, 127, 127, 127, 127, 127, 0, 0, 383, 383, 383, 383,
+        383, 383, 383, 383,
+        // Block 755
+        383, 7, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127,
+        // Block 756
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 7,
+        127, 127, 127, 127,
+        // Block 757
+        127, 127, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+        383, 383, 383, 383,
+        // Block 758
+        383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 7,
+        127, 127, 127, 127,
+        // Block 759
+        127, 127, 127, 127, 127, 7, 127, 127, 127, 127, 127, 127,
+        383, 383, 383, 383,
+        // Block 760
+        383, 383, 383, 383, 383, 7, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 127,
+        // Block 761
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 7,
+        // Block 762
+        127, 127, 127, 127, 127, 127, 383, 383, 383, 383, 383, 383,
+        383, 383, 383, 383,
+        // Block 763
+        383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383, 383,
+        383, 383, 383, 7,
+        // Block 764
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 7, 127, 127,
+        127, 127, 127, 127,
+        // Block 765
+        383, 383, 383, 383, 383, 383, 383, 383, 383, 7, 127, 127,
+        127, 127, 127, 127,
+        // Block 766
+        127, 127, 127, 7, 127, 127, 127, 127, 127, 127, 383, 127,
+        0, 0, 9, 9,
+        // Block 767
+        354, 354, 354, 354, 354, 354, 354, 14, 14, 14, 14, 354,
+        354, 354, 354, 354,
+        // Block 768
+        354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+        354, 14, 14, 14,
+        // Block 769
+        14, 14, 14, 14, 14, 354, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 770
+        14, 14, 14, 14, 354, 14, 14, 3, 3, 3, 3, 3,
+        0, 0, 0, 0,
+        // Block 771
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354,
+        354, 354, 354, 354,
+        // Block 772
+        0, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354, 354,
+        354, 354, 354, 354,
+        // Block 773
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 15, 127,
+        127, 127, 127, 127,
+        // Block 774
+        127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
+        127, 127, 127, 0,
+        // Block 775
+        0, 0, 0, 0, 0, 127, 127, 127, 127, 127, 127, 0,
+        0, 0, 0, 0,
+        // Block 776
+        346, 346, 346, 346, 346, 346, 346, 0, 346, 346, 346, 346,
+        346, 346, 346, 346,
+        // Block 777
+        346, 346, 346, 346, 346, 346, 346, 346, 346, 0, 0, 346,
+        346, 346, 346, 346,
+        // Block 778
+        346, 346, 0, 346, 346, 0, 346, 346, 346, 346, 346, 0,
+        0, 0, 0, 0,
+        // Block 779
+        345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345, 345,
+        345, 345, 0, 0,
+        // Block 780
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 346,
+        // Block 781
+        346, 346, 346, 346, 346, 346, 346, 345, 345, 345, 345, 345,
+        345, 345, 0, 0,
+        // Block 782
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0,
+        0, 0, 15, 14,
+        // Block 783
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 346, 0,
+        // Block 784
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        346, 346, 346, 346,
+        // Block 785
+        9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0,
+        0, 0, 0, 4,
+        // Block 786
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 345,
+        347, 347, 348, 346,
+        // Block 787
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 346, 348,
+        // Block 788
+        15, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0,
+        0, 0, 0, 3,
+        // Block 789
+        15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 15,
+        0, 15, 15, 0,
+        // Block 790
+        15, 15, 15, 15, 15, 0, 0, 18, 18, 18, 18, 18,
+        18, 18, 18, 18,
+        // Block 791
+        348, 348, 348, 348, 348, 348, 348, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 792
+        1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315, 1315,
+        1315, 1315, 1315, 1315,
+        // Block 793
+        1315, 1315, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316,
+        1316, 1316, 1316, 1316,
+        // Block 794
+        1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316, 1316,
+        1316, 1316, 1316, 1316,
+        // Block 795
+        1316, 1316, 1316, 1316, 346, 346, 346, 346, 346, 346, 495, 345,
+        0, 0, 0, 0,
+        // Block 796
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        14, 18, 18, 18,
+        // Block 797
+        4, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 798
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 14, 18,
+        // Block 799
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 18, 0, 0,
+        // Block 800
+        15, 15, 15, 15, 0, 15, 15, 15, 15, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 801
+        0, 15, 15, 0, 15, 0, 0, 15, 0, 15, 15, 15,
+        15, 15, 15, 15,
+        // Block 802
+        15, 15, 15, 0, 15, 15, 15, 15, 0, 15, 0, 15,
+        0, 0, 0, 0,
+        // Block 803
+        0, 0, 15, 0, 0, 0, 0, 15, 0, 15, 0, 15,
+        0, 15, 15, 15,
+        // Block 804
+        0, 15, 15, 0, 15, 0, 0, 15, 0, 15, 0, 15,
+        0, 15, 0, 15,
+        // Block 805
+        0, 15, 15, 0, 15, 0, 0, 15, 15, 15, 15, 0,
+        15, 15, 15, 15,
+        // Block 806
+        15, 15, 15, 0, 15, 15, 15, 15, 0, 15, 15, 15,
+        15, 0, 15, 0,
+        // Block 807
+        15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 15,
+        15, 15, 15, 15,
+        // Block 808
+        0, 15, 15, 15, 0, 15, 15, 15, 15, 15, 0, 15,
+        15, 15, 15, 15,
+        // Block 809
+        7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 810
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        0, 0, 0, 0,
+        // Block 811
+        0, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 812
+        18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+        18, 14, 14, 14,
+        // Block 813
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 0, 0,
+        // Block 814
+        0, 0, 0, 0, 0, 0, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 815
+        14, 14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 816
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 817
+        14, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 818
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 11,
+        11, 11, 11, 11,
+        // Block 819
+        14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0,
+        14, 14, 14, 14,
+        // Block 820
+        14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 14,
+        14, 14, 14, 14,
+        // Block 821
+        14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 822
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0,
+        0, 0, 0, 14,
+        // Block 823
+        14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0,
+        0, 0, 14, 14,
+        // Block 824
+        14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 0, 0, 14,
+        // Block 825
+        14, 14, 14, 0, 14, 14, 14, 14, 14, 14, 14, 14,
+        14, 14, 14, 14,
+        // Block 826
+        0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0,
+        // Block 827
+        1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212,
+        1212, 1212, 0, 0,
+    };
+
+    /**
+     * @brief The distinct records. The first one belongs to the
+     *  unassigned code points.
+     */
+    constexpr CodepointProperties CODEPOINT_PROPERTY_RECORDS[] =
+    {
+        {29, 0, 0, 0, 0, 0, 0}, {25, 0, 0, 0, 0, 0, 0},
+        {22, 0, 0, 0, 0, 0, 0}, {17, 0, 0, 0, 0, 0, 0},
+        {19, 0, 0, 0, 0, 0, 0}, {13, 0, 0, 0, 0, 0, 0},
+        {14, 0, 0, 0, 0, 0, 0}, {18, 0, 0, 0, 0, 0, 0},
+        {12, 0, 0, 0, 0, 0, 0}, {8, 0, 0, 0, 0, 0, 0},
+        {0, 0, 1, 0, 0, 0, 0}, {20, 0, 0, 0, 0, 0, 0},
+        {11, 0, 0, 0, 0, 0, 0}, {1, 0, 0, 2, 2, 0, 0},
+        {21, 0, 0, 0, 0, 0, 0}, {4, 0, 0, 0, 0, 0, 0},
+        {15, 0, 0, 0, 0, 0, 0}, {26, 0, 0, 0, 0, 0, 0},
+        {10, 0, 0, 0, 0, 0, 0}, {1, 0, 0, 3, 3, 0, 0},
+        {16, 0, 0, 0, 0, 0, 0}, {0, 0, 1, 0, 0, 0, 1},
+        {0, 0, 1, 0, 0, 0, 2}, {0, 0, 1, 0, 0, 0, 3},
+        {0, 0, 1, 0, 0, 0, 4}, {0, 0, 1, 0, 0, 0, 5},
+        {0, 0, 1, 0, 0, 0, 6}, {0, 0, 1, 0, 0, 0, 7},
+        {0, 0, 1, 0, 0, 0, 8}, {0, 0, 1, 0, 0, 0, 9},
+        {0, 0, 1, 0, 0, 0, 10}, {0, 0, 1, 0, 0, 0, 11},
+        {0, 0, 1, 0, 0, 0, 12}, {0, 0, 1, 0, 0, 0, 13},
+        {0, 0, 1, 0, 0, 0, 14}, {0, 0, 1, 0, 0, 0, 15},
+        {0, 0, 1, 0, 0, 0, 16}, {0, 0, 1, 0, 0, 0, 17},
+        {0, 0, 1, 0, 0, 0, 18}, {0, 0, 1, 0, 0, 0, 19},
+        {0, 0, 1, 0, 0, 0, 20}, {0, 0, 1, 0, 0, 0, 21},
+        {0, 0, 1, 0, 0, 0, 22}, {0, 0, 1, 0, 0, 0, 23},
+        {0, 0, 1, 0, 0, 0, 24}, {0, 0, 1, 0, 0, 0, 25},
+        {0, 0, 1, 0, 0, 0, 26}, {1, 0, 0, 0, 0, 1, 0},
+        {1, 0, 0, 2, 2, 0, 27}, {1, 0, 0, 2, 2, 0, 28},
+        {1, 0, 0, 2, 2, 0, 29}, {1, 0, 0, 2, 2, 0, 30},
+        {1, 0, 0, 2, 2, 0, 31}, {1, 0, 0, 2, 2, 0, 32},
+        {1, 0, 0, 2, 2, 0, 33}, {1, 0, 0, 2, 2, 0, 34},
+        {1, 0, 0, 2, 2, 0, 35}, {1, 0, 0, 2, 2, 0, 36},
+        {1, 0, 0, 2, 2, 0, 37}, {1, 0, 0, 2, 2, 0, 38},
+        {1, 0, 0, 2, 2, 0, 39}, {1, 0, 0, 2, 2, 0, 40},
+        {1, 0, 0, 2, 2, 0, 41}, {1, 0, 0, 2, 2, 0, 42},
+        {1, 0, 0, 2, 2, 0, 43}, {1, 0, 0, 2, 2, 0, 44},
+        {1, 0, 0, 2, 2, 0, 45}, {1, 0, 0, 2, 2, 0, 46},
+        {1, 0, 0, 2, 2, 0, 47}, {1, 0, 0, 2, 2, 0, 48},
+        {1, 0, 0, 2, 2, 0, 49}, {1, 0, 0, 2, 2, 0, 50},
+        {1, 0, 0, 2, 2, 0, 51}, {1, 0, 0, 2, 2, 0, 52},
+        {1, 0, 0, 4, 4, 0, 53}, {0, 0, 5, 0, 0, 0, 54},
+        {1, 0, 0, 6, 6, 0, 55}, {0, 0, 5, 0, 0, 0, 56},
+        {1, 0, 0, 6, 6, 0, 57}, {0, 0, 5, 0, 0, 0, 58},
+        {1, 0, 0, 6, 6, 0, 59}, {0, 0, 5, 0, 0, 0, 60},
+        {1, 0, 0, 6, 6, 0, 61}, {0, 0, 5, 0, 0, 0, 62},
+        {1, 0, 0, 6, 6, 0, 63}, {0, 0, 5, 0, 0, 0, 64},
+        {1, 0, 0, 6, 6, 0, 65}, {0, 0, 5, 0, 0, 0, 66},
+        {1, 0, 0, 6, 6, 0, 67}, {0, 0, 5, 0, 0, 0, 68},
+        {1, 0, 0, 6, 6, 0, 69}, {0, 0, 5, 0, 0, 0, 0},
+        {1, 0, 0, 6, 6, 0, 0}, {0, 0, 5, 0, 0, 0, 70},
+        {1, 0, 0, 6, 6, 0, 71}, {0, 0, 5, 0, 0, 0, 72},
+        {1, 0, 0, 6, 6, 0, 73}, {0, 0, 5, 0, 0, 0, 74},
+        {1, 0, 0, 6, 6, 0, 75}, {0, 0, 5, 0, 0, 0, 76},
+        {1, 0, 0, 6, 6, 0, 77}, {0, 0, 5, 0, 0, 0, 78},
+        {1, 0, 0, 6, 6, 0, 79}, {0, 0, 5, 0, 0, 0, 80},
+        {1, 0, 0, 6, 6, 0, 81}, {0, 0, 5, 0, 0, 0, 82},
+        {1, 0, 0, 6, 6, 0, 83}, {0, 0, 5, 0, 0, 0, 84},
+        {1, 0, 0, 6, 6, 0, 85}, {0, 0, 5, 0, 0, 0, 86},
+        {1, 0, 0, 6, 6, 0, 87}, {0, 0, 5, 0, 0, 0, 88},
+        {1, 0, 0, 6, 6, 0, 89}, {0, 0, 5, 0, 0, 0, 90},
+        {1, 0, 0, 6, 6, 0, 91}, {0, 0, 5, 0, 0, 0, 92},
+        {1, 0, 0, 6, 6, 0, 93}, {0, 0, 5, 0, 0, 0, 94},
+        {1, 0, 0, 6, 6, 0, 95}, {0, 0, 5, 0, 0, 0, 96},
+        {1, 0, 0, 6, 6, 0, 97}, {0, 0, 7, 0, 0, 2, 98},
+        {1, 0, 0, 8, 8, 0, 0}, {0, 0, 5, 0, 0, 0, 99},
+        {1, 0, 0, 6, 6, 0, 100}, {0, 0, 5, 0, 0, 0, 101},
+        {1, 0, 0, 6, 6, 0, 102}, {1, 0, 0, 0, 0, 0, 0},
+        {0, 0, 5, 0, 0, 0, 103}, {1, 0, 0, 6, 6, 0, 104},
+        {0, 0, 5, 0, 0, 0, 105}, {1, 0, 0, 6, 6, 0, 106},
+        {0, 0, 5, 0, 0, 0, 107}, {1, 0, 0, 6, 6, 0, 108},
+        {0, 0, 5, 0, 0, 0, 109}, {1, 0, 0, 6, 6, 0, 110},
+        {0, 0, 5, 0, 0, 0, 111}, {1, 0, 0, 6, 6, 0, 112},
+        {0, 0, 5, 0, 0, 0, 113}, {1, 0, 0, 6, 6, 0, 114},
+        {1, 0, 0, 0, 0, 3, 0}, {0, 0, 5, 0, 0, 0, 115},
+        {1, 0, 0, 6, 6, 0, 116}, {0, 0, 5, 0, 0, 0, 117},
+        {1, 0, 0, 6, 6, 0, 118}, {0, 0, 5, 0, 0, 0, 119},
+        {1, 0, 0, 6, 6, 0, 120}, {0, 0, 5, 0, 0, 0, 121},
+        {1, 0, 0, 6, 6, 0, 122}, {0, 0, 5, 0, 0, 0, 123},
+        {1, 0, 0, 6, 6, 0, 124}, {0, 0, 5, 0, 0, 0, 125},
+        {1, 0, 0, 6, 6, 0, 126}, {0, 0, 5, 0, 0, 0, 127},
+        {1, 0, 0, 6, 6, 0, 128}, {0, 0, 5, 0, 0, 0, 129},
+        {1, 0, 0, 6, 6, 0, 130}, {0, 0, 5, 0, 0, 0, 131},
+        {1, 0, 0, 6, 6, 0, 132}, {0, 0, 5, 0, 0, 0, 133},
+        {1, 0, 0, 6, 6, 0, 134}, {0, 0, 5, 0, 0, 0, 135},
+        {1, 0, 0, 6, 6, 0, 136}, {0, 0, 5, 0, 0, 0, 137},
+        {1, 0, 0, 6, 6, 0, 138}, {0, 0, 5, 0, 0, 0, 139},
+        {1, 0, 0, 6, 6, 0, 140}, {0, 0, 5, 0, 0, 0, 141},
+        {1, 0, 0, 6, 6, 0, 142}, {0, 0, 5, 0, 0, 0, 143},
+        {1, 0, 0, 6, 6, 0, 144}, {0, 0, 5, 0, 0, 0, 145},
+        {1, 0, 0, 6, 6, 0, 146}, {0, 0, 5, 0, 0, 0, 147},
+        {1, 0, 0, 6, 6, 0, 148}, {0, 0, 5, 0, 0, 0, 149},
+        {1, 0, 0, 6, 6, 0, 150}, {0, 0, 5, 0, 0, 0, 151},
+        {1, 0, 0, 6, 6, 0, 152}, {0, 0, 5, 0, 0, 0, 153},
+        {1, 0, 0, 6, 6, 0, 154}, {0, 0, 9, 0, 0, 0, 155},
+        {0, 0, 5, 0, 0, 0, 156}, {1, 0, 0, 6, 6, 0, 157},
+        {0, 0, 5, 0, 0, 0, 158}, {1, 0, 0, 6, 6, 0, 159},
+        {0, 0, 5, 0, 0, 0, 160}, {1, 0, 0, 6, 6, 0, 161},
+        {1, 0, 0, 10, 10, 0, 0}, {1, 0, 0, 11, 11, 0, 0},
+        {0, 0, 12, 0, 0, 0, 0}, {0, 0, 13, 0, 0, 0, 0},
+        {0, 0, 14, 0, 0, 0, 0}, {0, 0, 15, 0, 0, 0, 0},
+        {0, 0, 16, 0, 0, 0, 0}, {0, 0, 17, 0, 0, 0, 0},
+        {0, 0, 18, 0, 0, 0, 0}, {1, 0, 0, 19, 19, 0, 0},
+        {0, 0, 20, 0, 0, 0, 0}, {0, 0, 21, 0, 0, 0, 0},
+        {1, 0, 0, 22, 22, 0, 0}, {1, 0, 0, 23, 23, 0, 0},
+        {0, 0, 24, 0, 0, 0, 0}, {1, 0, 0, 25, 25, 0, 0},
+        {0, 0, 26, 0, 0, 0, 0}, {0, 0, 5, 0, 0, 0, 162},
+        {1, 0, 0, 6, 6, 0, 163}, {0, 0, 27, 0, 0, 0, 0},
+        {0, 0, 5, 0, 0, 0, 164}, {1, 0, 0, 6, 6, 0, 165},
+        {0, 0, 28, 0, 0, 0, 0}, {0, 0, 29, 0, 0, 0, 0},
+        {1, 0, 0, 30, 30, 0, 0}, {0, 0, 31, 5, 0, 0, 0},
+        {2, 0, 5, 0, 6, 0, 0}, {1, 0, 0, 6, 32, 0, 0},
+        {0, 0, 5, 0, 0, 0, 166}, {1, 0, 0, 6, 6, 0, 167},
+        {0, 0, 5, 0, 0, 0, 168}, {1, 0, 0, 6, 6, 0, 169},
+        {0, 0, 5, 0, 0, 0, 170}, {1, 0, 0, 6, 6, 0, 171},
+        {0, 0, 5, 0, 0, 0, 172}, {1, 0, 0, 6, 6, 0, 173},
+        {0, 0, 5, 0, 0, 0, 174}, {1, 0, 0, 6, 6, 0, 175},
+        {0, 0, 5, 0, 0, 0, 176}, {1, 0, 0, 6, 6, 0, 177},
+        {0, 0, 5, 0, 0, 0, 178}, {1, 0, 0, 6, 6, 0, 179},
+        {0, 0, 5, 0, 0, 0, 180}, {1, 0, 0, 6, 6, 0, 181},
+        {1, 0, 0, 33, 33, 0, 0}, {0, 0, 5, 0, 0, 0, 182},
+        {1, 0, 0, 6, 6, 0, 183}, {0, 0, 5, 0, 0, 0, 184},
+        {1, 0, 0, 6, 6, 0, 185}, {0, 0, 5, 0, 0, 0, 186},
+        {1, 0, 0, 6, 6, 0, 187}, {0, 0, 5, 0, 0, 0, 188},
+        {1, 0, 0, 6, 6, 0, 189}, {0, 0, 5, 0, 0, 0, 190},
+        {1, 0, 0, 6, 6, 0, 191}, {0, 0, 5, 0, 0, 0, 192},
+        {1, 0, 0, 6, 6, 0, 193}, {0, 0, 5, 0, 0, 0, 194},
+        {1, 0, 0, 6, 6, 0, 195}, {0, 0, 5, 0, 0, 0, 196},
+        {1, 0, 0, 6, 6, 0, 197}, {1, 0, 0, 0, 0, 4, 198},
+        {0, 0, 5, 0, 0, 0, 199}, {1, 0, 0, 6, 6, 0, 200},
+        {0, 0, 34, 0, 0, 0, 0}, {0, 0, 35, 0, 0, 0, 0},
+        {0, 0, 5, 0, 0, 0, 201}, {1, 0, 0, 6, 6, 0, 202},
+        {0, 0, 5, 0, 0, 0, 203}, {1, 0, 0, 6, 6, 0, 204},
+        {0, 0, 5, 0, 0, 0, 205}, {1, 0, 0, 6, 6, 0, 206},
+        {0, 0, 5, 0, 0, 0, 207}, {1, 0, 0, 6, 6, 0, 208},
+        {0, 0, 5, 0, 0, 0, 209}, {1, 0, 0, 6, 6, 0, 210},
+        {0, 0, 5, 0, 0, 0, 211}, {1, 0, 0, 6, 6, 0, 212},
+        {0, 0, 5, 0, 0, 0, 213}, {1, 0, 0, 6, 6, 0, 214},
+        {0, 0, 5, 0, 0, 0, 215}, {1, 0, 0, 6, 6, 0, 216},
+        {0, 0, 5, 0, 0, 0, 217}, {1, 0, 0, 6, 6, 0, 218},
+        {0, 0, 5, 0, 0, 0, 219}, {1, 0, 0, 6, 6, 0, 220},
+        {0, 0, 5, 0, 0, 0, 221}, {1, 0, 0, 6, 6, 0, 222},
+        {0, 0, 5, 0, 0, 0, 223}, {1, 0, 0, 6, 6, 0, 224},
+        {0, 0, 5, 0, 0, 0, 225}, {1, 0, 0, 6, 6, 0, 226},
+        {0, 0, 5, 0, 0, 0, 227}, {1, 0, 0, 6, 6, 0, 228},
+        {0, 0, 5, 0, 0, 0, 229}, {1, 0, 0, 6, 6, 0, 230},
+        {0, 0, 5, 0, 0, 0, 231}, {1, 0, 0, 6, 6, 0, 232},
+        {0, 0, 5, 0, 0, 0, 233}, {1, 0, 0, 6, 6, 0, 234},
+        {0, 0, 5, 0, 0, 0, 235}, {1, 0, 0, 6, 6, 0, 236},
+        {0, 0, 5, 0, 0, 0, 237}, {1, 0, 0, 6, 6, 0, 238},
+        {0, 0, 36, 0, 0, 0, 0}, {0, 0, 5, 0, 0, 0, 239},
+        {1, 0, 0, 6, 6, 0, 240}, {0, 0, 5, 0, 0, 0, 241},
+        {1, 0, 0, 6, 6, 0, 242}, {0, 0, 5, 0, 0, 0, 243},
+        {1, 0, 0, 6, 6, 0, 244}, {0, 0, 5, 0, 0, 0, 245},
+        {1, 0, 0, 6, 6, 0, 246}, {0, 0, 5, 0, 0, 0, 247},
+        {1, 0, 0, 6, 6, 0, 248}, {0, 0, 5, 0, 0, 0, 249},
+        {1, 0, 0, 6, 6, 0, 250}, {0, 0, 5, 0, 0, 0, 251},
+        {1, 0, 0, 6, 6, 0, 252}, {0, 0, 37, 0, 0, 0, 0},
+        {0, 0, 38, 0, 0, 0, 0}, {0, 0, 39, 0, 0, 0, 0},
+        {1, 0, 0, 40, 40, 0, 0}, {0, 0, 41, 0, 0, 0, 0},
+        {0, 0, 42, 0, 0, 0, 0}, {0, 0, 43, 0, 0, 0, 0},
+        {1, 0, 0, 44, 44, 0, 0}, {1, 0, 0, 45, 45, 0, 0},
+        {1, 0, 0, 46, 46, 0, 0}, {1, 0, 0, 47, 47, 0, 0},
+        {1, 0, 0, 48, 48, 0, 0}, {1, 0, 0, 49, 49, 0, 0},
+        {1, 0, 0, 50, 50, 0, 0}, {1, 0, 0, 51, 51, 0, 0},
+        {1, 0, 0, 52, 52, 0, 0}, {1, 0, 0, 53, 53, 0, 0},
+        {1, 0, 0, 54, 54, 0, 0}, {1, 0, 0, 55, 55, 0, 0},
+        {1, 0, 0, 56, 56, 0, 0}, {1, 0, 0, 57, 57, 0, 0},
+        {1, 0, 0, 58, 58, 0, 0}, {1, 0, 0, 59, 59, 0, 0},
+        {1, 0, 0, 60, 60, 0, 0}, {1, 0, 0, 61, 61, 0, 0},
+        {1, 0, 0, 62, 62, 0, 0}, {1, 0, 0, 63, 63, 0, 0},
+        {1, 0, 0, 64, 64, 0, 0}, {1, 0, 0, 65, 65, 0, 0},
+        {1, 0, 0, 66, 66, 0, 0}, {1, 0, 0, 67, 67, 0, 0},
+        {1, 0, 0, 68, 68, 0, 0}, {1, 0, 0, 69, 69, 0, 0},
+        {1, 0, 0, 70, 70, 0, 0}, {1, 0, 0, 71, 71, 0, 0},
+        {1, 0, 0, 72, 72, 0, 0}, {1, 0, 0, 73, 73, 0, 0},
+        {1, 0, 0, 74, 74, 0, 0}, {3, 0, 0, 0, 0, 0, 0},
+        {5, 230, 0, 0, 0, 0, 0}, {5, 232, 0, 0, 0, 0, 0},
+        {5, 220, 0, 0, 0, 0, 0}, {5, 216, 0, 0, 0, 0, 0},
+        {5, 202, 0, 0, 0, 0, 0}, {5, 1, 0, 0, 0, 0, 0},
+        {5, 230, 0, 0, 0, 0, 253}, {5, 240, 0, 75, 75, 0, 0},
+        {5, 0, 0, 0, 0, 0, 0}, {5, 233, 0, 0, 0, 0, 0},
+        {5, 234, 0, 0, 0, 0, 0}, {0, 0, 76, 0, 0, 0, 0},
+        {20, 0, 0, 0, 0, 0, 254}, {0, 0, 77, 0, 0, 0, 255},
+        {0, 0, 78, 0, 0, 0, 256}, {0, 0, 78, 0, 0, 0, 257},
+        {0, 0, 78, 0, 0, 0, 258}, {0, 0, 79, 0, 0, 0, 259},
+        {0, 0, 80, 0, 0, 0, 260}, {0, 0, 80, 0, 0, 0, 261},
+        {1, 0, 0, 0, 0, 5, 262}, {0, 0, 1, 0, 0, 0, 263},
+        {0, 0, 1, 0, 0, 0, 264}, {1, 0, 0, 81, 81, 0, 265},
+        {1, 0, 0, 82, 82, 0, 266}, {1, 0, 0, 82, 82, 0, 267},
+        {1, 0, 0, 82, 82, 0, 268}, {1, 0, 0, 0, 0, 6, 269},
+        {1, 0, 0, 83, 83, 0, 0}, {1, 0, 0, 2, 2, 0, 270},
+        {1, 0, 0, 2, 2, 0, 271}, {1, 0, 0, 84, 84, 0, 272},
+        {1, 0, 0, 85, 85, 0, 273}, {1, 0, 0, 85, 85, 0, 274},
+        {0, 0, 86, 0, 0, 0, 0}, {1, 0, 0, 87, 87, 0, 0},
+        {1, 0, 0, 88, 88, 0, 0}, {0, 0, 0, 0, 0, 0, 0},
+        {0, 0, 0, 0, 0, 0, 275}, {0, 0, 0, 0, 0, 0, 276},
+        {1, 0, 0, 89, 89, 0, 0}, {1, 0, 0, 90, 90, 0, 0},
+        {1, 0, 0, 91, 91, 0, 0}, {1, 0, 0, 92, 92, 0, 0},
+        {1, 0, 0, 93, 93, 0, 0}, {1, 0, 0, 94, 94, 0, 0},
+        {1, 0, 0, 95, 95, 0, 0}, {0, 0, 96, 0, 0, 0, 0},
+        {1, 0, 0, 97, 97, 0, 0}, {0, 0, 98, 0, 0, 0, 0},
+        {0, 0, 99, 0, 0, 0, 277}, {0, 0, 99, 0, 0, 0, 278},
+        {0, 0, 99, 0, 0, 0, 0}, {0, 0, 99, 0, 0, 0, 279},
+        {0, 0, 99, 0, 0, 0, 280}, {0, 0, 99, 0, 0, 0, 281},
+        {0, 0, 99, 0, 0, 0, 282}, {0, 0, 99, 0, 0, 0, 283},
+        {0, 0, 1, 0, 0, 0, 284}, {1, 0, 0, 2, 2, 0, 285},
+        {1, 0, 0, 93, 93, 0, 286}, {1, 0, 0, 93, 93, 0, 287},
+        {1, 0, 0, 93, 93, 0, 288}, {1, 0, 0, 93, 93, 0, 289},
+        {1, 0, 0, 93, 93, 0, 290}, {1, 0, 0, 93, 93, 0, 291},
+        {1, 0, 0, 93, 93, 0, 292}, {0, 0, 5, 0, 0, 0, 293},
+        {1, 0, 0, 6, 6, 0, 294}, {7, 0, 0, 0, 0, 0, 0},
+        {0, 0, 100, 0, 0, 0, 0}, {0, 0, 5, 0, 0, 0, 295},
+        {1, 0, 0, 6, 6, 0, 296}, {1, 0, 0, 101, 101, 0, 0},
+        {0, 0, 5, 0, 0, 0, 297}, {1, 0, 0, 6, 6, 0, 298},
+        {0, 0, 5, 0, 0, 0, 299}, {1, 0, 0, 6, 6, 0, 300},
+        {0, 0, 5, 0, 0, 0, 301}, {1, 0, 0, 6, 6, 0, 302},
+        {0, 0, 5, 0, 0, 0, 303}, {1, 0, 0, 6, 6, 0, 304},
+        {0, 0, 5, 0, 0, 0, 305}, {1, 0, 0, 6, 6, 0, 306},
+        {0, 0, 5, 0, 0, 0, 307}, {1, 0, 0, 6, 6, 0, 308},
+        {0, 0, 5, 0, 0, 0, 309}, {1, 0, 0, 6, 6, 0, 310},
+        {0, 0, 5, 0, 0, 0, 311}, {1, 0, 0, 6, 6, 0, 312},
+        {0, 0, 5, 0, 0, 0, 313}, {1, 0, 0, 6, 6, 0, 314},
+        {0, 0, 5, 0, 0, 0, 315}, {1, 0, 0, 6, 6, 0, 316},
+        {0, 0, 5, 0, 0, 0, 317}, {1, 0, 0, 6, 6, 0, 318},
+        {0, 0, 5, 0, 0, 0, 319}, {1, 0, 0, 6, 6, 0, 320},
+        {0, 0, 5, 0, 0, 0, 321}, {1, 0, 0, 6, 6, 0, 322},
+        {0, 0, 5, 0, 0, 0, 323}, {1, 0, 0, 6, 6, 0, 324},
+        {0, 0, 5, 0, 0, 0, 325}, {1, 0, 0, 6, 6, 0, 326},
+        {0, 0, 5, 0, 0, 0, 327}, {1, 0, 0, 6, 6, 0, 328},
+        {0, 0, 102, 0, 0, 0, 0}, {1, 0, 0, 103, 103, 0, 0},
+        {1, 0, 0, 0, 0, 7, 0}, {5, 222, 0, 0, 0, 0, 0},
+        {5, 228, 0, 0, 0, 0, 0}, {5, 10, 0, 0, 0, 0, 0},
+        {5, 11, 0, 0, 0, 0, 0}, {5, 12, 0, 0, 0, 0, 0},
+        {5, 13, 0, 0, 0, 0, 0}, {5, 14, 0, 0, 0, 0, 0},
+        {5, 15, 0, 0, 0, 0, 0}, {5, 16, 0, 0, 0, 0, 0},
+        {5, 17, 0, 0, 0, 0, 0}, {5, 18, 0, 0, 0, 0, 0},
+        {5, 19, 0, 0, 0, 0, 0}, {5, 20, 0, 0, 0, 0, 0},
+        {5, 21, 0, 0, 0, 0, 0}, {5, 22, 0, 0, 0, 0, 0},
+        {5, 23, 0, 0, 0, 0, 0}, {5, 24, 0, 0, 0, 0, 0},
+        {5, 25, 0, 0, 0, 0, 0}, {5, 30, 0, 0, 0, 0, 0},
+        {5, 31, 0, 0, 0, 0, 0}, {5, 32, 0, 0, 0, 0, 0},
+        {4, 0, 0, 0, 0, 0, 329}, {4, 0, 0, 0, 0, 0, 330},
+        {4, 0, 0, 0, 0, 0, 331}, {4, 0, 0, 0, 0, 0, 332},
+        {4, 0, 0, 0, 0, 0, 333}, {5, 27, 0, 0, 0, 0, 0},
+        {5, 28, 0, 0, 0, 0, 0}, {5, 29, 0, 0, 0, 0, 0},
+        {5, 33, 0, 0, 0, 0, 0}, {5, 34, 0, 0, 0, 0, 0},
+        {5, 35, 0, 0, 0, 0, 0}, {4, 0, 0, 0, 0, 0, 334},
+        {4, 0, 0, 0, 0, 0, 335}, {4, 0, 0, 0, 0, 0, 336},
+        {5, 36, 0, 0, 0, 0, 0}, {6, 0, 0, 0, 0, 0, 0},
+        {4, 0, 0, 0, 0, 0, 337}, {4, 0, 0, 0, 0, 0, 338},
+        {4, 0, 0, 0, 0, 0, 339}, {5, 7, 0, 0, 0, 0, 0},
+        {5, 9, 0, 0, 0, 0, 0}, {4, 0, 0, 0, 0, 0, 340},
+        {4, 0, 0, 0, 0, 0, 341}, {4, 0, 0, 0, 0, 0, 342},
+        {4, 0, 0, 0, 0, 0, 343}, {4, 0, 0, 0, 0, 0, 344},
+        {4, 0, 0, 0, 0, 0, 345}, {4, 0, 0, 0, 0, 0, 346},
+        {4, 0, 0, 0, 0, 0, 347}, {6, 0, 0, 0, 0, 0, 348},
+        {6, 0, 0, 0, 0, 0, 349}, {4, 0, 0, 0, 0, 0, 350},
+        {4, 0, 0, 0, 0, 0, 351}, {4, 0, 0, 0, 0, 0, 352},
+        {4, 0, 0, 0, 0, 0, 353}, {4, 0, 0, 0, 0, 0, 354},
+        {4, 0, 0, 0, 0, 0, 355}, {4, 0, 0, 0, 0, 0, 356},
+        {4, 0, 0, 0, 0, 0, 357}, {4, 0, 0, 0, 0, 0, 358},
+        {6, 0, 0, 0, 0, 0, 359}, {6, 0, 0, 0, 0, 0, 360},
+        {6, 0, 0, 0, 0, 0, 361}, {4, 0, 0, 0, 0, 0, 362},
+        {4, 0, 0, 0, 0, 0, 363}, {4, 0, 0, 0, 0, 0, 364},
+        {6, 0, 0, 0, 0, 0, 365}, {6, 0, 0, 0, 0, 0, 366},
+        {6, 0, 0, 0, 0, 0, 367}, {5, 0, 0, 0, 0, 0, 368},
+        {5, 84, 0, 0, 0, 0, 0}, {5, 91, 0, 0, 0, 0, 0},
+        {6, 0, 0, 0, 0, 0, 369}, {6, 0, 0, 0, 0, 0, 370},
+        {6, 0, 0, 0, 0, 0, 371}, {6, 0, 0, 0, 0, 0, 372},
+        {6, 0, 0, 0, 0, 0, 373}, {6, 0, 0, 0, 0, 0, 374},
+        {6, 0, 0, 0, 0, 0, 375}, {6, 0, 0, 0, 0, 0, 376},
+        {6, 0, 0, 0, 0, 0, 377}, {6, 0, 0, 0, 0, 0, 378},
+        {6, 0, 0, 0, 0, 0, 379}, {6, 0, 0, 0, 0, 0, 380},
+        {5, 103, 0, 0, 0, 0, 0}, {5, 107, 0, 0, 0, 0, 0},
+        {5, 118, 0, 0, 0, 0, 0}, {5, 122, 0, 0, 0, 0, 0},
+        {4, 0, 0, 0, 0, 0, 381}, {4, 0, 0, 0, 0, 0, 382},
+        {4, 0, 0, 0, 0, 0, 383}, {4, 0, 0, 0, 0, 0, 384},
+        {4, 0, 0, 0, 0, 0, 385}, {4, 0, 0, 0, 0, 0, 386},
+        {5, 129, 0, 0, 0, 0, 0}, {5, 130, 0, 0, 0, 0, 0},
+        {5, 0, 0, 0, 0, 0, 387}, {5, 132, 0, 0, 0, 0, 0},
+        {5, 0, 0, 0, 0, 0, 388}, {5, 0, 0, 0, 0, 0, 389},
+        {5, 0, 0, 0, 0, 0, 390}, {5, 0, 0, 0, 0, 0, 391},
+        {5, 0, 0, 0, 0, 0, 392}, {5, 0, 0, 0, 0, 0, 393},
+        {5, 0, 0, 0, 0, 0, 394}, {5, 0, 0, 0, 0, 0, 395},
+        {5, 0, 0, 0, 0, 0, 396}, {5, 0, 0, 0, 0, 0, 397},
+        {4, 0, 0, 0, 0, 0, 398}, {0, 0, 104, 0, 0, 0, 0},
+        {1, 0, 0, 0, 105, 0, 0}, {0, 0, 106, 0, 0, 0, 0},
+        {9, 0, 0, 0, 0, 0, 0}, {6, 9, 0, 0, 0, 0, 0},
+        {4, 0, 0, 0, 0, 0, 399}, {4, 0, 0, 0, 0, 0, 400},
+        {4, 0, 0, 0, 0, 0, 401}, {4, 0, 0, 0, 0, 0, 402},
+        {4, 0, 0, 0, 0, 0, 403}, {4, 0, 0, 0, 0, 0, 404},
+        {6, 0, 0, 0, 0, 0, 405}, {6, 0, 0, 0, 0, 0, 406},
+        {6, 0, 0, 0, 0, 0, 407}, {6, 0, 0, 0, 0, 0, 408},
+        {6, 0, 0, 0, 0, 0, 409}, {1, 0, 0, 107, 107, 0, 0},
+        {1, 0, 0, 108, 108, 0, 0}, {1, 0, 0, 109, 109, 0, 0},
+        {1, 0, 0, 110, 110, 0, 0}, {1, 0, 0, 111, 111, 0, 0},
+        {1, 0, 0, 112, 112, 0, 0}, {1, 0, 0, 113, 113, 0, 0},
+        {1, 0, 0, 114, 114, 0, 0}, {0, 0, 115, 0, 0, 0, 0},
+        {1, 0, 0, 116, 116, 0, 0}, {1, 0, 0, 117, 117, 0, 0},
+        {1, 0, 0, 118, 118, 0, 0}, {5, 214, 0, 0, 0, 0, 0},
+        {5, 218, 0, 0, 0, 0, 0}, {0, 0, 5, 0, 0, 0, 410},
+        {1, 0, 0, 6, 6, 0, 411}, {0, 0, 5, 0, 0, 0, 412},
+        {1, 0, 0, 6, 6, 0, 413}, {0, 0, 5, 0, 0, 0, 414},
+        {1, 0, 0, 6, 6, 0, 415}, {0, 0, 5, 0, 0, 0, 416},
+        {1, 0, 0, 6, 6, 0, 417}, {0, 0, 5, 0, 0, 0, 418},
+        {1, 0, 0, 6, 6, 0, 419}, {0, 0, 5, 0, 0, 0, 420},
+        {1, 0, 0, 6, 6, 0, 421}, {0, 0, 5, 0, 0, 0, 422},
+        {1, 0, 0, 6, 6, 0, 423}, {0, 0, 5, 0, 0, 0, 424},
+        {1, 0, 0, 6, 6, 0, 425}, {0, 0, 5, 0, 0, 0, 426},
+        {1, 0, 0, 6, 6, 0, 427}, {0, 0, 5, 0, 0, 0, 428},
+        {1, 0, 0, 6, 6, 0, 429}, {0, 0, 5, 0, 0, 0, 430},
+        {1, 0, 0, 6, 6, 0, 431}, {0, 0, 5, 0, 0, 0, 432},
+        {1, 0, 0, 6, 6, 0, 433}, {0, 0, 5, 0, 0, 0, 434},
+        {1, 0, 0, 6, 6, 0, 435}, {0, 0, 5, 0, 0, 0, 436},
+        {1, 0, 0, 6, 6, 0, 437}, {0, 0, 5, 0, 0, 0, 438},
+        {1, 0, 0, 6, 6, 0, 439}, {0, 0, 5, 0, 0, 0, 440},
+        {1, 0, 0, 6, 6, 0, 441}, {0, 0, 5, 0, 0, 0, 442},
+        {1, 0, 0, 6, 6, 0, 443}, {0, 0, 5, 0, 0, 0, 444},
+        {1, 0, 0, 6, 6, 0, 445}, {0, 0, 5, 0, 0, 0, 446},
+        {1, 0, 0, 6, 6, 0, 447}, {0, 0, 5, 0, 0, 0, 448},
+        {1, 0, 0, 6, 6, 0, 449}, {0, 0, 5, 0, 0, 0, 450},
+        {1, 0, 0, 6, 6, 0, 451}, {0, 0, 5, 0, 0, 0, 452},
+        {1, 0, 0, 6, 6, 0, 453}, {0, 0, 5, 0, 0, 0, 454},
+        {1, 0, 0, 6, 6, 0, 455}, {0, 0, 5, 0, 0, 0, 456},
+        {1, 0, 0, 6, 6, 0, 457}, {0, 0, 5, 0, 0, 0, 458},
+        {1, 0, 0, 6, 6, 0, 459}, {0, 0, 5, 0, 0, 0, 460},
+        {1, 0, 0, 6, 6, 0, 461}, {0, 0, 5, 0, 0, 0, 462},
+        {1, 0, 0, 6, 6, 0, 463}, {0, 0, 5, 0, 0, 0, 464},
+        {1, 0, 0, 6, 6, 0, 465}, {0, 0, 5, 0, 0, 0, 466},
+        {1, 0, 0, 6, 6, 0, 467}, {0, 0, 5, 0, 0, 0, 468},
+        {1, 0, 0, 6, 6, 0, 469}, {0, 0, 5, 0, 0, 0, 470},
+        {1, 0, 0, 6, 6, 0, 471}, {0, 0, 5, 0, 0, 0, 472},
+        {1, 0, 0, 6, 6, 0, 473}, {0, 0, 5, 0, 0, 0, 474},
+        {1, 0, 0, 6, 6, 0, 475}, {0, 0, 5, 0, 0, 0, 476},
+        {1, 0, 0, 6, 6, 0, 477}, {0, 0, 5, 0, 0, 0, 478},
+        {1, 0, 0, 6, 6, 0, 479}, {0, 0, 5, 0, 0, 0, 480},
+        {1, 0, 0, 6, 6, 0, 481}, {0, 0, 5, 0, 0, 0, 482},
+        {1, 0, 0, 6, 6, 0, 483}, {0, 0, 5, 0, 0, 0, 484},
+        {1, 0, 0, 6, 6, 0, 485}, {0, 0, 5, 0, 0, 0, 486},
+        {1, 0, 0, 6, 6, 0, 487}, {0, 0, 5, 0, 0, 0, 488},
+        {1, 0, 0, 6, 6, 0, 489}, {0, 0, 5, 0, 0, 0, 490},
+        {1, 0, 0, 6, 6, 0, 491}, {0, 0, 5, 0, 0, 0, 492},
+        {1, 0, 0, 6, 6, 0, 493}, {0, 0, 5, 0, 0, 0, 494},
+        {1, 0, 0, 6, 6, 0, 495}, {0, 0, 5, 0, 0, 0, 496},
+        {1, 0, 0, 6, 6, 0, 497}, {0, 0, 5, 0, 0, 0, 498},
+        {1, 0, 0, 6, 6, 0, 499}, {0, 0, 5, 0, 0, 0, 500},
+        {1, 0, 0, 6, 6, 0, 501}, {0, 0, 5, 0, 0, 0, 502},
+        {1, 0, 0, 6, 6, 0, 503}, {0, 0, 5, 0, 0, 0, 504},
+        {1, 0, 0, 6, 6, 0, 505}, {0, 0, 5, 0, 0, 0, 506},
+        {1, 0, 0, 6, 6, 0, 507}, {0, 0, 5, 0, 0, 0, 508},
+        {1, 0, 0, 6, 6, 0, 509}, {0, 0, 5, 0, 0, 0, 510},
+        {1, 0, 0, 6, 6, 0, 511}, {0, 0, 5, 0, 0, 0, 512},
+        {1, 0, 0, 6, 6, 0, 513}, {0, 0, 5, 0, 0, 0, 514},
+        {1, 0, 0, 6, 6, 0, 515}, {0, 0, 5, 0, 0, 0, 516},
+        {1, 0, 0, 6, 6, 0, 517}, {0, 0, 5, 0, 0, 0, 518},
+        {1, 0, 0, 6, 6, 0, 519}, {0, 0, 5, 0, 0, 0, 520},
+        {1, 0, 0, 6, 6, 0, 521}, {0, 0, 5, 0, 0, 0, 522},
+        {1, 0, 0, 6, 6, 0, 523}, {0, 0, 5, 0, 0, 0, 524},
+        {1, 0, 0, 6, 6, 0, 525}, {0, 0, 5, 0, 0, 0, 526},
+        {1, 0, 0, 6, 6, 0, 527}, {0, 0, 5, 0, 0, 0, 528},
+        {1, 0, 0, 6, 6, 0, 529}, {0, 0, 5, 0, 0, 0, 530},
+        {1, 0, 0, 6, 6, 0, 531}, {0, 0, 5, 0, 0, 0, 532},
+        {1, 0, 0, 6, 6, 0, 533}, {0, 0, 5, 0, 0, 0, 534},
+        {1, 0, 0, 6, 6, 0, 535}, {0, 0, 5, 0, 0, 0, 536},
+        {1, 0, 0, 6, 6, 0, 537}, {0, 0, 5, 0, 0, 0, 538},
+        {1, 0, 0, 6, 6, 0, 539}, {0, 0, 5, 0, 0, 0, 540},
+        {1, 0, 0, 6, 6, 0, 541}, {0, 0, 5, 0, 0, 0, 542},
+        {1, 0, 0, 6, 6, 0, 543}, {0, 0, 5, 0, 0, 0, 544},
+        {1, 0, 0, 6, 6, 0, 545}, {0, 0, 5, 0, 0, 0, 546},
+        {1, 0, 0, 6, 6, 0, 547}, {0, 0, 5, 0, 0, 0, 548},
+        {1, 0, 0, 6, 6, 0, 549}, {0, 0, 5, 0, 0, 0, 550},
+        {1, 0, 0, 6, 6, 0, 551}, {0, 0, 5, 0, 0, 0, 552},
+        {1, 0, 0, 6, 6, 0, 553}, {0, 0, 5, 0, 0, 0, 554},
+        {1, 0, 0, 6, 6, 0, 555}, {0, 0, 5, 0, 0, 0, 556},
+        {1, 0, 0, 6, 6, 0, 557}, {0, 0, 5, 0, 0, 0, 558},
+        {1, 0, 0, 6, 6, 0, 559}, {1, 0, 0, 0, 0, 8, 560},
+        {1, 0, 0, 0, 0, 9, 561}, {1, 0, 0, 0, 0, 10, 562},
+        {1, 0, 0, 0, 0, 11, 563}, {1, 0, 0, 0, 0, 12, 0},
+        {1, 0, 0, 119, 119, 0, 564}, {0, 0, 120, 0, 0, 0, 0},
+        {0, 0, 5, 0, 0, 0, 565}, {1, 0, 0, 6, 6, 0, 566},
+        {0, 0, 5, 0, 0, 0, 567}, {1, 0, 0, 6, 6, 0, 568},
+        {0, 0, 5, 0, 0, 0, 569}, {1, 0, 0, 6, 6, 0, 570},
+        {0, 0, 5, 0, 0, 0, 571}, {1, 0, 0, 6, 6, 0, 572},
+        {0, 0, 5, 0, 0, 0, 573}, {1, 0, 0, 6, 6, 0, 574},
+        {0, 0, 5, 0, 0, 0, 575}, {1, 0, 0, 6, 6, 0, 576},
+        {0, 0, 5, 0, 0, 0, 577}, {1, 0, 0, 6, 6, 0, 578},
+        {0, 0, 5, 0, 0, 0, 579}, {1, 0, 0, 6, 6, 0, 580},
+        {0, 0, 5, 0, 0, 0, 581}, {1, 0, 0, 6, 6, 0, 582},
+        {0, 0, 5, 0, 0, 0, 583}, {1, 0, 0, 6, 6, 0, 584},
+        {0, 0, 5, 0, 0, 0, 585}, {1, 0, 0, 6, 6, 0, 586},
+        {0, 0, 5, 0, 0, 0, 587}, {1, 0, 0, 6, 6, 0, 588},
+        {0, 0, 5, 0, 0, 0, 589}, {1, 0, 0, 6, 6, 0, 590},
+        {0, 0, 5, 0, 0, 0, 591}, {1, 0, 0, 6, 6, 0, 592},
+        {0, 0, 5, 0, 0, 0, 593}, {1, 0, 0, 6, 6, 0, 594},
+        {0, 0, 5, 0, 0, 0, 595}, {1, 0, 0, 6, 6, 0, 596},
+        {0, 0, 5, 0, 0, 0, 597}, {1, 0, 0, 6, 6, 0, 598},
+        {0, 0, 5, 0, 0, 0, 599}, {1, 0, 0, 6, 6, 0, 600},
+        {0, 0, 5, 0, 0, 0, 601}, {1, 0, 0, 6, 6, 0, 602},
+        {0, 0, 5, 0, 0, 0, 603}, {1, 0, 0, 6, 6, 0, 604},
+        {0, 0, 5, 0, 0, 0, 605}, {1, 0, 0, 6, 6, 0, 606},
+        {0, 0, 5, 0, 0, 0, 607}, {1, 0, 0, 6, 6, 0, 608},
+        {0, 0, 5, 0, 0, 0, 609}, {1, 0, 0, 6, 6, 0, 610},
+        {0, 0, 5, 0, 0, 0, 611}, {1, 0, 0, 6, 6, 0, 612},
+        {0, 0, 5, 0, 0, 0, 613}, {1, 0, 0, 6, 6, 0, 614},
+        {0, 0, 5, 0, 0, 0, 615}, {1, 0, 0, 6, 6, 0, 616},
+        {0, 0, 5, 0, 0, 0, 617}, {1, 0, 0, 6, 6, 0, 618},
+        {0, 0, 5, 0, 0, 0, 619}, {1, 0, 0, 6, 6, 0, 620},
+        {0, 0, 5, 0, 0, 0, 621}, {1, 0, 0, 6, 6, 0, 622},
+        {0, 0, 5, 0, 0, 0, 623}, {1, 0, 0, 6, 6, 0, 624},
+        {0, 0, 5, 0, 0, 0, 625}, {1, 0, 0, 6, 6, 0, 626},
+        {0, 0, 5, 0, 0, 0, 627}, {1, 0, 0, 6, 6, 0, 628},
+        {0, 0, 5, 0, 0, 0, 629}, {1, 0, 0, 6, 6, 0, 630},
+        {0, 0, 5, 0, 0, 0, 631}, {1, 0, 0, 6, 6, 0, 632},
+        {0, 0, 5, 0, 0, 0, 633}, {1, 0, 0, 6, 6, 0, 634},
+        {0, 0, 5, 0, 0, 0, 635}, {1, 0, 0, 6, 6, 0, 636},
+        {0, 0, 5, 0, 0, 0, 637}, {1, 0, 0, 6, 6, 0, 638},
+        {0, 0, 5, 0, 0, 0, 639}, {1, 0, 0, 6, 6, 0, 640},
+        {0, 0, 5, 0, 0, 0, 641}, {1, 0, 0, 6, 6, 0, 642},
+        {0, 0, 5, 0, 0, 0, 643}, {1, 0, 0, 6, 6, 0, 644},
+        {0, 0, 5, 0, 0, 0, 645}, {1, 0, 0, 6, 6, 0, 646},
+        {0, 0, 5, 0, 0, 0, 647}, {1, 0, 0, 6, 6, 0, 648},
+        {0, 0, 5, 0, 0, 0, 649}, {1, 0, 0, 6, 6, 0, 650},
+        {0, 0, 5, 0, 0, 0, 651}, {1, 0, 0, 6, 6, 0, 652},
+        {0, 0, 5, 0, 0, 0, 653}, {1, 0, 0, 6, 6, 0, 654},
+        {1, 0, 0, 86, 86, 0, 655}, {1, 0, 0, 86, 86, 0, 656},
+        {1, 0, 0, 86, 86, 0, 657}, {1, 0, 0, 86, 86, 0, 658},
+        {1, 0, 0, 86, 86, 0, 659}, {1, 0, 0, 86, 86, 0, 660},
+        {1, 0, 0, 86, 86, 0, 661}, {1, 0, 0, 86, 86, 0, 662},
+        {0, 0, 91, 0, 0, 0, 663}, {0, 0, 91, 0, 0, 0, 664},
+        {0, 0, 91, 0, 0, 0, 665}, {0, 0, 91, 0, 0, 0, 666},
+        {0, 0, 91, 0, 0, 0, 667}, {0, 0, 91, 0, 0, 0, 668},
+        {0, 0, 91, 0, 0, 0, 669}, {0, 0, 91, 0, 0, 0, 670},
+        {1, 0, 0, 86, 86, 0, 671}, {1, 0, 0, 86, 86, 0, 672},
+        {1, 0, 0, 86, 86, 0, 673}, {1, 0, 0, 86, 86, 0, 674},
+        {1, 0, 0, 86, 86, 0, 675}, {1, 0, 0, 86, 86, 0, 676},
+        {0, 0, 91, 0, 0, 0, 677}, {0, 0, 91, 0, 0, 0, 678},
+        {0, 0, 91, 0, 0, 0, 679}, {0, 0, 91, 0, 0, 0, 680},
+        {0, 0, 91, 0, 0, 0, 681}, {0, 0, 91, 0, 0, 0, 682},
+        {1, 0, 0, 86, 86, 0, 683}, {1, 0, 0, 86, 86, 0, 684},
+        {1, 0, 0, 86, 86, 0, 685}, {1, 0, 0, 86, 86, 0, 686},
+        {1, 0, 0, 86, 86, 0, 687}, {1, 0, 0, 86, 86, 0, 688},
+        {1, 0, 0, 86, 86, 0, 689}, {1, 0, 0, 86, 86, 0, 690},
+        {0, 0, 91, 0, 0, 0, 691}, {0, 0, 91, 0, 0, 0, 692},
+        {0, 0, 91, 0, 0, 0, 693}, {0, 0, 91, 0, 0, 0, 694},
+        {0, 0, 91, 0, 0, 0, 695}, {0, 0, 91, 0, 0, 0, 696},
+        {0, 0, 91, 0, 0, 0, 697}, {0, 0, 91, 0, 0, 0, 698},
+        {1, 0, 0, 86, 86, 0, 699}, {1, 0, 0, 86, 86, 0, 700},
+        {1, 0, 0, 86, 86, 0, 701}, {1, 0, 0, 86, 86, 0, 702},
+        {1, 0, 0, 86, 86, 0, 703}, {1, 0, 0, 86, 86, 0, 704},
+        {1, 0, 0, 86, 86, 0, 705}, {1, 0, 0, 86, 86, 0, 706},
+        {0, 0, 91, 0, 0, 0, 707}, {0, 0, 91, 0, 0, 0, 708},
+        {0, 0, 91, 0, 0, 0, 709}, {0, 0, 91, 0, 0, 0, 710},
+        {0, 0, 91, 0, 0, 0, 711}, {0, 0, 91, 0, 0, 0, 712},
+        {0, 0, 91, 0, 0, 0, 713}, {0, 0, 91, 0, 0, 0, 714},
+        {1, 0, 0, 86, 86, 0, 715}, {1, 0, 0, 86, 86, 0, 716},
+        {1, 0, 0, 86, 86, 0, 717}, {1, 0, 0, 86, 86, 0, 718},
+        {1, 0, 0, 86, 86, 0, 719}, {1, 0, 0, 86, 86, 0, 720},
+        {0, 0, 91, 0, 0, 0, 721}, {0, 0, 91, 0, 0, 0, 722},
+        {0, 0, 91, 0, 0, 0, 723}, {0, 0, 91, 0, 0, 0, 724},
+        {0, 0, 91, 0, 0, 0, 725}, {0, 0, 91, 0, 0, 0, 726},
+        {1, 0, 0, 0, 0, 13, 727}, {1, 0, 0, 86, 86, 0, 728},
+        {1, 0, 0, 0, 0, 14, 729}, {1, 0, 0, 86, 86, 0, 730},
+        {1, 0, 0, 0, 0, 15, 731}, {1, 0, 0, 86, 86, 0, 732},
+        {1, 0, 0, 0, 0, 16, 733}, {1, 0, 0, 86, 86, 0, 734},
+        {0, 0, 91, 0, 0, 0, 735}, {0, 0, 91, 0, 0, 0, 736},
+        {0, 0, 91, 0, 0, 0, 737}, {0, 0, 91, 0, 0, 0, 738},
+        {1, 0, 0, 86, 86, 0, 739}, {1, 0, 0, 86, 86, 0, 740},
+        {1, 0, 0, 86, 86, 0, 741}, {1, 0, 0, 86, 86, 0, 742},
+        {1, 0, 0, 86, 86, 0, 743}, {1, 0, 0, 86, 86, 0, 744},
+        {1, 0, 0, 86, 86, 0, 745}, {1, 0, 0, 86, 86, 0, 746},
+        {0, 0, 91, 0, 0, 0, 747}, {0, 0, 91, 0, 0, 0, 748},
+        {0, 0, 91, 0, 0, 0, 749}, {0, 0, 91, 0, 0, 0, 750},
+        {0, 0, 91, 0, 0, 0, 751}, {0, 0, 91, 0, 0, 0, 752},
+        {0, 0, 91, 0, 0, 0, 753}, {0, 0, 91, 0, 0, 0, 754},
+        {1, 0, 0, 121, 121, 0, 755}, {1, 0, 0, 121, 121, 0, 0},
+        {1, 0, 0, 122, 122, 0, 756}, {1, 0, 0, 122, 122, 0, 0},
+        {1, 0, 0, 122, 122, 0, 757}, {1, 0, 0, 123, 123, 0, 758},
+        {1, 0, 0, 123, 123, 0, 0}, {1, 0, 0, 124, 124, 0, 759},
+        {1, 0, 0, 124, 124, 0, 0}, {1, 0, 0, 125, 125, 0, 760},
+        {1, 0, 0, 125, 125, 0, 0}, {1, 0, 0, 126, 126, 0, 761},
+        {1, 0, 0, 126, 126, 0, 0}, {1, 0, 0, 86, 86, 17, 762},
+        {1, 0, 0, 86, 86, 18, 763}, {1, 0, 0, 86, 86, 19, 764},
+        {1, 0, 0, 86, 86, 20, 765}, {1, 0, 0, 86, 86, 21, 766},
+        {1, 0, 0, 86, 86, 22, 767}, {1, 0, 0, 86, 86, 23, 768},
+        {1, 0, 0, 86, 86, 24, 769}, {2, 0, 91, 0, 0, 25, 770},
+        {2, 0, 91, 0, 0, 26, 771}, {2, 0, 91, 0, 0, 27, 772},
+        {2, 0, 91, 0, 0, 28, 773}, {2, 0, 91, 0, 0, 29, 774},
+        {2, 0, 91, 0, 0, 30, 775}, {2, 0, 91, 0, 0, 31, 776},
+        {2, 0, 91, 0, 0, 32, 777}, {1, 0, 0, 86, 86, 33, 778},
+        {1, 0, 0, 86, 86, 34, 779}, {1, 0, 0, 86, 86, 35, 780},
+        {1, 0, 0, 86, 86, 36, 781}, {1, 0, 0, 86, 86, 37, 782},
+        {1, 0, 0, 86, 86, 38, 783}, {1, 0, 0, 86, 86, 39, 784},
+        {1, 0, 0, 86, 86, 40, 785}, {2, 0, 91, 0, 0, 41, 786},
+        {2, 0, 91, 0, 0, 42, 787}, {2, 0, 91, 0, 0, 43, 788},
+        {2, 0, 91, 0, 0, 44, 789}, {2, 0, 91, 0, 0, 45, 790},
+        {2, 0, 91, 0, 0, 46, 791}, {2, 0, 91, 0, 0, 47, 792},
+        {2, 0, 91, 0, 0, 48, 793}, {1, 0, 0, 86, 86, 49, 794},
+        {1, 0, 0, 86, 86, 50, 795}, {1, 0, 0, 86, 86, 51, 796},
+        {1, 0, 0, 86, 86, 52, 797}, {1, 0, 0, 86, 86, 53, 798},
+        {1, 0, 0, 86, 86, 54, 799}, {1, 0, 0, 86, 86, 55, 800},
+        {1, 0, 0, 86, 86, 56, 801}, {2, 0, 91, 0, 0, 57, 802},
+        {2, 0, 91, 0, 0, 58, 803}, {2, 0, 91, 0, 0, 59, 804},
+        {2, 0, 91, 0, 0, 60, 805}, {2, 0, 91, 0, 0, 61, 806},
+        {2, 0, 91, 0, 0, 62, 807}, {2, 0, 91, 0, 0, 63, 808},
+        {2, 0, 91, 0, 0, 64, 809}, {1, 0, 0, 86, 86, 0, 810},
+        {1, 0, 0, 86, 86, 0, 811}, {1, 0, 0, 0, 0, 65, 812},
+        {1, 0, 0, 127, 127, 66, 813}, {1, 0, 0, 0, 0, 67, 814},
+        {1, 0, 0, 0, 0, 68, 815}, {1, 0, 0, 0, 0, 69, 816},
+        {0, 0, 91, 0, 0, 0, 817}, {0, 0, 91, 0, 0, 0, 818},
+        {0, 0, 128, 0, 0, 0, 819}, {0, 0, 128, 0, 0, 0, 0},
+        {2, 0, 129, 0, 0, 70, 820}, {1, 0, 0, 130, 130, 0, 0},
+        {20, 0, 0, 0, 0, 0, 821}, {1, 0, 0, 0, 0, 71, 822},
+        {1, 0, 0, 127, 127, 72, 823}, {1, 0, 0, 0, 0, 73, 824},
+        {1, 0, 0, 0, 0, 74, 825}, {1, 0, 0, 0, 0, 75, 826},
+        {0, 0, 92, 0, 0, 0, 827}, {0, 0, 92, 0, 0, 0, 0},
+        {0, 0, 92, 0, 0, 0, 828}, {2, 0, 129, 0, 0, 76, 829},
+        {20, 0, 0, 0, 0, 0, 830}, {20, 0, 0, 0, 0, 0, 831},
+        {20, 0, 0, 0, 0, 0, 832}, {1, 0, 0, 86, 86, 0, 833},
+        {1, 0, 0, 86, 86, 0, 834}, {1, 0, 0, 0, 0, 77, 835},
+        {1, 0, 0, 0, 0, 78, 0}, {1, 0, 0, 0, 0, 79, 836},
+        {1, 0, 0, 0, 0, 80, 837}, {0, 0, 91, 0, 0, 0, 838},
+        {0, 0, 91, 0, 0, 0, 839}, {0, 0, 131, 0, 0, 0, 840},
+        {0, 0, 131, 0, 0, 0, 0}, {20, 0, 0, 0, 0, 0, 841},
+        {20, 0, 0, 0, 0, 0, 842}, {20, 0, 0, 0, 0, 0, 843},
+        {1, 0, 0, 86, 86, 0, 844}, {1, 0, 0, 86, 86, 0, 845},
+        {1, 0, 0, 0, 0, 81, 846}, {1, 0, 0, 0, 0, 82, 0},
+        {1, 0, 0, 0, 0, 83, 847}, {1, 0, 0, 94, 94, 0, 848},
+        {1, 0, 0, 0, 0, 84, 849}, {1, 0, 0, 0, 0, 85, 850},
+        {0, 0, 91, 0, 0, 0, 851}, {0, 0, 91, 0, 0, 0, 852},
+        {0, 0, 132, 0, 0, 0, 853}, {0, 0, 132, 0, 0, 0, 0},
+        {0, 0, 98, 0, 0, 0, 854}, {20, 0, 0, 0, 0, 0, 855},
+        {1, 0, 0, 0, 0, 86, 856}, {1, 0, 0, 127, 127, 87, 857},
+        {1, 0, 0, 0, 0, 88, 858}, {1, 0, 0, 0, 0, 89, 859},
+        {1, 0, 0, 0, 0, 90, 860}, {0, 0, 133, 0, 0, 0, 861},
+        {0, 0, 133, 0, 0, 0, 0}, {0, 0, 134, 0, 0, 0, 862},
+        {0, 0, 134, 0, 0, 0, 0}, {2, 0, 129, 0, 0, 91, 863},
+        {23, 0, 0, 0, 0, 0, 0}, {24, 0, 0, 0, 0, 0, 0},
+        {0, 0, 135, 0, 0, 0, 0}, {0, 0, 136, 0, 0, 0, 0},
+        {0, 0, 137, 0, 0, 0, 0}, {0, 0, 138, 0, 0, 0, 0},
+        {1, 0, 0, 139, 139, 0, 0}, {9, 0, 140, 0, 0, 0, 0},
+        {9, 0, 0, 141, 141, 0, 0}, {18, 0, 0, 0, 0, 0, 864},
+        {18, 0, 0, 0, 0, 0, 865}, {18, 0, 0, 0, 0, 0, 866},
+        {21, 0, 0, 0, 0, 0, 867}, {18, 0, 0, 0, 0, 0, 868},
+        {18, 0, 0, 0, 0, 0, 869}, {18, 0, 0, 0, 0, 0, 870},
+        {18, 0, 0, 0, 0, 0, 871}, {18, 0, 0, 0, 0, 0, 872},
+        {18, 0, 0, 0, 0, 0, 873}, {18, 0, 0, 0, 0, 0, 874},
+        {18, 0, 0, 0, 0, 0, 875}, {18, 0, 0, 0, 0, 0, 876},
+        {18, 0, 0, 0, 0, 0, 877}, {18, 0, 0, 0, 0, 0, 878},
+        {18, 0, 0, 0, 0, 0, 879}, {18, 0, 0, 0, 0, 0, 880},
+        {18, 0, 0, 0, 0, 0, 881}, {18, 0, 0, 0, 0, 0, 882},
+        {18, 0, 0, 0, 0, 0, 883}, {18, 0, 0, 0, 0, 0, 884},
+        {18, 0, 0, 0, 0, 0, 885}, {18, 0, 0, 0, 0, 0, 886},
+        {18, 0, 0, 0, 0, 0, 887}, {18, 0, 0, 0, 0, 0, 888},
+        {18, 0, 0, 0, 0, 0, 889}, {18, 0, 0, 0, 0, 0, 890},
+        {18, 0, 0, 0, 0, 0, 891}, {18, 0, 0, 0, 0, 0, 892},
+        {18, 0, 0, 0, 0, 0, 893}, {18, 0, 0, 0, 0, 0, 894},
+        {18, 0, 0, 0, 0, 0, 895}, {18, 0, 0, 0, 0, 0, 896},
+        {18, 0, 0, 0, 0, 0, 897}, {18, 0, 0, 0, 0, 0, 898},
+        {18, 0, 0, 0, 0, 0, 899}, {18, 0, 0, 0, 0, 0, 900},
+        {18, 0, 0, 0, 0, 0, 901}, {18, 0, 0, 0, 0, 0, 902},
+        {18, 0, 0, 0, 0, 0, 903}, {18, 0, 0, 0, 0, 0, 904},
+        {18, 0, 0, 0, 0, 0, 905}, {18, 0, 0, 0, 0, 0, 906},
+        {18, 0, 0, 0, 0, 0, 907}, {21, 0, 142, 0, 0, 0, 0},
+        {21, 0, 0, 143, 143, 0, 0}, {18, 0, 0, 0, 0, 0, 908},
+        {0, 0, 144, 0, 0, 0, 0}, {0, 0, 145, 0, 0, 0, 0},
+        {0, 0, 146, 0, 0, 0, 0}, {1, 0, 0, 147, 147, 0, 0},
+        {1, 0, 0, 148, 148, 0, 0}, {0, 0, 149, 0, 0, 0, 0},
+        {0, 0, 150, 0, 0, 0, 0}, {0, 0, 151, 0, 0, 0, 0},
+        {0, 0, 152, 0, 0, 0, 0}, {0, 0, 153, 0, 0, 0, 0},
+        {1, 0, 0, 154, 154, 0, 0}, {6, 224, 0, 0, 0, 0, 0},
+        {4, 0, 0, 0, 0, 0, 909}, {4, 0, 0, 0, 0, 0, 910},
+        {4, 0, 0, 0, 0, 0, 911}, {4, 0, 0, 0, 0, 0, 912},
+        {4, 0, 0, 0, 0, 0, 913}, {4, 0, 0, 0, 0, 0, 914},
+        {4, 0, 0, 0, 0, 0, 915}, {4, 0, 0, 0, 0, 0, 916},
+        {4, 0, 0, 0, 0, 0, 917}, {4, 0, 0, 0, 0, 0, 918},
+        {4, 0, 0, 0, 0, 0, 919}, {4, 0, 0, 0, 0, 0, 920},
+        {4, 0, 0, 0, 0, 0, 921}, {4, 0, 0, 0, 0, 0, 922},
+        {4, 0, 0, 0, 0, 0, 923}, {4, 0, 0, 0, 0, 0, 924},
+        {4, 0, 0, 0, 0, 0, 925}, {4, 0, 0, 0, 0, 0, 926},
+        {4, 0, 0, 0, 0, 0, 927}, {4, 0, 0, 0, 0, 0, 928},
+        {4, 0, 0, 0, 0, 0, 929}, {4, 0, 0, 0, 0, 0, 930},
+        {4, 0, 0, 0, 0, 0, 931}, {4, 0, 0, 0, 0, 0, 932},
+        {4, 0, 0, 0, 0, 0, 933}, {4, 0, 0, 0, 0, 0, 934},
+        {5, 8, 0, 0, 0, 0, 0}, {3, 0, 0, 0, 0, 0, 935},
+        {4, 0, 0, 0, 0, 0, 936}, {4, 0, 0, 0, 0, 0, 937},
+        {4, 0, 0, 0, 0, 0, 938}, {4, 0, 0, 0, 0, 0, 939},
+        {4, 0, 0, 0, 0, 0, 940}, {4, 0, 0, 0, 0, 0, 941},
+        {4, 0, 0, 0, 0, 0, 942}, {4, 0, 0, 0, 0, 0, 943},
+        {4, 0, 0, 0, 0, 0, 944}, {4, 0, 0, 0, 0, 0, 945},
+        {4, 0, 0, 0, 0, 0, 946}, {4, 0, 0, 0, 0, 0, 947},
+        {4, 0, 0, 0, 0, 0, 948}, {4, 0, 0, 0, 0, 0, 949},
+        {4, 0, 0, 0, 0, 0, 950}, {4, 0, 0, 0, 0, 0, 951},
+        {4, 0, 0, 0, 0, 0, 952}, {4, 0, 0, 0, 0, 0, 953},
+        {4, 0, 0, 0, 0, 0, 954}, {4, 0, 0, 0, 0, 0, 955},
+        {4, 0, 0, 0, 0, 0, 956}, {4, 0, 0, 0, 0, 0, 957},
+        {4, 0, 0, 0, 0, 0, 958}, {4, 0, 0, 0, 0, 0, 959},
+        {4, 0, 0, 0, 0, 0, 960}, {4, 0, 0, 0, 0, 0, 961},
+        {4, 0, 0, 0, 0, 0, 962}, {4, 0, 0, 0, 0, 0, 963},
+        {4, 0, 0, 0, 0, 0, 964}, {4, 0, 0, 0, 0, 0, 965},
+        {3, 0, 0, 0, 0, 0, 966}, {0, 0, 155, 0, 0, 0, 0},
+        {0, 0, 156, 0, 0, 0, 0}, {1, 0, 0, 102, 102, 0, 0},
+        {0, 0, 157, 0, 0, 0, 0}, {0, 0, 158, 0, 0, 0, 0},
+        {0, 0, 159, 0, 0, 0, 0}, {0, 0, 160, 0, 0, 0, 0},
+        {0, 0, 161, 0, 0, 0, 0}, {0, 0, 162, 0, 0, 0, 0},
+        {0, 0, 163, 0, 0, 0, 0}, {0, 0, 164, 0, 0, 0, 0},
+        {0, 0, 103, 0, 0, 0, 0}, {0, 0, 165, 0, 0, 0, 0},
+        {0, 0, 166, 0, 0, 0, 0}, {0, 0, 167, 0, 0, 0, 0},
+        {0, 0, 168, 0, 0, 0, 0}, {1, 0, 0, 169, 169, 0, 0},
+        {1, 0, 0, 170, 170, 0, 0}, {27, 0, 0, 0, 0, 0, 0},
+        {28, 0, 0, 0, 0, 0, 0}, {1, 0, 0, 0, 0, 92, 0},
+        {1, 0, 0, 0, 0, 93, 0}, {1, 0, 0, 0, 0, 94, 0},
+        {1, 0, 0, 0, 0, 95, 0}, {1, 0, 0, 0, 0, 96, 0},
+        {1, 0, 0, 0, 0, 97, 0}, {1, 0, 0, 0, 0, 98, 0},
+        {1, 0, 0, 0, 0, 99, 0}, {1, 0, 0, 0, 0, 100, 0},
+        {1, 0, 0, 0, 0, 101, 0}, {1, 0, 0, 0, 0, 102, 0},
+        {1, 0, 0, 0, 0, 103, 0}, {4, 0, 0, 0, 0, 0, 967},
+        {5, 26, 0, 0, 0, 0, 0}, {4, 0, 0, 0, 0, 0, 968},
+        {4, 0, 0, 0, 0, 0, 969}, {4, 0, 0, 0, 0, 0, 970},
+        {4, 0, 0, 0, 0, 0, 971}, {4, 0, 0, 0, 0, 0, 972},
+        {4, 0, 0, 0, 0, 0, 973}, {4, 0, 0, 0, 0, 0, 974},
+        {4, 0, 0, 0, 0, 0, 975}, {4, 0, 0, 0, 0, 0, 976},
+        {4, 0, 0, 0, 0, 0, 977}, {4, 0, 0, 0, 0, 0, 978},
+        {4, 0, 0, 0, 0, 0, 979}, {4, 0, 0, 0, 0, 0, 980},
+        {4, 0, 0, 0, 0, 0, 981}, {4, 0, 0, 0, 0, 0, 982},
+        {4, 0, 0, 0, 0, 0, 983}, {4, 0, 0, 0, 0, 0, 984},
+        {4, 0, 0, 0, 0, 0, 985}, {4, 0, 0, 0, 0, 0, 986},
+        {4, 0, 0, 0, 0, 0, 987}, {4, 0, 0, 0, 0, 0, 988},
+        {4, 0, 0, 0, 0, 0, 989}, {4, 0, 0, 0, 0, 0, 990},
+        {4, 0, 0, 0, 0, 0, 991}, {4, 0, 0, 0, 0, 0, 992},
+        {4, 0, 0, 0, 0, 0, 993}, {4, 0, 0, 0, 0, 0, 994},
+        {4, 0, 0, 0, 0, 0, 995}, {4, 0, 0, 0, 0, 0, 996},
+        {4, 0, 0, 0, 0, 0, 997}, {4, 0, 0, 0, 0, 0, 998},
+        {4, 0, 0, 0, 0, 0, 999}, {4, 0, 0, 0, 0, 0, 1000},
+        {0, 0, 171, 0, 0, 0, 0}, {1, 0, 0, 172, 172, 0, 0},
+        {0, 0, 173, 0, 0, 0, 0}, {1, 0, 0, 174, 174, 0, 0},
+        {4, 0, 0, 0, 0, 0, 1001}, {4, 0, 0, 0, 0, 0, 1002},
+        {0, 0, 79, 0, 0, 0, 0}, {1, 0, 0, 84, 84, 0, 0},
+        {4, 0, 0, 0, 0, 0, 1003}, {4, 0, 0, 0, 0, 0, 1004},
+        {4, 0, 0, 0, 0, 0, 1005}, {5, 0, 0, 0, 0, 0, 1006},
+        {5, 0, 0, 0, 0, 0, 1007}, {6, 0, 0, 0, 0, 0, 1008},
+        {6, 0, 0, 0, 0, 0, 1009}, {4, 0, 0, 0, 0, 0, 1010},
+        {4, 0, 0, 0, 0, 0, 1011}, {4, 0, 0, 0, 0, 0, 1012},
+        {4, 0, 0, 0, 0, 0, 1013}, {6, 0, 0, 0, 0, 0, 1014},
+        {6, 0, 0, 0, 0, 0, 1015}, {6, 0, 0, 0, 0, 0, 1016},
+        {6, 0, 0, 0, 0, 0, 1017}, {6, 0, 0, 0, 0, 0, 1018},
+        {6, 0, 0, 0, 0, 0, 1019}, {6, 0, 0, 0, 0, 0, 1020},
+        {6, 0, 0, 0, 0, 0, 1021}, {6, 0, 0, 0, 0, 0, 1022},
+        {5, 0, 0, 0, 0, 0, 1023}, {5, 0, 0, 0, 0, 0, 1024},
+        {5, 0, 0, 0, 0, 0, 1025}, {5, 0, 0, 0, 0, 0, 1026},
+        {5, 0, 0, 0, 0, 0, 1027}, {5, 0, 0, 0, 0, 0, 1028},
+        {5, 0, 0, 0, 0, 0, 1029}, {5, 0, 0, 0, 0, 0, 1030},
+        {4, 0, 0, 0, 0, 0, 1031}, {4, 0, 0, 0, 0, 0, 1032},
+        {4, 0, 0, 0, 0, 0, 1033}, {6, 6, 0, 0, 0, 0, 0},
+        {21, 0, 0, 0, 0, 0, 1034}, {21, 0, 0, 0, 0, 0, 1035},
+        {21, 0, 0, 0, 0, 0, 1036}, {21, 0, 0, 0, 0, 0, 1037},
+        {21, 0, 0, 0, 0, 0, 1038}, {21, 0, 0, 0, 0, 0, 1039},
+        {21, 0, 0, 0, 0, 0, 1040}, {6, 216, 0, 0, 0, 0, 0},
+        {6, 226, 0, 0, 0, 0, 0}, {21, 0, 0, 0, 0, 0, 1041},
+        {21, 0, 0, 0, 0, 0, 1042}, {21, 0, 0, 0, 0, 0, 1043},
+        {21, 0, 0, 0, 0, 0, 1044}, {21, 0, 0, 0, 0, 0, 1045},
+        {21, 0, 0, 0, 0, 0, 1046}, {0, 0, 175, 0, 0, 0, 0},
+        {1, 0, 0, 176, 176, 0, 0},
+    };
+
+    constexpr int32_t CODEPOINT_PROPERTY_CASE_DELTAS[] =
+    {
+        0, 32, -32, 743, 121, 1, -1, -199,
+        -232, -121, -300, 195, 210, 206, 205, 79,
+        202, 203, 207, 97, 211, 209, 163, 42561,
+        213, 130, 214, 218, 217, 219, 56, 2,
+        -2, -79, -97, -56, -130, 10795, -163, 10792,
+        10815, -195, 69, 71, 10783, 10780, 10782, -210,
+        -206, -205, -202, -203, 42319, 42315, -207, 42343,
+        42280, 42308, -209, -211, 10743, 42305, 10749, -213,
+        -214, 10727, -218, 42307, 42282, -69, -217, -71,
+        -219, 42261, 42258, 84, 116, 38, 37, 64,
+        63, -38, -37, -31, -64, -63, 8, -62,
+        -57, -47, -54, -8, -86, -80, 7, -116,
+        -60, -96, -7, 80, 15, -15, 48, -48,
+        7264, 3008, 38864, -6254, -6253, -6244, -6242, -6243,
+        -6236, -6181, 35266, -3008, 35332, 3814, 35384, -59,
+        -7615, 74, 86, 100, 128, 112, 126, 9,
+        -74, -9, -7205, -100, -112, -128, -126, -7517,
+        -8383, -8262, 28, -28, 16, -16, 26, -26,
+        -10743, -3814, -10727, -10795, -10792, -10780, -10749, -10783,
+        -10782, -10815, -7264, -35332, -42280, -42308, -42319, -42315,
+        -42305, -42258, -42282, -42261, 928, -42307, -35384, -42343,
+        -42561, -928, -38864, 40, -40, 39, -39, 34,
+        -34,
+    };
+
+    constexpr CodepointPropertyTable CODEPOINT_PROPERTY_TABLE =
+    {
+        CODEPOINT_PROPERTY_GROUPS,
+        CODEPOINT_PROPERTY_BLOCKS,
+        CODEPOINT_PROPERTY_INDEXES,
+        CODEPOINT_PROPERTY_RECORDS,
+        CODEPOINT_PROPERTY_CASE_DELTAS
+    };
+}
+
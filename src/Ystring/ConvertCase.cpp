@@ -6,68 +6,21 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include <algorithm>
+#include <bit>
+#include <cstring>
 #include "Ystring/Algorithms.hpp"
-#include "Ystring/CodepointPredicates.hpp"
 #include "Ystring/ConvertCase.hpp"
+#include "ByteSearch.hpp"
+#include "CaseFoldingTables.hpp"
+#include "CodepointPropertiesTables.hpp"
+#include "EncodeUtf8.hpp"
 #include "LowerCaseTables.hpp"
+#include "SpecialCasingTables.hpp"
 #include "TitleCaseTables.hpp"
 #include "UpperCaseTables.hpp"
 
 namespace ystring
 {
-    namespace
-    {
-        constexpr char32_t SEGMENT_MASK = ~(char32_t)0x1F;
-
-        std::optional<char32_t>
-        find_in_compact_mapping(const CompactCharMapping* mapping,
-                                size_t mapping_size,
-                                char32_t codepoint)
-        {
-            const auto* set = std::lower_bound(
-                mapping,
-                mapping + mapping_size,
-                CompactCharMapping{codepoint & SEGMENT_MASK},
-                [](auto& a, auto& b){return a.segment < b.segment;});
-
-            if (set == mapping + mapping_size ||
-                set->segment != (codepoint & SEGMENT_MASK))
-                return {};
-
-            return set->get(codepoint);
-        }
-
-        std::optional<char32_t>
-        find_in_mapping(const CharMapping* mapping,
-                        size_t mapping_size,
-                        char32_t codepoint)
-        {
-            const auto* it = std::lower_bound(
-                mapping,
-                mapping + mapping_size,
-                CharMapping{codepoint},
-                [](const auto& a, const auto& b)
-                {return a.from_codepoint < b.from_codepoint;});
-            if (it == mapping + mapping_size || it->from_codepoint != codepoint)
-                return {};
-
-            return it->to_codepoint;
-        }
-
-        char32_t convert(const CompactCharMapping* compact,
-                         size_t compact_size,
-                         const CharMapping* mapping,
-                         size_t mapping_size,
-                         char32_t codepoint)
-        {
-            if (auto c = find_in_compact_mapping(compact, compact_size, codepoint))
-                return *c;
-            if (auto c = find_in_mapping(mapping, mapping_size, codepoint))
-                return *c;
-            return codepoint;
-        }
-    }
-
     char32_t to_lower(char32_t codepoint)
     {
         if (codepoint < 128)
@@ -76,11 +29,7 @@ namespace ystring
                 return codepoint + 32;
             return codepoint;
         }
-        return convert(COMPACT_LOWER_CASE,
-                       std::size(COMPACT_LOWER_CASE),
-                       LOWER_CASE,
-                       std::size(LOWER_CASE),
-                       codepoint);
+        return LOWER_CASE_TABLE.get(codepoint);
     }
 
     char32_t to_title(char32_t codepoint)
@@ -91,11 +40,7 @@ namespace ystring
                 return codepoint - 32;
             return codepoint;
         }
-        return convert(COMPACT_TITLE_CASE,
-                       std::size(COMPACT_TITLE_CASE),
-                       TITLE_CASE,
-                       std::size(TITLE_CASE),
-                       codepoint);
+        return TITLE_CASE_TABLE.get(codepoint);
     }
 
     char32_t to_upper(char32_t codepoint)
@@ -106,69 +51,691 @@ namespace ystring
                 return codepoint - 32;
             return codepoint;
         }
-        return convert(COMPACT_UPPER_CASE,
-                       std::size(COMPACT_UPPER_CASE),
-                       UPPER_CASE,
-                       std::size(UPPER_CASE),
-                       codepoint);
+        return UPPER_CASE_TABLE.get(codepoint);
     }
 
-    std::string to_lower(std::string_view str)
+    char32_t fold_case(char32_t codepoint)
     {
-        std::string result;
-        result.reserve(str.size());
-        auto it = str.begin();
-        char32_t ch;
-        while (safe_decode_next(it, str.end(), ch))
-            append(result, to_lower(ch));
-        return result;
+        if (codepoint < 128)
+        {
+            if ('A' <= codepoint && codepoint <= 'Z')
+                return codepoint + 32;
+            return codepoint;
+        }
+        return FOLD_CASE_TABLE.get(codepoint);
     }
 
-    std::string to_title(std::string_view str)
+    namespace
     {
-        std::string result;
-        result.reserve(str.size());
-        auto it = str.begin();
-        char32_t ch;
-        bool preceded_by_letter = false;
-        while (safe_decode_next(it, str.end(), ch))
+        /**
+         * @brief The longest UTF-8 sequence a converter can produce for
+         *  a single code point.
+         */
+        constexpr size_t MAX_CONVERTED_SIZE =
+            std::max({size_t(4), MAX_FULL_FOLD_CASE_SIZE,
+                      MAX_SPECIAL_CASING_SIZE});
+
+        /**
+         * @brief Returns the index of @a ch's mapping in the list of
+         *  multi-code-point mappings that belongs to @a utf8_table, or -1
+         *  if @a ch is converted to a single code point.
+         */
+        int32_t get_special_index(const CaseMappingTable& utf8_table,
+                                  char32_t ch)
         {
-            if (!is_letter(ch))
+            auto delta = utf8_table.get_delta(ch);
+            if (delta < UTF8_CASE_SPECIAL || delta == UTF8_CASE_FALLBACK)
+                return -1;
+            return delta - UTF8_CASE_SPECIAL;
+        }
+
+        size_t copy_mapping(std::string_view mapping, char* buffer)
+        {
+            std::memcpy(buffer, mapping.data(), mapping.size());
+            return mapping.size();
+        }
+
+        struct LowerCaseConverter
+        {
+            static uint64_t convert_word(uint64_t word)
             {
-                append(result, ch);
-                preceded_by_letter = false;
+                return to_lower_ascii_word(word);
             }
-            else if (preceded_by_letter)
+
+            static char convert_byte(char c)
             {
-                append(result, to_lower(ch));
+                return 'A' <= c && c <= 'Z' ? char(c + 32) : c;
             }
-            else if (ch != U'ß')
+
+            static size_t convert_codepoint(char32_t ch, char* buffer)
             {
-                append(result, to_title(ch));
-                preceded_by_letter = true;
+                auto index = get_special_index(LOWER_CASE_UTF8_TABLE, ch);
+                if (index >= 0)
+                    return copy_mapping(SPECIAL_CASING[index].lower, buffer);
+                return encode_utf8(to_lower(ch), buffer, MAX_CONVERTED_SIZE);
+            }
+
+            static const CaseMappingTable* utf8_table()
+            {
+                return &LOWER_CASE_UTF8_TABLE;
             }
-            else
+        };
+
+        struct UpperCaseConverter
+        {
+            static uint64_t convert_word(uint64_t word)
+            {
+                return to_upper_ascii_word(word);
+            }
+
+            static char convert_byte(char c)
+            {
+                return 'a' <= c && c <= 'z' ? char(c - 32) : c;
+            }
+
+            static size_t convert_codepoint(char32_t ch, char* buffer)
+            {
+                auto index = get_special_index(UPPER_CASE_UTF8_TABLE, ch);
+                if (index >= 0)
+                    return copy_mapping(SPECIAL_CASING[index].upper, buffer);
+                return encode_utf8(to_upper(ch), buffer, MAX_CONVERTED_SIZE);
+            }
+
+            static const CaseMappingTable* utf8_table()
             {
-                result.append("Ss");
+                return &UPPER_CASE_UTF8_TABLE;
+            }
+        };
+
+        /**
+         * @brief Converts the first letter in each word to title case
+         *  and the remaining letters to lower case.
+         */
+        struct TitleCaseConverter
+        {
+            bool preceded_by_letter = false;
+
+            uint64_t convert_word(uint64_t word)
+            {
+                auto folded = word | (LOW_BITS * 0x20u);
+                auto letters = get_lower_ascii_letters(folded);
+                // Move each byte's letter flag to the byte that follows
+                // it in the string.
+                uint64_t preceded;
+                if constexpr (std::endian::native == std::endian::little)
+                {
+                    preceded = letters << 8u;
+                    if (preceded_by_letter)
+                        preceded |= 0x80u;
+                    preceded_by_letter = (letters >> 56u) != 0;
+                }
+                else
+                {
+                    preceded = letters >> 8u;
+                    if (preceded_by_letter)
+                        preceded |= uint64_t(0x80) << 56u;
+                    preceded_by_letter = (letters & 0x80u) != 0;
+                }
+                auto upper = get_lower_ascii_letters(word) & ~preceded;
+                auto lower = get_upper_ascii_letters(word) & preceded;
+                return word ^ ((upper | lower) >> 2u);
+            }
+
+            char convert_byte(char c)
+            {
+                auto is_lower = 'a' <= c && c <= 'z';
+                auto is_upper = 'A' <= c && c <= 'Z';
+                if (is_lower && !preceded_by_letter)
+                    c = char(c - 32);
+                else if (is_upper && preceded_by_letter)
+                    c = char(c + 32);
+                preceded_by_letter = is_lower || is_upper;
+                return c;
+            }
+
+            /**
+             * @brief Converts @a ch with a single lookup of its
+             *  properties, which tell both whether it is a letter and
+             *  how to convert it.
+             */
+            size_t convert_codepoint(char32_t ch, char* buffer)
+            {
+                const auto& props = CODEPOINT_PROPERTY_TABLE.get(ch);
+                if (!props.is(CharClass::LETTER))
+                {
+                    preceded_by_letter = false;
+                    return encode_utf8(ch, buffer, MAX_CONVERTED_SIZE);
+                }
+
+                // The single code point mappings in SPECIAL_CASING are the
+                // same as the simple ones.
+                const auto* special = props.special_casing != 0
+                                      ? &SPECIAL_CASING[props.special_casing - 1]
+                                      : nullptr;
+                if (preceded_by_letter)
+                {
+                    if (special)
+                        return copy_mapping(special->lower, buffer);
+                    return encode_utf8(CODEPOINT_PROPERTY_TABLE.to_lower(ch, props),
+                                       buffer, MAX_CONVERTED_SIZE);
+                }
+
                 preceded_by_letter = true;
+                if (special)
+                    return copy_mapping(special->title, buffer);
+                return encode_utf8(CODEPOINT_PROPERTY_TABLE.to_title(ch, props),
+                                   buffer, MAX_CONVERTED_SIZE);
+            }
+
+            /**
+             * @brief Returns nullptr, title case depends on whether the
+             *  code points are letters and can't be converted without
+             *  decoding them.
+             */
+            static const CaseMappingTable* utf8_table()
+            {
+                return nullptr;
+            }
+        };
+
+        /**
+         * @brief Applies the full case folding, where some code points
+         *  are folded to several code points (e.g. ß to "ss").
+         */
+        struct FoldCaseConverter
+        {
+            static uint64_t convert_word(uint64_t word)
+            {
+                return to_lower_ascii_word(word);
+            }
+
+            static char convert_byte(char c)
+            {
+                return 'A' <= c && c <= 'Z' ? char(c + 32) : c;
+            }
+
+            static size_t convert_codepoint(char32_t ch, char* buffer)
+            {
+                auto index = get_special_index(FOLD_CASE_UTF8_TABLE, ch);
+                if (index >= 0)
+                    return copy_mapping(FULL_FOLD_CASE[index].mapping, buffer);
+                return encode_utf8(fold_case(ch), buffer, MAX_CONVERTED_SIZE);
+            }
+
+            static const CaseMappingTable* utf8_table()
+            {
+                return &FOLD_CASE_UTF8_TABLE;
+            }
+        };
+
+        /**
+         * @brief Returns the position of the first non-ASCII byte in
+         *  @a str at or after @a offset.
+         */
+        size_t find_ascii_end(std::string_view str, size_t offset)
+        {
+            while (offset + 8 <= str.size()
+                   && (load_word(str.data() + offset) & HIGH_BITS) == 0)
+            {
+                offset += 8;
+            }
+            while (offset < str.size() && uint8_t(str[offset]) < 0x80)
+                ++offset;
+            return offset;
+        }
+
+        /**
+         * @brief Converts the @a size ASCII bytes at @a src eight bytes
+         *  at a time and writes the result to @a dst.
+         *
+         * @a src and @a dst can be the same.
+         */
+        template <typename Converter>
+        void convert_ascii(const char* src, char* dst, size_t size,
+                           Converter& converter)
+        {
+            size_t i = 0;
+            for (; i + 8 <= size; i += 8)
+            {
+                auto word = converter.convert_word(load_word(src + i));
+                std::memcpy(dst + i, &word, sizeof(word));
+            }
+            for (; i < size; ++i)
+                dst[i] = converter.convert_byte(src[i]);
+        }
+
+        /**
+         * @brief Converts the two- or three-byte UTF-8 sequence at @a pos
+         *  in @a str by adding the delta from the UTF-8 @a table to its
+         *  bytes, and writes the result to @a dst.
+         *
+         * @return The length of the sequence, which is also the length of
+         *  the result, or 0 if the sequence isn't a valid two- or
+         *  three-byte sequence or has to be decoded to be converted.
+         */
+        size_t convert_utf8(const CaseMappingTable& table,
+                            std::string_view str, size_t pos, char* dst)
+        {
+            auto b0 = uint8_t(str[pos]);
+            if (b0 < 0xC2 || b0 >= 0xF0 || pos + 1 == str.size())
+                return 0;
+
+            auto b1 = uint8_t(str[pos + 1]);
+            if ((b1 & 0xC0u) != 0x80)
+                return 0;
+
+            if (b0 < 0xE0)
+            {
+                auto ch = char32_t(((b0 & 0x1Fu) << 6u) | (b1 & 0x3Fu));
+                auto delta = table.get_delta(ch);
+                if (delta >= UTF8_CASE_SPECIAL)
+                    return 0;
+                auto bytes = uint32_t(int32_t((b0 << 8u) | b1) + delta);
+                dst[0] = char(bytes >> 8u);
+                dst[1] = char(bytes);
+                return 2;
+            }
+
+            // Reject overlong encodings and surrogates.
+            if (pos + 2 == str.size()
+                || (b0 == 0xE0 && b1 < 0xA0)
+                || (b0 == 0xED && b1 >= 0xA0))
+            {
+                return 0;
+            }
+
+            auto b2 = uint8_t(str[pos + 2]);
+            if ((b2 & 0xC0u) != 0x80)
+                return 0;
+
+            auto ch = char32_t(((b0 & 0x0Fu) << 12u) | ((b1 & 0x3Fu) << 6u)
+                               | (b2 & 0x3Fu));
+            auto delta = table.get_delta(ch);
+            if (delta >= UTF8_CASE_SPECIAL)
+                return 0;
+            auto bytes = uint32_t(int32_t((b0 << 16u) | (b1 << 8u) | b2)
+                                  + delta);
+            dst[0] = char(bytes >> 16u);
+            dst[1] = char(bytes >> 8u);
+            dst[2] = char(bytes);
+            return 3;
+        }
+
+        /**
+         * @brief Converts @a str with @a converter and writes the result
+         *  to @a dst for as long as the converted code points have the
+         *  same lengths as the original ones.
+         *
+         * Runs of ASCII are converted eight bytes at a time. Two- and
+         * three-byte sequences are converted directly on the bytes if the
+         * converter has a UTF-8 table, only the remaining code points are
+         * decoded and converted one by one.
+         *
+         * @param dst Must have room for the converted bytes, at most
+         *  @a str.size(), and can be the same as @a str.data(). Nothing
+         *  is written for the code point whose length changes or the ones
+         *  after it.
+         * @return The number of bytes that were converted. If it is less
+         *  than the size of @a str, it is the position of a code point
+         *  whose converted form has a different length.
+         */
+        template <typename Converter>
+        size_t convert_same_length(std::string_view str, char* dst,
+                                   Converter& converter)
+        {
+            auto* utf8_table = converter.utf8_table();
+            size_t i = 0;
+            while (i < str.size())
+            {
+                auto ascii_end = find_ascii_end(str, i);
+                convert_ascii(str.data() + i, dst + i, ascii_end - i,
+                              converter);
+                i = ascii_end;
+                if (i == str.size())
+                    break;
+
+                if (utf8_table)
+                {
+                    auto start = i;
+                    while (i < str.size() && uint8_t(str[i]) >= 0x80)
+                    {
+                        auto size = convert_utf8(*utf8_table, str, i, dst + i);
+                        if (size == 0)
+                            break;
+                        i += size;
+                    }
+                    if (i != start)
+                        continue;
+                }
+
+                auto it = str.begin() + ptrdiff_t(i);
+                char32_t ch = 0;
+                safe_decode_next(it, str.end(), ch);
+                auto next = size_t(it - str.begin());
+                char buffer[MAX_CONVERTED_SIZE];
+                auto state = converter;
+                auto size = converter.convert_codepoint(ch, buffer);
+                if (size != next - i)
+                {
+                    converter = state;
+                    return i;
+                }
+                std::memcpy(dst + i, buffer, size);
+                i = next;
+            }
+            return i;
+        }
+
+        /**
+         * @brief Converts the code point at @a pos in @a str and writes
+         *  the result to @a buffer.
+         *
+         * @return The position after the code point and the length of
+         *  the result.
+         */
+        template <typename Converter>
+        std::pair<size_t, size_t>
+        convert_next(std::string_view str, size_t pos, Converter& converter,
+                     char* buffer)
+        {
+            auto it = str.begin() + ptrdiff_t(pos);
+            char32_t ch = 0;
+            safe_decode_next(it, str.end(), ch);
+            return {size_t(it - str.begin()),
+                    converter.convert_codepoint(ch, buffer)};
+        }
+
+        /**
+         * @brief Returns the size of @a str converted with @a converter.
+         *
+         * Runs of ASCII are counted without being converted, and two- and
+         * three-byte sequences are only converted if the converter's
+         * UTF-8 table says their lengths change.
+         */
+        template <typename Converter>
+        size_t get_converted_size(std::string_view str, Converter converter)
+        {
+            auto* utf8_table = converter.utf8_table();
+            size_t size = 0;
+            size_t i = 0;
+            while (i < str.size())
+            {
+                auto ascii_end = find_ascii_end(str, i);
+                if (ascii_end != i)
+                {
+                    size += ascii_end - i;
+                    // Only the last byte affects the converter's state.
+                    (void)converter.convert_byte(str[ascii_end - 1]);
+                    i = ascii_end;
+                    if (i == str.size())
+                        break;
+                }
+
+                auto it = str.begin() + ptrdiff_t(i);
+                char32_t ch = 0;
+                safe_decode_next(it, str.end(), ch);
+                auto next = size_t(it - str.begin());
+                if (utf8_table && ch < 0x10000
+                    && utf8_table->get_delta(ch) < UTF8_CASE_SPECIAL)
+                {
+                    size += next - i;
+                }
+                else
+                {
+                    char buffer[MAX_CONVERTED_SIZE];
+                    size += converter.convert_codepoint(ch, buffer);
+                }
+                i = next;
+            }
+            return size;
+        }
+
+        /**
+         * @brief Appends @a str converted with @a converter to @a result.
+         *
+         * The result is written directly into @a result. If a code
+         * point's converted form is longer than the code point, the
+         * exact size of the rest of the result is computed, so
+         * @a result is resized at most once more.
+         */
+        template <typename Converter>
+        std::string& append_converted(std::string_view str,
+                                      std::string& result,
+                                      Converter converter)
+        {
+            auto pos = result.size();
+            result.resize(pos + str.size());
+            bool has_exact_size = false;
+            size_t i = 0;
+            while (true)
+            {
+                auto n = convert_same_length(str.substr(i),
+                                             result.data() + pos, converter);
+                i += n;
+                pos += n;
+                if (i == str.size())
+                    break;
+
+                char buffer[MAX_CONVERTED_SIZE];
+                auto [next, size] = convert_next(str, i, converter, buffer);
+                i = next;
+                if (!has_exact_size
+                    && pos + size + (str.size() - i) > result.size())
+                {
+                    auto rest = get_converted_size(str.substr(i), converter);
+                    result.resize(pos + size + rest);
+                    has_exact_size = true;
+                }
+                std::memcpy(result.data() + pos, buffer, size);
+                pos += size;
+            }
+            result.resize(pos);
+            return result;
+        }
+
+        /**
+         * @brief Writes @a str converted with @a converter to @a buffer,
+         *  and returns the size of the result.
+         *
+         * Once the result no longer fits in @a buffer, the remaining code
+         * points are only converted to compute the size.
+         */
+        template <typename Converter>
+        size_t write_converted(std::string_view str, std::span<char> buffer,
+                               Converter converter)
+        {
+            size_t pos = 0;
+            size_t i = 0;
+            while (i < str.size())
+            {
+                if (pos <= buffer.size()
+                    && str.size() - i <= buffer.size() - pos)
+                {
+                    auto n = convert_same_length(str.substr(i),
+                                                 buffer.data() + pos,
+                                                 converter);
+                    i += n;
+                    pos += n;
+                    if (i == str.size())
+                        break;
+                }
+
+                char chars[MAX_CONVERTED_SIZE];
+                auto [next, size] = convert_next(str, i, converter, chars);
+                i = next;
+                if (pos + size <= buffer.size())
+                    std::memcpy(buffer.data() + pos, chars, size);
+                pos += size;
             }
+            return pos;
         }
-        return result;
+
+        /**
+         * @brief Converts @a str in place until it reaches a code point
+         *  whose converted form has a different length, and from there
+         *  on into a new string that replaces @a str.
+         */
+        template <typename Converter>
+        std::string& convert_in_place(std::string& str, Converter converter)
+        {
+            auto n = convert_same_length(str, str.data(), converter);
+            if (n != str.size())
+            {
+                std::string result;
+                result.reserve(str.size() + str.size() / 8);
+                result.append(str, 0, n);
+                append_converted(std::string_view(str).substr(n), result,
+                                 converter);
+                str.swap(result);
+            }
+            return str;
+        }
+    }
+
+    std::string to_lower(std::string_view str)
+    {
+        std::string result;
+        return append_converted(str, result, LowerCaseConverter());
+    }
+
+    std::string& to_lower(std::string_view str, std::string& result)
+    {
+        return append_converted(str, result, LowerCaseConverter());
+    }
+
+    size_t to_lower(std::string_view str, std::span<char> buffer)
+    {
+        return write_converted(str, buffer, LowerCaseConverter());
+    }
+
+    std::string& to_lower_in_place(std::string& str)
+    {
+        return convert_in_place(str, LowerCaseConverter());
+    }
+
+    size_t get_lower_case_size(std::string_view str)
+    {
+        return get_converted_size(str, LowerCaseConverter());
+    }
+
+    std::string to_title(std::string_view str)
+    {
+        std::string result;
+        return append_converted(str, result, TitleCaseConverter());
+    }
+
+    std::string& to_title(std::string_view str, std::string& result)
+    {
+        return append_converted(str, result, TitleCaseConverter());
+    }
+
+    size_t to_title(std::string_view str, std::span<char> buffer)
+    {
+        return write_converted(str, buffer, TitleCaseConverter());
+    }
+
+    std::string& to_title_in_place(std::string& str)
+    {
+        return convert_in_place(str, TitleCaseConverter());
+    }
+
+    size_t get_title_case_size(std::string_view str)
+    {
+        return get_converted_size(str, TitleCaseConverter());
     }
 
     std::string to_upper(std::string_view str)
     {
         std::string result;
-        result.reserve(str.size());
-        auto it = str.begin();
-        char32_t ch;
-        while (safe_decode_next(it, str.end(), ch))
+        return append_converted(str, result, UpperCaseConverter());
+    }
+
+    std::string& to_upper(std::string_view str, std::string& result)
+    {
+        return append_converted(str, result, UpperCaseConverter());
+    }
+
+    size_t to_upper(std::string_view str, std::span<char> buffer)
+    {
+        return write_converted(str, buffer, UpperCaseConverter());
+    }
+
+    std::string& to_upper_in_place(std::string& str)
+    {
+        return convert_in_place(str, UpperCaseConverter());
+    }
+
+    size_t get_upper_case_size(std::string_view str)
+    {
+        return get_converted_size(str, UpperCaseConverter());
+    }
+
+    std::string fold_case(std::string_view str)
+    {
+        std::string result;
+        return append_converted(str, result, FoldCaseConverter());
+    }
+
+    std::string& fold_case(std::string_view str, std::string& result)
+    {
+        return append_converted(str, result, FoldCaseConverter());
+    }
+
+    size_t fold_case(std::string_view str, std::span<char> buffer)
+    {
+        return write_converted(str, buffer, FoldCaseConverter());
+    }
+
+    std::string& fold_case_in_place(std::string& str)
+    {
+        return convert_in_place(str, FoldCaseConverter());
+    }
+
+    size_t get_case_folded_size(std::string_view str)
+    {
+        return get_converted_size(str, FoldCaseConverter());
+    }
+
+    int32_t compare_folded(std::string_view folded, std::string_view str)
+    {
+        // Fold str a chunk at a time and compare the chunks with the
+        // corresponding parts of folded.
+        constexpr size_t CHUNK_SIZE = 256;
+        char buffer[CHUNK_SIZE + MAX_CONVERTED_SIZE];
+        FoldCaseConverter converter;
+        size_t pos = 0;
+        size_t i = 0;
+        while (i < str.size())
         {
-            if (ch != U'ß')
-                append(result, to_upper(ch));
-            else
-                result.append("SS");
+            size_t size = 0;
+            while (i < str.size() && size < CHUNK_SIZE)
+            {
+                auto ascii_end = std::min(find_ascii_end(str, i),
+                                          i + CHUNK_SIZE - size);
+                convert_ascii(str.data() + i, buffer + size, ascii_end - i,
+                              converter);
+                size += ascii_end - i;
+                i = ascii_end;
+                if (i == str.size() || size == CHUNK_SIZE)
+                    break;
+                auto [next, n] = convert_next(str, i, converter,
+                                              buffer + size);
+                size += n;
+                i = next;
+            }
+
+            auto n = std::min(size, folded.size() - pos);
+            if (auto cmp = std::memcmp(folded.data() + pos, buffer, n))
+                return cmp < 0 ? -1 : 1;
+            if (n < size)
+                return -1;
+            pos += n;
         }
-        return result;
+        return pos == folded.size() ? 0 : 1;
+    }
+
+    bool equal_folded(std::string_view folded, std::string_view str)
+    {
+        return compare_folded(folded, str) == 0;
     }
 }
@@ -0,0 +1,455 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Diff.hpp"
+
+#include <unordered_map>
+#include "Ystring/Algorithms.hpp"
+#include "Ystring/DecodeUtf8.hpp"
+#include "ByteSearch.hpp"
+#include "CodepointPropertiesTables.hpp"
+
+namespace ystring
+{
+    namespace
+    {
+        bool is_continuation(char c)
+        {
+            return (uint8_t(c) & 0xC0u) == 0x80;
+        }
+
+        /**
+         * @brief Returns true if a newline ends at @a pos in @a str.
+         */
+        bool is_after_newline(std::string_view str, size_t pos)
+        {
+            if (pos == 0)
+                return false;
+            switch (str[pos - 1])
+            {
+            case '\n':
+            case '\v':
+            case '\f':
+                return true;
+            case '\r':
+                return pos == str.size() || str[pos] != '\n';
+            case '\x85':
+                return pos >= 2 && str[pos - 2] == '\xC2';
+            case '\xA8':
+            case '\xA9':
+                return pos >= 3 && str[pos - 3] == '\xE2'
+                       && str[pos - 2] == '\x80';
+            default:
+                return false;
+            }
+        }
+
+        /**
+         * @brief Returns true if a unit of the given kind can start or
+         *  end at @a pos in @a str.
+         */
+        bool is_boundary(std::string_view str, size_t pos, DiffUnit unit)
+        {
+            if (pos == 0 || pos == str.size())
+                return true;
+            switch (unit)
+            {
+            case DiffUnit::CHARS:
+            {
+                if (is_continuation(str[pos]))
+                    return false;
+                auto it = str.begin() + ptrdiff_t(pos);
+                auto ch = decode_next(it, str.end());
+                return !CODEPOINT_PROPERTY_TABLE.get(ch).is(CharClass::MARK);
+            }
+            case DiffUnit::LINES:
+                return is_after_newline(str, pos);
+            default:
+                return !is_continuation(str[pos]);
+            }
+        }
+
+        /**
+         * @brief Splits @a str into units and gives each distinct unit
+         *  a number.
+         */
+        class Tokenizer
+        {
+        public:
+            explicit Tokenizer(DiffUnit unit)
+                : m_unit(unit)
+            {}
+
+            /**
+             * @brief Returns the numbers of the units in @a str from
+             *  @a start to @a end.
+             *
+             * The start of each unit and @a end are added to
+             * @a boundaries.
+             */
+            std::vector<uint32_t> tokenize(std::string_view str,
+                                           size_t start, size_t end,
+                                           std::vector<size_t>& boundaries)
+            {
+                std::vector<uint32_t> result;
+                auto pos = start;
+                auto part = str.substr(0, end);
+                while (pos < end)
+                {
+                    boundaries.push_back(pos);
+                    if (m_unit == DiffUnit::CODEPOINTS)
+                    {
+                        auto it = part.begin() + ptrdiff_t(pos);
+                        char32_t ch = 0;
+                        safe_decode_next(it, part.end(), ch);
+                        result.push_back(uint32_t(ch));
+                        pos = size_t(it - part.begin());
+                    }
+                    else
+                    {
+                        auto next = get_unit_end(part, pos);
+                        auto key = part.substr(pos, next - pos);
+                        auto [it, _] = m_ids.emplace(key, uint32_t(m_ids.size()));
+                        result.push_back(it->second);
+                        pos = next;
+                    }
+                }
+                boundaries.push_back(end);
+                return result;
+            }
+        private:
+            size_t get_unit_end(std::string_view str, size_t pos) const
+            {
+                if (m_unit == DiffUnit::CHARS)
+                    return get_next_char_range(str, pos).end();
+                auto newline = find_first_newline(str, pos);
+                return newline ? newline.end() : str.size();
+            }
+
+            DiffUnit m_unit;
+            std::unordered_map<std::string_view, uint32_t> m_ids;
+        };
+
+        /**
+         * @brief Turns the sequence of operations on units produced by
+         *  MyersDiff into DiffChunks with byte ranges.
+         *
+         * Removals and insertions are collected until the next KEEP, so
+         * that the removal always comes first.
+         */
+        class DiffBuilder
+        {
+        public:
+            DiffBuilder(const std::vector<size_t>& old_boundaries,
+                        const std::vector<size_t>& new_boundaries,
+                        std::vector<DiffChunk>& chunks)
+                : m_old_boundaries(old_boundaries),
+                  m_new_boundaries(new_boundaries),
+                  m_chunks(chunks),
+                  m_first_chunk(chunks.size())
+            {}
+
+            void keep(size_t n)
+            {
+                if (n == 0)
+                    return;
+                flush();
+                add(DiffOp::KEEP, m_old, m_old + n, m_new, m_new + n);
+                m_old += n;
+                m_new += n;
+            }
+
+            void remove(size_t n)
+            {
+                m_removed += n;
+            }
+
+            void insert(size_t n)
+            {
+                m_inserted += n;
+            }
+
+            void flush()
+            {
+                if (m_removed != 0)
+                {
+                    add(DiffOp::REMOVE, m_old, m_old + m_removed, m_new, m_new);
+                    m_old += m_removed;
+                    m_removed = 0;
+                }
+                if (m_inserted != 0)
+                {
+                    add(DiffOp::INSERT, m_old, m_old, m_new, m_new + m_inserted);
+                    m_new += m_inserted;
+                    m_inserted = 0;
+                }
+            }
+
+            void add(DiffOp op, Subrange old_range, Subrange new_range)
+            {
+                if (m_chunks.size() > m_first_chunk)
+                {
+                    auto& last = m_chunks.back();
+                    if (last.op == op)
+                    {
+                        last.old_range.length += old_range.length;
+                        last.new_range.length += new_range.length;
+                        return;
+                    }
+                }
+                m_chunks.push_back({op, old_range, new_range});
+            }
+        private:
+            void add(DiffOp op, size_t old_start, size_t old_end,
+                     size_t new_start, size_t new_end)
+            {
+                auto old_offset = m_old_boundaries[old_start];
+                auto new_offset = m_new_boundaries[new_start];
+                add(op,
+                    {old_offset, m_old_boundaries[old_end] - old_offset},
+                    {new_offset, m_new_boundaries[new_end] - new_offset});
+            }
+
+            const std::vector<size_t>& m_old_boundaries;
+            const std::vector<size_t>& m_new_boundaries;
+            std::vector<DiffChunk>& m_chunks;
+            size_t m_first_chunk;
+            size_t m_old = 0;
+            size_t m_new = 0;
+            size_t m_removed = 0;
+            size_t m_inserted = 0;
+        };
+
+        /**
+         * @brief Myers' O(ND) difference algorithm with the linear-space
+         *  refinement.
+         *
+         * The forward and reverse searches meet in the middle of the
+         * edit graph, and the two halves are diffed recursively. The
+         * bookkeeping follows the bisect function of Neil Fraser's
+         * diff-match-patch.
+         */
+        class MyersDiff
+        {
+        public:
+            MyersDiff(const std::vector<uint32_t>& a,
+                      const std::vector<uint32_t>& b,
+                      DiffBuilder& builder)
+                : m_a(a),
+                  m_b(b),
+                  m_builder(builder)
+            {}
+
+            void run()
+            {
+                diff(0, m_a.size(), 0, m_b.size());
+            }
+        private:
+            void diff(size_t a_lo, size_t a_hi, size_t b_lo, size_t b_hi)
+            {
+                size_t prefix = 0;
+                while (a_lo + prefix < a_hi && b_lo + prefix < b_hi
+                       && m_a[a_lo + prefix] == m_b[b_lo + prefix])
+                {
+                    ++prefix;
+                }
+                m_builder.keep(prefix);
+                a_lo += prefix;
+                b_lo += prefix;
+
+                size_t suffix = 0;
+                while (a_lo < a_hi - suffix && b_lo < b_hi - suffix
+                       && m_a[a_hi - suffix - 1] == m_b[b_hi - suffix - 1])
+                {
+                    ++suffix;
+                }
+                a_hi -= suffix;
+                b_hi -= suffix;
+
+                if (a_lo == a_hi || b_lo == b_hi)
+                {
+                    m_builder.remove(a_hi - a_lo);
+                    m_builder.insert(b_hi - b_lo);
+                }
+                else
+                {
+                    bisect(a_lo, a_hi, b_lo, b_hi);
+                }
+                m_builder.keep(suffix);
+            }
+
+            void bisect(size_t a_lo, size_t a_hi, size_t b_lo, size_t b_hi)
+            {
+                auto n = ptrdiff_t(a_hi - a_lo);
+                auto m = ptrdiff_t(b_hi - b_lo);
+                auto a = m_a.data() + a_lo;
+                auto b = m_b.data() + b_lo;
+                auto max_d = (n + m + 1) / 2;
+                auto v_offset = max_d;
+                auto v_length = 2 * max_d + 2;
+                m_v1.assign(size_t(v_length), -1);
+                m_v2.assign(size_t(v_length), -1);
+                m_v1[size_t(v_offset + 1)] = 0;
+                m_v2[size_t(v_offset + 1)] = 0;
+                auto delta = n - m;
+                // If the total number of units is odd, the forward path
+                // will collide with the reverse path.
+                bool front = delta % 2 != 0;
+                ptrdiff_t k1_start = 0, k1_end = 0, k2_start = 0, k2_end = 0;
+
+                for (ptrdiff_t d = 0; d < max_d; ++d)
+                {
+                    for (auto k1 = -d + k1_start; k1 <= d - k1_end; k1 += 2)
+                    {
+                        auto k1_offset = size_t(v_offset + k1);
+                        ptrdiff_t x1;
+                        if (k1 == -d || (k1 != d && m_v1[k1_offset - 1] < m_v1[k1_offset + 1]))
+                            x1 = m_v1[k1_offset + 1];
+                        else
+                            x1 = m_v1[k1_offset - 1] + 1;
+                        auto y1 = x1 - k1;
+                        while (x1 < n && y1 < m && a[x1] == b[y1])
+                        {
+                            ++x1;
+                            ++y1;
+                        }
+                        m_v1[k1_offset] = x1;
+                        if (x1 > n)
+                        {
+                            k1_end += 2;
+                        }
+                        else if (y1 > m)
+                        {
+                            k1_start += 2;
+                        }
+                        else if (front)
+                        {
+                            auto k2_offset = v_offset + delta - k1;
+                            if (k2_offset >= 0 && k2_offset < v_length
+                                && m_v2[size_t(k2_offset)] != -1
+                                && x1 >= n - m_v2[size_t(k2_offset)])
+                            {
+                                split(a_lo, a_hi, b_lo, b_hi, size_t(x1), size_t(y1));
+                                return;
+                            }
+                        }
+                    }
+
+                    for (auto k2 = -d + k2_start; k2 <= d - k2_end; k2 += 2)
+                    {
+                        auto k2_offset = size_t(v_offset + k2);
+                        ptrdiff_t x2;
+                        if (k2 == -d || (k2 != d && m_v2[k2_offset - 1] < m_v2[k2_offset + 1]))
+                            x2 = m_v2[k2_offset + 1];
+                        else
+                            x2 = m_v2[k2_offset - 1] + 1;
+                        auto y2 = x2 - k2;
+                        while (x2 < n && y2 < m && a[n - x2 - 1] == b[m - y2 - 1])
+                        {
+                            ++x2;
+                            ++y2;
+                        }
+                        m_v2[k2_offset] = x2;
+                        if (x2 > n)
+                        {
+                            k2_end += 2;
+                        }
+                        else if (y2 > m)
+                        {
+                            k2_start += 2;
+                        }
+                        else if (!front)
+                        {
+                            auto k1_offset = v_offset + delta - k2;
+                            if (k1_offset >= 0 && k1_offset < v_length
+                                && m_v1[size_t(k1_offset)] != -1)
+                            {
+                                auto x1 = m_v1[size_t(k1_offset)];
+                                auto y1 = v_offset + x1 - k1_offset;
+                                if (x1 >= n - x2)
+                                {
+                                    split(a_lo, a_hi, b_lo, b_hi, size_t(x1), size_t(y1));
+                                    return;
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // The strings have nothing in common.
+                m_builder.remove(size_t(n));
+                m_builder.insert(size_t(m));
+            }
+
+            void split(size_t a_lo, size_t a_hi, size_t b_lo, size_t b_hi,
+                       size_t x, size_t y)
+            {
+                diff(a_lo, a_lo + x, b_lo, b_lo + y);
+                diff(a_lo + x, a_hi, b_lo + y, b_hi);
+            }
+
+            const std::vector<uint32_t>& m_a;
+            const std::vector<uint32_t>& m_b;
+            DiffBuilder& m_builder;
+            std::vector<ptrdiff_t> m_v1;
+            std::vector<ptrdiff_t> m_v2;
+        };
+    }
+
+    size_t diff(std::string_view old_str, std::string_view new_str,
+                std::vector<DiffChunk>& chunks, DiffParams params)
+    {
+        auto first_chunk = chunks.size();
+        auto unit = params.unit;
+
+        auto prefix = get_common_prefix(old_str, new_str);
+        while (prefix > 0 && !(is_boundary(old_str, prefix, unit)
+                               && is_boundary(new_str, prefix, unit)))
+        {
+            --prefix;
+        }
+
+        auto max_suffix = std::min(old_str.size(), new_str.size()) - prefix;
+        auto suffix = std::min(get_common_suffix(old_str, new_str), max_suffix);
+        while (suffix > 0
+               && !(is_boundary(old_str, old_str.size() - suffix, unit)
+                    && is_boundary(new_str, new_str.size() - suffix, unit)))
+        {
+            --suffix;
+        }
+
+        Tokenizer tokenizer(unit);
+        std::vector<size_t> old_boundaries, new_boundaries;
+        auto old_tokens = tokenizer.tokenize(old_str, prefix,
+                                             old_str.size() - suffix,
+                                             old_boundaries);
+        auto new_tokens = tokenizer.tokenize(new_str, prefix,
+                                             new_str.size() - suffix,
+                                             new_boundaries);
+
+        DiffBuilder builder(old_boundaries, new_boundaries, chunks);
+        if (prefix != 0)
+            builder.add(DiffOp::KEEP, {0, prefix}, {0, prefix});
+        MyersDiff(old_tokens, new_tokens, builder).run();
+        builder.flush();
+        if (suffix != 0)
+        {
+            builder.add(DiffOp::KEEP, {old_str.size() - suffix, suffix},
+                        {new_str.size() - suffix, suffix});
+        }
+        return chunks.size() - first_chunk;
+    }
+
+    std::vector<DiffChunk> diff(std::string_view old_str,
+                                std::string_view new_str,
+                                DiffParams params)
+    {
+        std::vector<DiffChunk> result;
+        diff(old_str, new_str, result, params);
+        return result;
+    }
+}
@@ -0,0 +1,364 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/EditDistance.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+#include "Ystring/Algorithms.hpp"
+#include "ByteSearch.hpp"
+#include "CaseInsensitiveSearch.hpp"
+#include "EncodeUtf8.hpp"
+
+namespace ystring
+{
+    namespace
+    {
+        /**
+         * @brief Assigns a number to each distinct code point or character
+         *  in a pattern, and reads the numbers of the code points or
+         *  characters in other strings.
+         *
+         * Number 0 is used for everything that doesn't occur in the
+         * pattern.
+         */
+        class Alphabet
+        {
+        public:
+            Alphabet(const EditDistanceParams& params, bool ascii)
+                : m_params(params),
+                  m_ascii(ascii)
+            {}
+
+            [[nodiscard]]
+            uint32_t size() const
+            {
+                return m_size;
+            }
+
+            uint32_t add_next(std::string_view str, size_t& pos)
+            {
+                return lookup(next_unit(str, pos), true);
+            }
+
+            uint32_t get_next(std::string_view str, size_t& pos)
+            {
+                return lookup(next_unit(str, pos), false);
+            }
+
+            uint32_t get_prev(std::string_view str, size_t& pos)
+            {
+                return lookup(prev_unit(str, pos), false);
+            }
+        private:
+            std::string_view next_unit(std::string_view str, size_t& pos) const
+            {
+                auto start = pos;
+                if (m_ascii)
+                {
+                    ++pos;
+                }
+                else if (m_params.match_chars)
+                {
+                    pos = get_next_char_range(str, pos).end();
+                }
+                else
+                {
+                    auto it = str.begin() + ptrdiff_t(pos);
+                    char32_t ch;
+                    safe_decode_next(it, str.end(), ch);
+                    pos = size_t(it - str.begin());
+                }
+                return str.substr(start, pos - start);
+            }
+
+            std::string_view prev_unit(std::string_view str, size_t& pos) const
+            {
+                auto end = pos;
+                if (m_ascii)
+                {
+                    --pos;
+                }
+                else if (m_params.match_chars)
+                {
+                    pos = get_prev_char_range(str, pos).start();
+                }
+                else
+                {
+                    auto it = str.begin() + ptrdiff_t(pos);
+                    char32_t ch;
+                    safe_decode_prev(str.begin(), it, ch);
+                    pos = size_t(it - str.begin());
+                }
+                return str.substr(pos, end - pos);
+            }
+
+            uint32_t lookup(std::string_view unit, bool add)
+            {
+                if (unit.size() == 1)
+                {
+                    auto c = char32_t(uint8_t(unit[0]));
+                    if (m_params.case_insensitive)
+                        c = fold_for_search(c);
+                    return lookup_ascii(c, add);
+                }
+
+                auto key = unit;
+                if (m_params.case_insensitive)
+                {
+                    m_key.clear();
+                    auto it = unit.begin();
+                    char32_t ch;
+                    while (safe_decode_next(it, unit.end(), ch))
+                        encode_utf8(fold_for_search(ch), std::back_inserter(m_key));
+                    key = m_key;
+                    // Some code points fold to ASCII, e.g. ſ to S, and
+                    // must get the same number as the ASCII character.
+                    if (key.size() == 1)
+                        return lookup_ascii(char32_t(uint8_t(key[0])), add);
+                }
+
+                auto it = m_ids.find(key);
+                if (it != m_ids.end())
+                    return it->second;
+                if (!add)
+                    return 0;
+                m_ids.emplace(std::string(key), m_size);
+                return m_size++;
+            }
+
+            uint32_t lookup_ascii(char32_t c, bool add)
+            {
+                auto& id = m_ascii_ids[c];
+                if (id == 0 && add)
+                    id = m_size++;
+                return id;
+            }
+
+            EditDistanceParams m_params;
+            bool m_ascii;
+            uint32_t m_size = 1;
+            std::array<uint32_t, 128> m_ascii_ids = {};
+            std::map<std::string, uint32_t, std::less<>> m_ids;
+            std::string m_key;
+        };
+
+        std::vector<uint32_t> read_units(Alphabet& alphabet,
+                                         std::string_view str)
+        {
+            std::vector<uint32_t> result;
+            size_t pos = 0;
+            while (pos < str.size())
+                result.push_back(alphabet.add_next(str, pos));
+            return result;
+        }
+
+        /**
+         * @brief The bit masks of Myers' algorithm: for each number in
+         *  the alphabet, the positions in the pattern where it occurs.
+         */
+        struct BitPattern
+        {
+            BitPattern(const std::vector<uint32_t>& units, uint32_t alphabet_size)
+                : length(units.size()),
+                  words((units.size() + 63) / 64),
+                  masks(alphabet_size * words)
+            {
+                for (size_t i = 0; i < units.size(); ++i)
+                    masks[units[i] * words + i / 64] |= uint64_t(1) << (i % 64);
+            }
+
+            [[nodiscard]]
+            const uint64_t* get_masks(uint32_t unit) const
+            {
+                return masks.data() + unit * words;
+            }
+
+            size_t length;
+            size_t words;
+            std::vector<uint64_t> masks;
+        };
+
+        /**
+         * @brief Updates the vertical deltas of one 64-row block of the
+         *  dynamic programming matrix, and returns the horizontal delta
+         *  at the block's last row.
+         *
+         * This is the block step from Myers, "A fast bit-vector algorithm
+         * for approximate string matching based on dynamic programming"
+         * (1999). @a h_in is the horizontal delta entering the block's
+         * first row, @a last_row has the bit of the block's last row.
+         */
+        int advance_block(uint64_t& pv, uint64_t& mv, uint64_t eq, int h_in,
+                          uint64_t last_row)
+        {
+            auto xv = eq | mv;
+            if (h_in < 0)
+                eq |= 1u;
+            auto xh = (((eq & pv) + pv) ^ pv) | eq;
+            auto ph = mv | ~(xh | pv);
+            auto mh = pv & xh;
+            int h_out = 0;
+            if (ph & last_row)
+                h_out = 1;
+            else if (mh & last_row)
+                h_out = -1;
+            ph <<= 1u;
+            mh <<= 1u;
+            if (h_in < 0)
+                mh |= 1u;
+            else if (h_in > 0)
+                ph |= 1u;
+            pv = mh | ~(xv | ph);
+            mv = ph & xv;
+            return h_out;
+        }
+
+        /**
+         * @brief The last column of the edit distance matrix between
+         *  a pattern and the part of a string that has been read so far.
+         */
+        class BitParallelDistance
+        {
+        public:
+            explicit BitParallelDistance(const BitPattern& pattern)
+                : m_pattern(pattern),
+                  m_pv(pattern.words, ~uint64_t(0)),
+                  m_mv(pattern.words, 0),
+                  m_last_row(uint64_t(1) << ((pattern.length - 1) % 64)),
+                  m_score(pattern.length)
+            {}
+
+            /**
+             * @brief The edit distance between the pattern and the string.
+             */
+            [[nodiscard]]
+            size_t score() const
+            {
+                return m_score;
+            }
+
+            /**
+             * @brief Adds @a unit to the string.
+             *
+             * @param h_in 1 when computing the distance to the entire
+             *  string, 0 when searching for the pattern in the string.
+             */
+            void advance(uint32_t unit, int h_in)
+            {
+                auto eq = m_pattern.get_masks(unit);
+                auto last = m_pattern.words - 1;
+                for (size_t i = 0; i < last; ++i)
+                    h_in = advance_block(m_pv[i], m_mv[i], eq[i], h_in,
+                                         uint64_t(1) << 63u);
+                h_in = advance_block(m_pv[last], m_mv[last], eq[last], h_in,
+                                     m_last_row);
+                m_score = size_t(ptrdiff_t(m_score) + h_in);
+            }
+        private:
+            const BitPattern& m_pattern;
+            std::vector<uint64_t> m_pv;
+            std::vector<uint64_t> m_mv;
+            uint64_t m_last_row;
+            size_t m_score;
+        };
+
+        size_t edit_distance_impl(std::string_view a, std::string_view b,
+                                  size_t max_distance,
+                                  const EditDistanceParams& params)
+        {
+            if (a.size() > b.size())
+                std::swap(a, b);
+
+            Alphabet alphabet(params, is_ascii(a) && is_ascii(b));
+            auto units = read_units(alphabet, a);
+            size_t pos = 0;
+            if (units.empty())
+            {
+                size_t count = 0;
+                while (pos < b.size() && count <= max_distance)
+                {
+                    alphabet.get_next(b, pos);
+                    ++count;
+                }
+                return count;
+            }
+
+            BitPattern pattern(units, alphabet.size());
+            BitParallelDistance distance(pattern);
+            while (pos < b.size())
+            {
+                distance.advance(alphabet.get_next(b, pos), 1);
+                // The distance can decrease by at most one for each
+                // remaining code point, and there are at most as many
+                // of them as there are bytes.
+                if (distance.score() > max_distance
+                    && distance.score() - max_distance > b.size() - pos)
+                {
+                    return max_distance + 1;
+                }
+            }
+            return distance.score();
+        }
+    }
+
+    size_t edit_distance(std::string_view a, std::string_view b,
+                         EditDistanceParams params)
+    {
+        return edit_distance_impl(a, b, SIZE_MAX - 1, params);
+    }
+
+    size_t bounded_edit_distance(std::string_view a, std::string_view b,
+                                 size_t max_distance,
+                                 EditDistanceParams params)
+    {
+        return edit_distance_impl(a, b, std::min(max_distance, SIZE_MAX - 1),
+                                  params);
+    }
+
+    Subrange find_approximate(std::string_view str, std::string_view pattern,
+                              size_t max_distance, EditDistanceParams params)
+    {
+        Alphabet alphabet(params, is_ascii(str) && is_ascii(pattern));
+        auto units = read_units(alphabet, pattern);
+        if (units.size() <= max_distance)
+            return {0, 0};
+
+        BitPattern forward(units, alphabet.size());
+        BitParallelDistance distance(forward);
+        size_t end = 0;
+        while (distance.score() > max_distance)
+        {
+            if (end == str.size())
+                return {};
+            distance.advance(alphabet.get_next(str, end), 0);
+        }
+
+        // Compute the distance between the pattern and the substrings
+        // ending at end, from the shortest to the longest, by matching
+        // the reversed pattern against the string from end and back.
+        std::reverse(units.begin(), units.end());
+        BitPattern backward(units, alphabet.size());
+        BitParallelDistance reverse_distance(backward);
+        auto start = end;
+        auto best = reverse_distance.score();
+        auto pos = end;
+        for (size_t i = 0; i < units.size() + max_distance && pos > 0; ++i)
+        {
+            reverse_distance.advance(alphabet.get_prev(str, pos), 1);
+            if (reverse_distance.score() < best)
+            {
+                best = reverse_distance.score();
+                start = pos;
+            }
+        }
+        return {start, end - start};
+    }
+}
@@ -0,0 +1,415 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Glob.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+#include "Ystring/Algorithms.hpp"
+#include "Ystring/YstringException.hpp"
+#include "CaseInsensitiveSearch.hpp"
+#include "CodepointPropertiesTables.hpp"
+
+namespace ystring
+{
+    namespace
+    {
+        struct GlobToken
+        {
+            enum class Type
+            {
+                CODEPOINT,
+                CHAR,
+                ANY,
+                SET
+            };
+
+            Type type = Type::ANY;
+            /**
+             * @brief The code point when type is CODEPOINT, folded if the
+             *  match is case-insensitive.
+             */
+            char32_t codepoint = 0;
+            /**
+             * @brief The UTF-8 encoded literal when type is CODEPOINT
+             *  or CHAR.
+             */
+            std::string literal;
+            size_t set_index = 0;
+        };
+
+        struct GlobSegment
+        {
+            size_t first_token = 0;
+            size_t token_count = 0;
+            /**
+             * @brief Set if the segment consists of CODEPOINT tokens only.
+             */
+            std::optional<std::string> literal;
+            std::optional<CaseInsensitiveSearcher> searcher;
+            /**
+             * @brief The number of 64-bit words in the shift-and state
+             *  and masks.
+             */
+            size_t word_count = 0;
+            /**
+             * @brief The shift-and masks for each ASCII character,
+             *  word_count words per character.
+             */
+            std::vector<uint64_t> ascii_masks;
+        };
+
+        /**
+         * @brief A code point or character in the string that is matched.
+         */
+        struct Unit
+        {
+            size_t start;
+            size_t end;
+            char32_t codepoint;
+        };
+
+        size_t find_set_end(std::string_view pattern, size_t pos)
+        {
+            for (size_t i = pos + 1; i < pattern.size(); ++i)
+            {
+                if (pattern[i] == '\\')
+                    ++i;
+                else if (pattern[i] == ']')
+                    return i + 1;
+            }
+            YSTRING_THROW("Unterminated set in glob pattern: "
+                          + std::string(pattern));
+        }
+    }
+
+    struct Glob::Data
+    {
+        GlobParams params;
+        std::vector<GlobToken> tokens;
+        std::vector<CodepointSet> sets;
+        /**
+         * @brief The parts of the pattern between the '*'s.
+         *
+         * The first and last segments are anchored at the start and end
+         * of the string, and can be empty.
+         */
+        std::vector<GlobSegment> segments;
+
+        Data(std::string_view pattern, GlobParams params)
+            : params(params)
+        {
+            segments.emplace_back();
+            size_t i = 0;
+            while (i < pattern.size())
+            {
+                switch (pattern[i])
+                {
+                case '*':
+                    segments.back().token_count =
+                        tokens.size() - segments.back().first_token;
+                    segments.emplace_back().first_token = tokens.size();
+                    while (i < pattern.size() && pattern[i] == '*')
+                        ++i;
+                    break;
+                case '?':
+                    tokens.push_back({GlobToken::Type::ANY});
+                    ++i;
+                    break;
+                case '[':
+                {
+                    auto end = find_set_end(pattern, i);
+                    sets.push_back(parse_codepoint_set(
+                        pattern.substr(i, end - i)));
+                    tokens.push_back({GlobToken::Type::SET});
+                    tokens.back().set_index = sets.size() - 1;
+                    i = end;
+                    break;
+                }
+                case '\\':
+                    if (++i == pattern.size())
+                        YSTRING_THROW("Glob pattern ends with '\\'.");
+                    i = add_literal(pattern, i);
+                    break;
+                default:
+                    i = add_literal(pattern, i);
+                    break;
+                }
+            }
+            segments.back().token_count =
+                tokens.size() - segments.back().first_token;
+
+            for (auto& segment : segments)
+                prepare_segment(segment);
+        }
+
+        size_t add_literal(std::string_view pattern, size_t pos)
+        {
+            auto it = pattern.begin() + ptrdiff_t(pos);
+            char32_t ch;
+            safe_decode_next(it, pattern.end(), ch);
+            GlobToken token;
+            token.type = GlobToken::Type::CODEPOINT;
+            token.codepoint = params.case_insensitive ? fold_for_search(ch) : ch;
+
+            if (params.match_chars)
+            {
+                auto next = it;
+                while (safe_decode_next(next, pattern.end(), ch)
+                       && CODEPOINT_PROPERTY_TABLE.get(ch).is(CharClass::MARK))
+                {
+                    it = next;
+                }
+                token.type = GlobToken::Type::CHAR;
+            }
+
+            auto end = size_t(it - pattern.begin());
+            token.literal = pattern.substr(pos, end - pos);
+            tokens.push_back(std::move(token));
+            return end;
+        }
+
+        void prepare_segment(GlobSegment& segment)
+        {
+            auto first = tokens.begin() + ptrdiff_t(segment.first_token);
+            auto last = first + ptrdiff_t(segment.token_count);
+            if (segment.token_count != 0
+                && std::all_of(first, last, [](auto& t)
+                    {return t.type == GlobToken::Type::CODEPOINT;}))
+            {
+                std::string literal;
+                for (auto it = first; it != last; ++it)
+                    literal += it->literal;
+                if (params.case_insensitive)
+                    segment.searcher.emplace(literal);
+                segment.literal = std::move(literal);
+                return;
+            }
+
+            segment.word_count = (segment.token_count + 63) / 64;
+            segment.ascii_masks.resize(128 * segment.word_count);
+            for (char32_t c = 0; c < 128; ++c)
+            {
+                char ascii = char(c);
+                Unit unit{0, 1, c};
+                get_mask(segment, {&ascii, 1}, unit,
+                         &segment.ascii_masks[c * segment.word_count]);
+            }
+        }
+
+        /**
+         * @brief Sets the bits in @a mask for the tokens in @a segment
+         *  that match @a unit.
+         */
+        void get_mask(const GlobSegment& segment, std::string_view str,
+                      const Unit& unit, uint64_t* mask) const
+        {
+            std::fill(mask, mask + segment.word_count, 0);
+            for (size_t i = 0; i < segment.token_count; ++i)
+            {
+                if (matches(tokens[segment.first_token + i], str, unit))
+                    mask[i / 64] |= uint64_t(1) << (i % 64);
+            }
+        }
+
+        bool next_unit(std::string_view str, size_t pos, Unit& unit) const
+        {
+            auto it = str.begin() + ptrdiff_t(pos);
+            if (!safe_decode_next(it, str.end(), unit.codepoint))
+                return false;
+            unit.start = pos;
+            unit.end = size_t(it - str.begin());
+            if (params.match_chars)
+                unit.end = get_next_char_range(str, pos).end();
+            return true;
+        }
+
+        bool prev_unit_start(std::string_view str, size_t& pos) const
+        {
+            if (pos == 0)
+                return false;
+            if (params.match_chars)
+            {
+                pos = get_prev_char_range(str, pos).start();
+            }
+            else
+            {
+                auto it = str.begin() + ptrdiff_t(pos);
+                skip_prev(str.begin(), it);
+                pos = size_t(it - str.begin());
+            }
+            return true;
+        }
+
+        bool matches(const GlobToken& token, std::string_view str,
+                     const Unit& unit) const
+        {
+            switch (token.type)
+            {
+            case GlobToken::Type::CODEPOINT:
+                if (params.case_insensitive)
+                    return fold_for_search(unit.codepoint) == token.codepoint;
+                return unit.codepoint == token.codepoint;
+            case GlobToken::Type::CHAR:
+            {
+                auto chars = str.substr(unit.start, unit.end - unit.start);
+                if (params.case_insensitive)
+                    return case_insensitive::equal(chars, token.literal);
+                return chars == token.literal;
+            }
+            case GlobToken::Type::SET:
+                if (params.case_insensitive)
+                    return sets[token.set_index].case_insensitive_contains(unit.codepoint);
+                return sets[token.set_index].contains(unit.codepoint);
+            default:
+                return true;
+            }
+        }
+
+        /**
+         * @brief Matches @a segment at @a pos and returns the end of
+         *  the match, or npos.
+         */
+        size_t match_at(const GlobSegment& segment, std::string_view str,
+                        size_t pos) const
+        {
+            Unit unit{};
+            for (size_t i = 0; i < segment.token_count; ++i)
+            {
+                if (!next_unit(str, pos, unit)
+                    || !matches(tokens[segment.first_token + i], str, unit))
+                {
+                    return std::string_view::npos;
+                }
+                pos = unit.end;
+            }
+            return pos;
+        }
+
+        /**
+         * @brief Returns the end of the match of @a segment that starts
+         *  at or after @a pos and ends first, or npos.
+         */
+        size_t find_segment(const GlobSegment& segment, std::string_view str,
+                            size_t pos) const
+        {
+            if (segment.literal)
+            {
+                if (segment.searcher)
+                {
+                    auto match = segment.searcher->find_first(str, pos);
+                    return match ? match.end() : std::string_view::npos;
+                }
+                auto start = str.find(*segment.literal, pos);
+                if (start == std::string_view::npos)
+                    return start;
+                return start + segment.literal->size();
+            }
+
+            if (segment.word_count == 1)
+                return find_segment_short(segment, str, pos);
+
+            // Bit i in state is set if the first i + 1 tokens match the
+            // units that end at pos.
+            auto words = segment.word_count;
+            auto last_word = (segment.token_count - 1) / 64;
+            auto accept = uint64_t(1) << ((segment.token_count - 1) % 64);
+            std::vector<uint64_t> state(words);
+            std::vector<uint64_t> unit_mask(words);
+            Unit unit{};
+            while (next_unit(str, pos, unit))
+            {
+                const uint64_t* mask;
+                if (unit.codepoint < 128 && unit.end == unit.start + 1)
+                {
+                    mask = &segment.ascii_masks[unit.codepoint * words];
+                }
+                else
+                {
+                    get_mask(segment, str, unit, unit_mask.data());
+                    mask = unit_mask.data();
+                }
+                for (size_t w = words - 1; w != 0; --w)
+                    state[w] = ((state[w] << 1u) | (state[w - 1] >> 63u))
+                               & mask[w];
+                state[0] = ((state[0] << 1u) | 1u) & mask[0];
+                pos = unit.end;
+                if (state[last_word] & accept)
+                    return pos;
+            }
+            return std::string_view::npos;
+        }
+
+        /**
+         * @brief find_segment for segments with at most 64 tokens.
+         */
+        size_t find_segment_short(const GlobSegment& segment,
+                                  std::string_view str, size_t pos) const
+        {
+            auto accept = uint64_t(1) << (segment.token_count - 1);
+            uint64_t state = 0;
+            Unit unit{};
+            while (next_unit(str, pos, unit))
+            {
+                uint64_t mask;
+                if (unit.codepoint < 128 && unit.end == unit.start + 1)
+                    mask = segment.ascii_masks[unit.codepoint];
+                else
+                    get_mask(segment, str, unit, &mask);
+                state = ((state << 1u) | 1u) & mask;
+                pos = unit.end;
+                if (state & accept)
+                    return pos;
+            }
+            return std::string_view::npos;
+        }
+
+        bool match(std::string_view str) const
+        {
+            auto& head = segments.front();
+            auto pos = match_at(head, str, 0);
+            if (pos == std::string_view::npos)
+                return false;
+            if (segments.size() == 1)
+                return pos == str.size();
+
+            for (size_t i = 1; i + 1 < segments.size(); ++i)
+            {
+                if (segments[i].token_count == 0)
+                    continue;
+                pos = find_segment(segments[i], str, pos);
+                if (pos == std::string_view::npos)
+                    return false;
+            }
+
+            auto& tail = segments.back();
+            auto start = str.size();
+            for (size_t i = 0; i < tail.token_count; ++i)
+            {
+                if (!prev_unit_start(str, start))
+                    return false;
+            }
+            return start >= pos && match_at(tail, str, start) == str.size();
+        }
+    };
+
+    Glob::Glob(std::string_view pattern, GlobParams params)
+        : m_data(std::make_shared<Data>(pattern, params))
+    {}
+
+    bool Glob::match(std::string_view str) const
+    {
+        return m_data->match(str);
+    }
+
+    bool match_glob(std::string_view str, std::string_view pattern,
+                    GlobParams params)
+    {
+        return Glob(pattern, params).match(str);
+    }
+}
@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <vector>
+#include "CodepointPropertiesTables.hpp"
 #include "NormalizationTables.hpp"
 #include "Ystring/DecodeUtf8.hpp"
 #include "EncodeUtf8.hpp"
@@ -21,13 +22,12 @@ namespace ystring
         {
             if (ch < 0xC0)
                 return {ch, 0};
-            auto it = std::lower_bound(std::begin(TO_DECOMPOSED),
-                                       std::end(TO_DECOMPOSED),
-                                       uint64_t(ch) << 40u);
-            if (it == std::end(TO_DECOMPOSED) || char32_t(*it >> 40u) != ch)
+            auto index = CODEPOINT_PROPERTY_TABLE.get(ch).decomposition;
+            if (index == 0)
                 return {ch, 0};
-            return {char32_t((*it >> 20u) & 0xFFFFFu),
-                    char32_t(*it & 0xFFFFFu)};
+            auto value = TO_DECOMPOSED[index - 1];
+            return {char32_t((value >> 20u) & 0xFFFFFu),
+                    char32_t(value & 0xFFFFFu)};
         }
 
         char32_t find_composed(char32_t ch, char32_t mark)
@@ -0,0 +1,257 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Parallel.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include "Ystring/Algorithms.hpp"
+
+namespace ystring
+{
+    namespace
+    {
+        bool is_continuation(char c)
+        {
+            return (uint8_t(c) & 0xC0u) == 0x80;
+        }
+
+        /**
+         * @brief Returns the start of each chunk followed by the size
+         *  of @a str.
+         *
+         * Each boundary is moved past at most three continuation bytes,
+         * which puts it on a code point boundary unless @a str is invalid.
+         */
+        std::vector<size_t>
+        get_chunk_boundaries(std::string_view str, const ParallelParams& params)
+        {
+            size_t threads = params.max_threads;
+            if (threads == 0)
+                threads = std::max(std::thread::hardware_concurrency(), 1u);
+            auto min_size = std::max(params.min_chunk_size, size_t(1));
+            auto n = std::max(std::min(threads, str.size() / min_size),
+                              size_t(1));
+
+            std::vector<size_t> boundaries{0};
+            for (size_t i = 1; i < n; ++i)
+            {
+                auto pos = str.size() / n * i;
+                for (int j = 0; j < 3 && pos < str.size(); ++j)
+                {
+                    if (!is_continuation(str[pos]))
+                        break;
+                    ++pos;
+                }
+                if (pos > boundaries.back())
+                    boundaries.push_back(pos);
+            }
+            boundaries.push_back(str.size());
+            return boundaries;
+        }
+
+        template <typename Result>
+        struct ChunkResult
+        {
+            Result value = {};
+            std::exception_ptr error;
+        };
+
+        /**
+         * @brief Calls @a func with the start and end of each chunk,
+         *  one thread per chunk.
+         *
+         * The first chunk is processed by the calling thread. Chunks are
+         * also processed by the calling thread if a new thread can't be
+         * started.
+         */
+        template <typename Result, typename Func>
+        std::vector<ChunkResult<Result>>
+        run_chunks(const std::vector<size_t>& boundaries, Func func)
+        {
+            auto n = boundaries.size() - 1;
+            std::vector<ChunkResult<Result>> results(n);
+            auto run = [&](size_t i)
+            {
+                try
+                {
+                    results[i].value = func(boundaries[i], boundaries[i + 1]);
+                }
+                catch (...)
+                {
+                    results[i].error = std::current_exception();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(n);
+            size_t started = 1;
+            try
+            {
+                for (; started < n; ++started)
+                    threads.emplace_back(run, started);
+            }
+            catch (const std::system_error&)
+            {}
+
+            run(0);
+            for (auto i = started; i < n; ++i)
+                run(i);
+            for (auto& thread : threads)
+                thread.join();
+            return results;
+        }
+
+        template <typename Chars>
+        std::pair<Subrange, char32_t>
+        find_first_of_impl(std::string_view str, const Chars& chars,
+                           const ParallelParams& params)
+        {
+            auto boundaries = get_chunk_boundaries(str, params);
+            if (boundaries.size() == 2)
+                return find_first_of(str, chars);
+
+            using Result = std::pair<Subrange, char32_t>;
+            auto results = run_chunks<Result>(
+                boundaries,
+                [&](size_t start, size_t end)
+                {
+                    auto result = find_first_of(
+                        str.substr(start, end - start), chars);
+                    if (result.first)
+                        result.first.offset += start;
+                    return result;
+                });
+
+            for (auto& result : results)
+            {
+                if (result.error)
+                    std::rethrow_exception(result.error);
+                if (result.value.first)
+                    return result.value;
+            }
+            return {Subrange(std::string_view::npos), INVALID_CHAR};
+        }
+    }
+
+    namespace parallel
+    {
+        std::vector<Subrange>
+        find_all(std::string_view str, std::string_view cmp,
+                 ParallelParams params)
+        {
+            auto boundaries = get_chunk_boundaries(str, params);
+            if (boundaries.size() == 2 || cmp.empty())
+                return ystring::find_all(str, cmp);
+
+            auto chunks = run_chunks<std::vector<Subrange>>(
+                boundaries,
+                [&](size_t start, size_t end)
+                {
+                    auto limit = std::min(end + cmp.size() - 1, str.size());
+                    std::vector<Subrange> matches;
+                    ystring::find_all(
+                        str.substr(start, limit - start), cmp,
+                        [&](Subrange m)
+                        {
+                            matches.push_back({m.offset + start, m.length});
+                        });
+                    return matches;
+                });
+
+            std::vector<Subrange> result;
+            for (size_t i = 0; i < chunks.size(); ++i)
+            {
+                auto& matches = chunks[i].value;
+                auto chunk_end = boundaries[i + 1];
+                auto pos = result.empty() ? 0 : result.back().end();
+                size_t k = 0;
+                // The chunk's search started at the chunk boundary, which
+                // may be inside the previous chunk's last match. Search
+                // sequentially until the chunk's matches can be trusted.
+                while (true)
+                {
+                    while (k < matches.size() && matches[k].start() < pos)
+                        ++k;
+                    if (k == 0 || matches[k - 1].end() <= pos)
+                        break;
+
+                    auto p = str.find(cmp, pos);
+                    if (p == std::string_view::npos || p >= chunk_end)
+                    {
+                        k = matches.size();
+                        break;
+                    }
+                    if (k < matches.size() && matches[k].start() == p)
+                        break;
+                    result.push_back({p, cmp.size()});
+                    pos = p + cmp.size();
+                }
+                result.insert(result.end(), matches.begin() + ptrdiff_t(k),
+                              matches.end());
+            }
+            return result;
+        }
+
+        Subrange find_first(std::string_view str, std::string_view cmp,
+                            ParallelParams params)
+        {
+            auto boundaries = get_chunk_boundaries(str, params);
+            if (boundaries.size() == 2 || cmp.empty())
+                return ystring::find_first(str, cmp);
+
+            auto results = run_chunks<size_t>(
+                boundaries,
+                [&](size_t start, size_t end)
+                {
+                    auto limit = std::min(end + cmp.size() - 1, str.size());
+                    return str.substr(0, limit).find(cmp, start);
+                });
+
+            for (auto& result : results)
+            {
+                if (result.value != std::string_view::npos)
+                    return {result.value, cmp.size()};
+            }
+            return {str.size(), 0};
+        }
+
+        std::pair<Subrange, char32_t>
+        find_first_of(std::string_view str, std::u32string_view chars,
+                      ParallelParams params)
+        {
+            return find_first_of_impl(str, chars, params);
+        }
+
+        std::pair<Subrange, char32_t>
+        find_first_of(std::string_view str, const CodepointSet& chars,
+                      ParallelParams params)
+        {
+            return find_first_of_impl(str, chars, params);
+        }
+
+        bool is_valid_utf8(std::string_view str, ParallelParams params)
+        {
+            auto boundaries = get_chunk_boundaries(str, params);
+            if (boundaries.size() == 2)
+                return ystring::is_valid_utf8(str);
+
+            auto results = run_chunks<bool>(
+                boundaries,
+                [&](size_t start, size_t end)
+                {
+                    return ystring::is_valid_utf8(
+                        str.substr(start, end - start));
+                });
+
+            return std::all_of(results.begin(), results.end(),
+                               [](auto& r) {return r.value;});
+        }
+    }
+}
@@ -0,0 +1,349 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/PrefixIndex.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include "Ystring/YstringException.hpp"
+#include "CaseInsensitiveSearch.hpp"
+#include "EncodeUtf8.hpp"
+
+namespace ystring
+{
+    namespace
+    {
+        /**
+         * @brief A node in the compressed trie.
+         *
+         * The node's label is the part of the keys between the end of the
+         * parent's label and the end of this one. All the keys in the
+         * range [first_key, end_key) of the sorted keys start with the
+         * concatenated labels from the root to this node, and the ones in
+         * [first_key, terminal_end) end here.
+         */
+        struct TrieNode
+        {
+            uint32_t label_start = 0;
+            uint32_t label_end = 0;
+            uint32_t first_child = 0;
+            uint32_t child_count = 0;
+            uint32_t first_key = 0;
+            uint32_t terminal_end = 0;
+            uint32_t end_key = 0;
+        };
+
+        /**
+         * @brief A position in the trie: the current node and the
+         *  position in the node's label.
+         */
+        struct TrieCursor
+        {
+            uint32_t node = 0;
+            uint32_t pos = 0;
+        };
+
+        /**
+         * @brief Calls @a callback with the bytes of each code point in
+         *  @a str, folded if @a case_insensitive is true, and the
+         *  position in @a str after the code point.
+         *
+         * If @a case_insensitive is false, every byte is passed
+         * separately. Stops and returns false if @a callback returns
+         * false.
+         */
+        template <typename Callback>
+        bool for_each_folded(std::string_view str, bool case_insensitive,
+                             Callback callback)
+        {
+            if (!case_insensitive)
+            {
+                for (size_t i = 0; i < str.size(); ++i)
+                {
+                    if (!callback(&str[i], 1, i + 1))
+                        return false;
+                }
+                return true;
+            }
+
+            char buffer[4];
+            auto it = str.begin();
+            while (it != str.end())
+            {
+                auto c = char32_t(uint8_t(*it));
+                size_t length = 1;
+                if (c < 0x80)
+                {
+                    buffer[0] = char(fold_for_search(c));
+                    ++it;
+                }
+                else
+                {
+                    char32_t ch = 0;
+                    safe_decode_next(it, str.end(), ch);
+                    length = encode_utf8(fold_for_search(ch), buffer,
+                                         sizeof(buffer));
+                }
+                if (!callback(buffer, length, size_t(it - str.begin())))
+                    return false;
+            }
+            return true;
+        }
+    }
+
+    struct PrefixIndex::Data
+    {
+        PrefixIndexParams params;
+        /**
+         * @brief The folded keys, in their original order.
+         */
+        std::string keys;
+        /**
+         * @brief The original indices of the keys, in sorted order.
+         */
+        std::vector<size_t> order;
+        /**
+         * @brief The trie nodes in breadth-first order. The root is
+         *  the first node.
+         */
+        std::vector<TrieNode> nodes;
+        /**
+         * @brief The first byte in each node's label.
+         *
+         * Kept apart from the nodes to make the binary search over a
+         * node's children touch as little memory as possible.
+         */
+        std::vector<uint8_t> first_bytes;
+
+        template <typename StrList>
+        Data(const StrList& key_list, PrefixIndexParams params)
+            : params(params)
+        {
+            std::vector<size_t> offsets;
+            offsets.reserve(key_list.size() + 1);
+            for (const auto& key : key_list)
+            {
+                offsets.push_back(keys.size());
+                for_each_folded(key, params.case_insensitive,
+                                [&](const char* bytes, size_t length, size_t)
+                                {
+                                    keys.append(bytes, length);
+                                    return true;
+                                });
+            }
+            offsets.push_back(keys.size());
+            if (keys.size() >= UINT32_MAX || key_list.size() >= UINT32_MAX)
+                YSTRING_THROW("Too many keys for a PrefixIndex.");
+
+            auto get_folded_key = [&](size_t k)
+            {
+                return std::string_view(keys).substr(offsets[k],
+                                                     offsets[k + 1] - offsets[k]);
+            };
+            auto get_key = [&](size_t i)
+            {
+                return get_folded_key(order[i]);
+            };
+
+            order.resize(key_list.size());
+            std::iota(order.begin(), order.end(), size_t(0));
+            // string_view compares chars as unsigned, which puts the keys
+            // in the same order as their code points.
+            std::stable_sort(order.begin(), order.end(),
+                             [&](size_t a, size_t b)
+                             {
+                                 return get_folded_key(a) < get_folded_key(b);
+                             });
+
+            TrieNode root;
+            root.end_key = uint32_t(order.size());
+            nodes.push_back(root);
+            first_bytes.push_back(0);
+            // The length of the prefix that ends at each node.
+            std::vector<size_t> depths{0};
+
+            for (size_t i = 0; i < nodes.size(); ++i)
+            {
+                auto depth = depths[i];
+                size_t pos = nodes[i].first_key;
+                size_t end = nodes[i].end_key;
+                while (pos < end && get_key(pos).size() == depth)
+                    ++pos;
+                nodes[i].terminal_end = uint32_t(pos);
+                nodes[i].first_child = uint32_t(nodes.size());
+
+                while (pos < end)
+                {
+                    auto first = get_key(pos);
+                    auto byte = uint8_t(first[depth]);
+                    auto group_end = pos + 1;
+                    while (group_end < end
+                           && uint8_t(get_key(group_end)[depth]) == byte)
+                    {
+                        ++group_end;
+                    }
+
+                    // The keys are sorted, so the common prefix of the
+                    // first and last keys is shared by all of them.
+                    auto last = get_key(group_end - 1);
+                    auto child_depth = depth + 1;
+                    auto max_depth = std::min(first.size(), last.size());
+                    while (child_depth < max_depth
+                           && first[child_depth] == last[child_depth])
+                    {
+                        ++child_depth;
+                    }
+
+                    TrieNode child;
+                    child.label_start = uint32_t(offsets[order[pos]] + depth);
+                    child.label_end = uint32_t(offsets[order[pos]] + child_depth);
+                    child.first_key = uint32_t(pos);
+                    child.end_key = uint32_t(group_end);
+                    nodes.push_back(child);
+                    first_bytes.push_back(byte);
+                    depths.push_back(child_depth);
+                    pos = group_end;
+                }
+
+                nodes[i].child_count = uint32_t(nodes.size()
+                                                - nodes[i].first_child);
+            }
+        }
+
+        /**
+         * @brief Moves @a cursor past @a byte, or returns false if
+         *  no key continues with @a byte.
+         */
+        bool advance(TrieCursor& cursor, uint8_t byte) const
+        {
+            const auto& node = nodes[cursor.node];
+            if (cursor.pos != node.label_end)
+            {
+                if (uint8_t(keys[cursor.pos]) != byte)
+                    return false;
+                ++cursor.pos;
+                return true;
+            }
+
+            auto first = first_bytes.begin() + node.first_child;
+            auto last = first + node.child_count;
+            auto it = std::lower_bound(first, last, byte);
+            if (it == last || *it != byte)
+                return false;
+            cursor.node = uint32_t(it - first_bytes.begin());
+            cursor.pos = nodes[cursor.node].label_start + 1;
+            return true;
+        }
+
+        /**
+         * @brief Moves @a cursor past the folded @a str, and calls
+         *  @a callback after each code point.
+         *
+         * Returns false if there are no keys that start with all of
+         * @a str.
+         */
+        template <typename Callback>
+        bool walk(TrieCursor& cursor, std::string_view str,
+                  Callback callback) const
+        {
+            return for_each_folded(
+                str, params.case_insensitive,
+                [&](const char* bytes, size_t length, size_t str_pos)
+                {
+                    for (size_t i = 0; i < length; ++i)
+                    {
+                        if (!advance(cursor, uint8_t(bytes[i])))
+                            return false;
+                    }
+                    callback(cursor, str_pos);
+                    return true;
+                });
+        }
+
+        /**
+         * @brief Returns the node if @a cursor is at the end of a node
+         *  where one or more keys end, otherwise nullptr.
+         */
+        const TrieNode* get_terminal(const TrieCursor& cursor) const
+        {
+            const auto& node = nodes[cursor.node];
+            if (cursor.pos == node.label_end
+                && node.terminal_end != node.first_key)
+            {
+                return &node;
+            }
+            return nullptr;
+        }
+    };
+
+    PrefixIndex::PrefixIndex()
+        : PrefixIndex(std::vector<std::string_view>())
+    {}
+
+    PrefixIndex::PrefixIndex(const std::vector<std::string_view>& keys,
+                             PrefixIndexParams params)
+        : m_data(std::make_shared<Data>(keys, params))
+    {}
+
+    PrefixIndex::PrefixIndex(const std::vector<std::string>& keys,
+                             PrefixIndexParams params)
+        : m_data(std::make_shared<Data>(keys, params))
+    {}
+
+    size_t PrefixIndex::size() const
+    {
+        return m_data->order.size();
+    }
+
+    bool PrefixIndex::empty() const
+    {
+        return m_data->order.empty();
+    }
+
+    std::span<const size_t>
+    PrefixIndex::find_keys(std::string_view prefix) const
+    {
+        TrieCursor cursor;
+        if (!m_data->walk(cursor, prefix, [](auto&, size_t) {}))
+            return {};
+        const auto& node = m_data->nodes[cursor.node];
+        return {m_data->order.data() + node.first_key,
+                size_t(node.end_key - node.first_key)};
+    }
+
+    PrefixMatch PrefixIndex::find_longest_prefix(std::string_view str) const
+    {
+        PrefixMatch result;
+        TrieCursor cursor;
+        auto update = [&](const TrieCursor& c, size_t str_pos)
+        {
+            if (auto node = m_data->get_terminal(c))
+                result = {m_data->order[node->first_key], str_pos};
+        };
+        update(cursor, 0);
+        m_data->walk(cursor, str, update);
+        return result;
+    }
+
+    size_t PrefixIndex::find_prefixes(std::string_view str,
+                                      std::vector<PrefixMatch>& matches) const
+    {
+        auto initial_size = matches.size();
+        TrieCursor cursor;
+        auto add = [&](const TrieCursor& c, size_t str_pos)
+        {
+            if (auto node = m_data->get_terminal(c))
+            {
+                for (auto i = node->first_key; i != node->terminal_end; ++i)
+                    matches.push_back({m_data->order[i], str_pos});
+            }
+        };
+        add(cursor, 0);
+        m_data->walk(cursor, str, add);
+        return matches.size() - initial_size;
+    }
+}
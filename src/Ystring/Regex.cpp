@@ -0,0 +1,1206 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Regex.hpp"
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include "Ystring/CharClass.hpp"
+#include "Ystring/CodepointConstants.hpp"
+#include "Ystring/CodepointSet.hpp"
+#include "Ystring/ConvertCase.hpp"
+#include "Ystring/DecodeUtf8.hpp"
+#include "Ystring/YstringException.hpp"
+#include "EncodeUtf8.hpp"
+
+namespace ystring
+{
+    namespace
+    {
+        constexpr unsigned UNBOUNDED = ~0u;
+        constexpr unsigned MAX_REPETITIONS = 1000;
+        constexpr size_t MAX_NFA_STATES = 1u << 20u;
+        constexpr size_t MAX_DFA_STATES = 4096;
+
+        struct RegexNode
+        {
+            enum class Type
+            {
+                EMPTY,
+                SET,
+                CONCAT,
+                ALTERNATION,
+                REPEAT,
+                BEGIN,
+                END
+            };
+
+            Type type = Type::EMPTY;
+            /**
+             * @brief The code points matched by a SET node.
+             */
+            std::vector<CodepointRange> ranges;
+            std::vector<RegexNode> children;
+            unsigned min = 0;
+            unsigned max = 0;
+            bool greedy = true;
+        };
+
+        struct CharClassName
+        {
+            std::string_view name;
+            uint32_t char_classes;
+        };
+
+        constexpr CharClassName CHAR_CLASS_NAMES[] =
+            {
+                {"C", CharClass::OTHER},
+                {"Cc", CharClass::CONTROL},
+                {"Cf", CharClass::FORMAT},
+                {"Cn", CharClass::UNASSIGNED},
+                {"Co", CharClass::PRIVATE_USE},
+                {"Cs", CharClass::SURROGATE},
+                {"L", CharClass::LETTER},
+                {"LC", CharClass::CASED_LETTER},
+                {"Ll", CharClass::LOWERCASE_LETTER},
+                {"Lm", CharClass::MODIFIER_LETTER},
+                {"Lo", CharClass::OTHER_LETTER},
+                {"Lt", CharClass::TITLECASE_LETTER},
+                {"Lu", CharClass::UPPERCASE_LETTER},
+                {"M", CharClass::MARK},
+                {"Mc", CharClass::SPACING_MARK},
+                {"Me", CharClass::ENCLOSING_MARK},
+                {"Mn", CharClass::NONSPACING_MARK},
+                {"N", CharClass::NUMBER},
+                {"Nd", CharClass::DECIMAL_NUMBER},
+                {"Nl", CharClass::LETTER_NUMBER},
+                {"No", CharClass::OTHER_NUMBER},
+                {"P", CharClass::PUNCTUATION},
+                {"Pc", CharClass::CONNECTOR_PUNCTUATION},
+                {"Pd", CharClass::DASH_PUNCTUATION},
+                {"Pe", CharClass::CLOSE_PUNCTUATION},
+                {"Pf", CharClass::FINAL_PUNCTUATION},
+                {"Pi", CharClass::INITIAL_PUNCTUATION},
+                {"Po", CharClass::OTHER_PUNCTUATION},
+                {"Ps", CharClass::OPEN_PUNCTUATION},
+                {"S", CharClass::SYMBOL},
+                {"Sc", CharClass::CURRENCY_SYMBOL},
+                {"Sk", CharClass::MODIFIER_SYMBOL},
+                {"Sm", CharClass::MATH_SYMBOL},
+                {"So", CharClass::OTHER_SYMBOL},
+                {"Z", CharClass::SEPARATOR},
+                {"Zl", CharClass::LINE_SEPARATOR},
+                {"Zp", CharClass::PARAGRAPH_SEPARATOR},
+                {"Zs", CharClass::SPACE_SEPARATOR}
+            };
+
+        /**
+         * @brief Returns all code points that have a different upper,
+         *  lower or title case.
+         */
+        const std::vector<char32_t>& get_cased_codepoints()
+        {
+            static const std::vector<char32_t> result = []
+            {
+                std::vector<char32_t> codepoints;
+                for (char32_t c = 0; c < 0x20000; ++c)
+                {
+                    if (to_upper(c) != c || to_lower(c) != c
+                        || to_title(c) != c)
+                    {
+                        codepoints.push_back(c);
+                    }
+                }
+                return codepoints;
+            }();
+            return result;
+        }
+
+        CodepointSet get_positive(const CodepointSet& set)
+        {
+            if (!set.negated)
+                return set;
+            return complement(CodepointSet{set.ranges});
+        }
+
+        /**
+         * @brief Adds every code point that @a set contains when case
+         *  is ignored.
+         */
+        void add_case_variants(CodepointSet& set)
+        {
+            std::vector<char32_t> variants;
+            for (auto c : get_cased_codepoints())
+            {
+                if (!set.contains(c) && set.case_insensitive_contains(c))
+                    variants.push_back(c);
+            }
+            for (auto c : variants)
+                set.add_codepoint(c);
+        }
+
+        RegexNode make_set_node(const CodepointSet& set)
+        {
+            RegexNode node;
+            node.type = RegexNode::Type::SET;
+            node.ranges = get_positive(set).ranges;
+            return node;
+        }
+
+        class RegexParser
+        {
+        public:
+            RegexParser(std::string_view pattern, const RegexParams& params)
+                : m_pattern(pattern),
+                  m_params(params)
+            {}
+
+            RegexNode parse()
+            {
+                auto node = parse_alternation();
+                if (m_pos != m_pattern.size())
+                    error("unmatched ')'");
+                return node;
+            }
+        private:
+            [[noreturn]]
+            void error(const std::string& message) const
+            {
+                YSTRING_THROW("Invalid regular expression \""
+                              + std::string(m_pattern) + "\": " + message
+                              + " at position " + std::to_string(m_pos)
+                              + ".");
+            }
+
+            [[nodiscard]]
+            bool at_end() const
+            {
+                return m_pos == m_pattern.size();
+            }
+
+            bool skip(char c)
+            {
+                if (at_end() || m_pattern[m_pos] != c)
+                    return false;
+                ++m_pos;
+                return true;
+            }
+
+            RegexNode parse_alternation()
+            {
+                auto node = parse_concatenation();
+                if (at_end() || m_pattern[m_pos] != '|')
+                    return node;
+
+                RegexNode result;
+                result.type = RegexNode::Type::ALTERNATION;
+                result.children.push_back(std::move(node));
+                while (skip('|'))
+                    result.children.push_back(parse_concatenation());
+                return result;
+            }
+
+            RegexNode parse_concatenation()
+            {
+                RegexNode result;
+                result.type = RegexNode::Type::CONCAT;
+                while (!at_end() && m_pattern[m_pos] != '|'
+                       && m_pattern[m_pos] != ')')
+                {
+                    result.children.push_back(parse_repetition());
+                }
+                if (result.children.size() == 1)
+                    return std::move(result.children.front());
+                return result;
+            }
+
+            RegexNode parse_repetition()
+            {
+                auto node = parse_atom();
+                while (!at_end())
+                {
+                    unsigned min, max;
+                    switch (m_pattern[m_pos])
+                    {
+                    case '*':
+                        min = 0;
+                        max = UNBOUNDED;
+                        ++m_pos;
+                        break;
+                    case '+':
+                        min = 1;
+                        max = UNBOUNDED;
+                        ++m_pos;
+                        break;
+                    case '?':
+                        min = 0;
+                        max = 1;
+                        ++m_pos;
+                        break;
+                    case '{':
+                        parse_bounds(min, max);
+                        break;
+                    default:
+                        return node;
+                    }
+
+                    RegexNode repeat;
+                    repeat.type = RegexNode::Type::REPEAT;
+                    repeat.min = min;
+                    repeat.max = max;
+                    repeat.greedy = !skip('?');
+                    repeat.children.push_back(std::move(node));
+                    node = std::move(repeat);
+                }
+                return node;
+            }
+
+            unsigned parse_number()
+            {
+                auto start = m_pos;
+                unsigned value = 0;
+                while (!at_end() && '0' <= m_pattern[m_pos]
+                       && m_pattern[m_pos] <= '9')
+                {
+                    value = value * 10 + unsigned(m_pattern[m_pos++] - '0');
+                    if (value > MAX_REPETITIONS)
+                        error("too many repetitions");
+                }
+                if (m_pos == start)
+                    error("expected a number");
+                return value;
+            }
+
+            void parse_bounds(unsigned& min, unsigned& max)
+            {
+                ++m_pos;
+                min = max = parse_number();
+                if (skip(','))
+                {
+                    max = UNBOUNDED;
+                    if (!at_end() && m_pattern[m_pos] != '}')
+                        max = parse_number();
+                }
+                if (!skip('}'))
+                    error("expected '}'");
+                if (max < min)
+                    error("the maximum is less than the minimum");
+            }
+
+            RegexNode parse_atom()
+            {
+                switch (m_pattern[m_pos])
+                {
+                case '(':
+                {
+                    ++m_pos;
+                    if (m_pattern.substr(m_pos, 2) == "?:")
+                        m_pos += 2;
+                    auto node = parse_alternation();
+                    if (!skip(')'))
+                        error("missing ')'");
+                    return node;
+                }
+                case '[':
+                    return parse_set();
+                case '.':
+                {
+                    ++m_pos;
+                    RegexNode node;
+                    node.type = RegexNode::Type::SET;
+                    node.ranges = {{0, '\n' - 1}, {'\n' + 1, UNICODE_MAX}};
+                    return node;
+                }
+                case '^':
+                {
+                    ++m_pos;
+                    RegexNode node;
+                    node.type = RegexNode::Type::BEGIN;
+                    return node;
+                }
+                case '$':
+                {
+                    ++m_pos;
+                    RegexNode node;
+                    node.type = RegexNode::Type::END;
+                    return node;
+                }
+                case '*':
+                case '+':
+                case '?':
+                case '{':
+                    error("nothing to repeat");
+                case ']':
+                case '}':
+                    error("unescaped '" + std::string(1, m_pattern[m_pos])
+                          + "'");
+                case '\\':
+                    return parse_escape();
+                default:
+                    return make_literal_node(decode_codepoint());
+                }
+            }
+
+            char32_t decode_codepoint()
+            {
+                auto it = m_pattern.begin() + ptrdiff_t(m_pos);
+                char32_t ch;
+                if (!safe_decode_next(it, m_pattern.end(), ch))
+                    error("unexpected end");
+                m_pos = size_t(it - m_pattern.begin());
+                return ch;
+            }
+
+            RegexNode make_literal_node(char32_t ch) const
+            {
+                CodepointSet set;
+                set.add_codepoint(ch);
+                if (m_params.case_insensitive)
+                    add_case_variants(set);
+                return make_set_node(set);
+            }
+
+            RegexNode parse_set()
+            {
+                auto start = m_pos;
+                for (++m_pos; !at_end(); ++m_pos)
+                {
+                    if (m_pattern[m_pos] == '\\')
+                    {
+                        ++m_pos;
+                    }
+                    else if (m_pattern[m_pos] == ']')
+                    {
+                        ++m_pos;
+                        auto set = parse_codepoint_set(
+                            m_pattern.substr(start, m_pos - start));
+                        if (!m_params.case_insensitive)
+                            return make_set_node(set);
+
+                        CodepointSet positive{set.ranges};
+                        add_case_variants(positive);
+                        positive.negated = set.negated;
+                        return make_set_node(positive);
+                    }
+                }
+                m_pos = start;
+                error("unterminated set");
+            }
+
+            RegexNode parse_escape()
+            {
+                if (++m_pos == m_pattern.size())
+                    error("the pattern ends with '\\'");
+                auto c = m_pattern[m_pos++];
+                switch (c)
+                {
+                case 'd':
+                case 'D':
+                    return make_class_node(CharClass::DECIMAL_NUMBER, c == 'D');
+                case 'w':
+                case 'W':
+                    return make_class_node(CharClass::LETTER | CharClass::MARK
+                                           | CharClass::DECIMAL_NUMBER
+                                           | CharClass::CONNECTOR_PUNCTUATION,
+                                           c == 'W');
+                case 's':
+                case 'S':
+                {
+                    auto set = make_codepoint_set(CharClass::SEPARATOR);
+                    set.add_range('\t', '\r');
+                    set.add_codepoint(0x85);
+                    if (c == 'S')
+                        set = complement(set);
+                    return make_set_node(set);
+                }
+                case 'p':
+                case 'P':
+                    return make_class_node(parse_class_name(), c == 'P');
+                case 'n':
+                    return make_literal_node('\n');
+                case 'r':
+                    return make_literal_node('\r');
+                case 't':
+                    return make_literal_node('\t');
+                case 'f':
+                    return make_literal_node('\f');
+                case 'v':
+                    return make_literal_node('\v');
+                case 'x':
+                    return make_literal_node(parse_hex_codepoint());
+                default:
+                    if (('0' <= c && c <= '9') || ('A' <= c && c <= 'Z')
+                        || ('a' <= c && c <= 'z'))
+                    {
+                        --m_pos;
+                        error("unsupported escape sequence");
+                    }
+                    --m_pos;
+                    return make_literal_node(decode_codepoint());
+                }
+            }
+
+            static RegexNode make_class_node(uint32_t char_classes,
+                                             bool negated)
+            {
+                auto set = make_codepoint_set(char_classes);
+                if (negated)
+                    set = complement(set);
+                return make_set_node(set);
+            }
+
+            uint32_t parse_class_name()
+            {
+                std::string_view name;
+                if (skip('{'))
+                {
+                    auto end = m_pattern.find('}', m_pos);
+                    if (end == std::string_view::npos)
+                        error("expected '}'");
+                    name = m_pattern.substr(m_pos, end - m_pos);
+                    m_pos = end + 1;
+                }
+                else if (!at_end())
+                {
+                    name = m_pattern.substr(m_pos++, 1);
+                }
+
+                for (auto& entry : CHAR_CLASS_NAMES)
+                {
+                    if (entry.name == name)
+                        return entry.char_classes;
+                }
+                error("unknown character class \"" + std::string(name) + "\"");
+            }
+
+            char32_t parse_hex_codepoint()
+            {
+                auto braces = skip('{');
+                auto start = m_pos;
+                char32_t value = 0;
+                while (!at_end() && (braces || m_pos - start < 2))
+                {
+                    auto c = m_pattern[m_pos];
+                    unsigned digit;
+                    if ('0' <= c && c <= '9')
+                        digit = unsigned(c - '0');
+                    else if ('A' <= c && c <= 'F')
+                        digit = unsigned(c - 'A' + 10);
+                    else if ('a' <= c && c <= 'f')
+                        digit = unsigned(c - 'a' + 10);
+                    else
+                        break;
+                    value = value * 16 + digit;
+                    if (value > UNICODE_MAX)
+                        error("the code point is too large");
+                    ++m_pos;
+                }
+                if (m_pos == start || (!braces && m_pos - start != 2))
+                    error("expected hexadecimal digits");
+                if (braces && !skip('}'))
+                    error("expected '}'");
+                return value;
+            }
+
+            std::string_view m_pattern;
+            RegexParams m_params;
+            size_t m_pos = 0;
+        };
+
+        /**
+         * @brief Returns the UTF-8 encoded literal that all matches of
+         *  @a root start with.
+         */
+        std::string get_literal_prefix(const RegexNode& root)
+        {
+            auto is_literal = [](const RegexNode& node)
+            {
+                return node.type == RegexNode::Type::SET
+                       && node.ranges.size() == 1
+                       && node.ranges[0].first == node.ranges[0].second;
+            };
+
+            std::string result;
+            if (is_literal(root))
+            {
+                encode_utf8(root.ranges[0].first, std::back_inserter(result));
+            }
+            else if (root.type == RegexNode::Type::CONCAT)
+            {
+                for (auto& child : root.children)
+                {
+                    if (!is_literal(child))
+                        break;
+                    encode_utf8(child.ranges[0].first,
+                                std::back_inserter(result));
+                }
+            }
+            return result;
+        }
+
+        using ByteRange = std::pair<uint8_t, uint8_t>;
+
+        struct Utf8Sequence
+        {
+            std::array<ByteRange, 4> bytes;
+            size_t length = 0;
+        };
+
+        /**
+         * @brief Adds byte sequences that together match the UTF-8
+         *  encodings of all code points from @a first to @a last.
+         *
+         * The range is split until every byte of the encoded code points
+         * in each part is a contiguous range of values.
+         */
+        void add_utf8_sequences(char32_t first, char32_t last,
+                                std::vector<Utf8Sequence>& sequences)
+        {
+            last = std::min(last, UNICODE_MAX);
+            if (first > last)
+                return;
+
+            if (first <= 0xDFFF && last >= 0xD800)
+            {
+                if (first < 0xD800)
+                    add_utf8_sequences(first, 0xD7FF, sequences);
+                if (last > 0xDFFF)
+                    add_utf8_sequences(0xE000, last, sequences);
+                return;
+            }
+
+            for (char32_t max : {0x7Fu, 0x7FFu, 0xFFFFu})
+            {
+                if (first <= max && max < last)
+                {
+                    add_utf8_sequences(first, max, sequences);
+                    add_utf8_sequences(max + 1, last, sequences);
+                    return;
+                }
+            }
+
+            for (unsigned i = 1; i < 4; ++i)
+            {
+                char32_t mask = (char32_t(1) << (6 * i)) - 1;
+                if ((first & ~mask) == (last & ~mask))
+                    continue;
+                if ((first & mask) != 0)
+                {
+                    add_utf8_sequences(first, first | mask, sequences);
+                    add_utf8_sequences((first | mask) + 1, last, sequences);
+                    return;
+                }
+                if ((last & mask) != mask)
+                {
+                    add_utf8_sequences(first, (last & ~mask) - 1, sequences);
+                    add_utf8_sequences(last & ~mask, last, sequences);
+                    return;
+                }
+            }
+
+            char first_bytes[4] = {}, last_bytes[4] = {};
+            Utf8Sequence sequence;
+            sequence.length = encode_utf8(first, first_bytes, 4);
+            encode_utf8(last, last_bytes, 4);
+            for (size_t i = 0; i < sequence.length; ++i)
+                sequence.bytes[i] = {uint8_t(first_bytes[i]),
+                                     uint8_t(last_bytes[i])};
+            sequences.push_back(sequence);
+        }
+
+        struct NfaState
+        {
+            enum class Type : uint8_t
+            {
+                BYTES,
+                SPLIT,
+                BEGIN,
+                END,
+                MATCH
+            };
+
+            Type type = Type::MATCH;
+            uint8_t first = 0;
+            uint8_t last = 0;
+            /**
+             * @brief The state that follows this one. For SPLIT states,
+             *  the preferred one of the two.
+             */
+            uint32_t next = 0;
+            uint32_t alt = 0;
+        };
+
+        struct Nfa
+        {
+            std::vector<NfaState> states;
+            uint32_t start = 0;
+        };
+
+        /**
+         * @brief Compiles a RegexNode tree to an NFA over UTF-8 bytes.
+         *
+         * When @a reverse is true, the NFA matches the reverse of the
+         * byte sequences matched by the pattern, with the meaning of the
+         * anchors swapped.
+         */
+        class NfaCompiler
+        {
+        public:
+            explicit NfaCompiler(bool reverse)
+                : m_reverse(reverse)
+            {}
+
+            Nfa compile(const RegexNode& root)
+            {
+                auto match = add({NfaState::Type::MATCH});
+                m_nfa.start = compile(root, match);
+                return std::move(m_nfa);
+            }
+        private:
+            uint32_t add(const NfaState& state)
+            {
+                if (m_nfa.states.size() == MAX_NFA_STATES)
+                    YSTRING_THROW("The regular expression is too large.");
+                m_nfa.states.push_back(state);
+                return uint32_t(m_nfa.states.size() - 1);
+            }
+
+            uint32_t add_split(uint32_t preferred, uint32_t other)
+            {
+                return add({NfaState::Type::SPLIT, 0, 0, preferred, other});
+            }
+
+            uint32_t compile(const RegexNode& node, uint32_t next)
+            {
+                switch (node.type)
+                {
+                case RegexNode::Type::SET:
+                    return compile_set(node, next);
+                case RegexNode::Type::CONCAT:
+                    if (m_reverse)
+                    {
+                        for (auto& child : node.children)
+                            next = compile(child, next);
+                    }
+                    else
+                    {
+                        for (auto it = node.children.rbegin();
+                             it != node.children.rend(); ++it)
+                        {
+                            next = compile(*it, next);
+                        }
+                    }
+                    return next;
+                case RegexNode::Type::ALTERNATION:
+                {
+                    std::vector<uint32_t> entries;
+                    for (auto& child : node.children)
+                        entries.push_back(compile(child, next));
+                    auto result = entries.back();
+                    for (size_t i = entries.size() - 1; i-- > 0;)
+                        result = add_split(entries[i], result);
+                    return result;
+                }
+                case RegexNode::Type::REPEAT:
+                    return compile_repeat(node, next);
+                case RegexNode::Type::BEGIN:
+                    return add({m_reverse ? NfaState::Type::END
+                                          : NfaState::Type::BEGIN,
+                                0, 0, next});
+                case RegexNode::Type::END:
+                    return add({m_reverse ? NfaState::Type::BEGIN
+                                          : NfaState::Type::END,
+                                0, 0, next});
+                default:
+                    return next;
+                }
+            }
+
+            uint32_t compile_set(const RegexNode& node, uint32_t next)
+            {
+                std::vector<Utf8Sequence> sequences;
+                for (auto [first, last] : node.ranges)
+                    add_utf8_sequences(first, last, sequences);
+                if (sequences.empty())
+                {
+                    // A set that matches nothing.
+                    return add({NfaState::Type::BYTES, 1, 0, next});
+                }
+
+                std::vector<uint32_t> entries;
+                for (auto& sequence : sequences)
+                {
+                    auto state = next;
+                    for (size_t i = 0; i < sequence.length; ++i)
+                    {
+                        auto j = m_reverse ? i : sequence.length - 1 - i;
+                        auto [first, last] = sequence.bytes[j];
+                        state = add({NfaState::Type::BYTES, first, last,
+                                     state});
+                    }
+                    entries.push_back(state);
+                }
+
+                auto result = entries.back();
+                for (size_t i = entries.size() - 1; i-- > 0;)
+                    result = add_split(entries[i], result);
+                return result;
+            }
+
+            uint32_t compile_repeat(const RegexNode& node, uint32_t next)
+            {
+                auto& body = node.children.front();
+                auto result = next;
+                if (node.max == UNBOUNDED)
+                {
+                    result = add_split(0, 0);
+                    auto entry = compile(body, result);
+                    auto& loop = m_nfa.states[result];
+                    loop.next = node.greedy ? entry : next;
+                    loop.alt = node.greedy ? next : entry;
+                }
+                else
+                {
+                    for (unsigned i = node.min; i < node.max; ++i)
+                    {
+                        auto entry = compile(body, result);
+                        result = node.greedy ? add_split(entry, next)
+                                             : add_split(next, entry);
+                    }
+                }
+
+                for (unsigned i = 0; i < node.min; ++i)
+                    result = compile(body, result);
+                return result;
+            }
+
+            Nfa m_nfa;
+            bool m_reverse;
+        };
+
+        /**
+         * @brief A DFA whose states are created from the NFA when they
+         *  are first needed.
+         *
+         * Each DFA state is the list of NFA states that consume bytes or
+         * wait for the end of the string, in order of priority. When
+         * @a leftmost_first is true, the NFA states after the first one
+         * that matches are dropped, as they can only lead to less
+         * preferred matches, and no new matches are started once one has
+         * been found. Otherwise the DFA keeps going until its longest
+         * match. An unanchored DFA starts a new match at every position
+         * until one is found.
+         *
+         * The cache is cleared if it grows beyond MAX_DFA_STATES, which
+         * keeps the memory use bounded and the worst-case running time
+         * linear in both the string length and the NFA size.
+         */
+        class LazyDfa
+        {
+        public:
+            static constexpr uint32_t DEAD = 0;
+
+            struct State
+            {
+                std::vector<uint32_t> nfa_states;
+                bool unanchored = false;
+                bool matching = false;
+                bool matching_at_end = false;
+                std::array<uint32_t, 256> next;
+            };
+
+            LazyDfa(std::shared_ptr<const Nfa> nfa, bool unanchored,
+                    bool leftmost_first)
+                : m_nfa(std::move(nfa)),
+                  m_unanchored(unanchored),
+                  m_leftmost_first(leftmost_first),
+                  m_seen(m_nfa->states.size())
+            {
+                clear();
+            }
+
+            const State& operator[](uint32_t id) const
+            {
+                return m_states[id];
+            }
+
+            uint32_t get_start(bool at_begin)
+            {
+                auto& id = m_start_ids[at_begin];
+                if (id == UNKNOWN)
+                {
+                    std::vector<uint32_t> nfa_states;
+                    next_generation();
+                    add_closure(m_nfa->start, at_begin, false, nfa_states);
+                    id = add_state(std::move(nfa_states), m_unanchored,
+                                   at_begin);
+                }
+                return id;
+            }
+
+            uint32_t get_next(uint32_t id, uint8_t byte)
+            {
+                auto next = m_states[id].next[byte];
+                if (next != UNKNOWN)
+                    return next;
+
+                std::vector<uint32_t> nfa_states;
+                next_generation();
+                for (auto s : m_states[id].nfa_states)
+                {
+                    auto& state = m_nfa->states[s];
+                    if (state.type == NfaState::Type::BYTES
+                        && state.first <= byte && byte <= state.last)
+                    {
+                        add_closure(state.next, false, false, nfa_states);
+                    }
+                }
+                auto unanchored = m_states[id].unanchored;
+                if (unanchored)
+                    add_closure(m_nfa->start, false, false, nfa_states);
+
+                if (m_states.size() >= MAX_DFA_STATES)
+                {
+                    clear();
+                    return add_state(std::move(nfa_states), unanchored, false);
+                }
+
+                next = add_state(std::move(nfa_states), unanchored, false);
+                m_states[id].next[byte] = next;
+                return next;
+            }
+        private:
+            static constexpr uint32_t UNKNOWN = UINT32_MAX;
+
+            void clear()
+            {
+                m_states.clear();
+                m_ids.clear();
+                m_start_ids = {UNKNOWN, UNKNOWN};
+                m_states.emplace_back().next.fill(DEAD);
+            }
+
+            void next_generation()
+            {
+                if (++m_generation == 0)
+                {
+                    std::fill(m_seen.begin(), m_seen.end(), 0);
+                    m_generation = 1;
+                }
+            }
+
+            /**
+             * @brief Adds the NFA states that can be reached from
+             *  @a start without consuming any bytes to @a result.
+             *
+             * States are added in order of priority, and states that
+             * have already been seen in the current generation are
+             * skipped.
+             */
+            void add_closure(uint32_t start, bool at_begin, bool at_end,
+                             std::vector<uint32_t>& result)
+            {
+                m_stack.push_back(start);
+                while (!m_stack.empty())
+                {
+                    auto s = m_stack.back();
+                    m_stack.pop_back();
+                    if (m_seen[s] == m_generation)
+                        continue;
+                    m_seen[s] = m_generation;
+
+                    auto& state = m_nfa->states[s];
+                    switch (state.type)
+                    {
+                    case NfaState::Type::SPLIT:
+                        m_stack.push_back(state.alt);
+                        m_stack.push_back(state.next);
+                        break;
+                    case NfaState::Type::BEGIN:
+                        if (at_begin)
+                            m_stack.push_back(state.next);
+                        break;
+                    case NfaState::Type::END:
+                        if (at_end)
+                            m_stack.push_back(state.next);
+                        else
+                            result.push_back(s);
+                        break;
+                    default:
+                        result.push_back(s);
+                        break;
+                    }
+                }
+            }
+
+            uint32_t add_state(std::vector<uint32_t> nfa_states,
+                               bool unanchored, bool at_begin)
+            {
+                bool matching = false;
+                auto match = std::find_if(
+                    nfa_states.begin(), nfa_states.end(),
+                    [&](auto s)
+                    {return m_nfa->states[s].type == NfaState::Type::MATCH;});
+                if (match != nfa_states.end())
+                {
+                    matching = true;
+                    if (m_leftmost_first)
+                    {
+                        nfa_states.erase(match, nfa_states.end());
+                        unanchored = false;
+                    }
+                    else
+                    {
+                        nfa_states.erase(match);
+                    }
+                }
+
+                if (nfa_states.empty() && !unanchored)
+                    return matching ? add_matching_dead_state() : DEAD;
+
+                auto key = nfa_states;
+                key.push_back(UNKNOWN - (unanchored ? 1 : 0)
+                              - (at_begin ? 2 : 0) - (matching ? 4 : 0));
+                auto [it, inserted] = m_ids.emplace(
+                    std::move(key), uint32_t(m_states.size()));
+                if (!inserted)
+                    return it->second;
+
+                State state;
+                state.unanchored = unanchored;
+                state.matching = matching;
+                state.next.fill(UNKNOWN);
+                std::vector<uint32_t> end_states;
+                next_generation();
+                for (auto s : nfa_states)
+                {
+                    if (m_nfa->states[s].type == NfaState::Type::END)
+                        add_closure(m_nfa->states[s].next, at_begin, true,
+                                    end_states);
+                }
+                state.matching_at_end = std::any_of(
+                    end_states.begin(), end_states.end(),
+                    [&](auto s)
+                    {return m_nfa->states[s].type == NfaState::Type::MATCH;});
+                state.nfa_states = std::move(nfa_states);
+                m_states.push_back(std::move(state));
+                return it->second;
+            }
+
+            /**
+             * @brief Returns a state that matches, but where every
+             *  transition leads to DEAD.
+             */
+            uint32_t add_matching_dead_state()
+            {
+                auto [it, inserted] = m_ids.emplace(
+                    std::vector<uint32_t>{UNKNOWN - 8},
+                    uint32_t(m_states.size()));
+                if (inserted)
+                {
+                    auto& state = m_states.emplace_back();
+                    state.matching = true;
+                    state.next.fill(DEAD);
+                }
+                return it->second;
+            }
+
+            std::shared_ptr<const Nfa> m_nfa;
+            bool m_unanchored;
+            bool m_leftmost_first;
+            std::vector<State> m_states;
+            std::map<std::vector<uint32_t>, uint32_t> m_ids;
+            std::array<uint32_t, 2> m_start_ids = {UNKNOWN, UNKNOWN};
+            std::vector<uint32_t> m_seen;
+            uint32_t m_generation = 0;
+            std::vector<uint32_t> m_stack;
+        };
+
+        struct Program
+        {
+            std::shared_ptr<const Nfa> forward;
+            std::shared_ptr<const Nfa> reverse;
+            std::string prefix;
+        };
+    }
+
+    struct Regex::Data
+    {
+        std::shared_ptr<const Program> program;
+        /**
+         * @brief Finds the end of the leftmost-first match.
+         */
+        LazyDfa search_dfa;
+        /**
+         * @brief Scans backwards from the end of a match to find its
+         *  start.
+         */
+        LazyDfa reverse_dfa;
+        /**
+         * @brief Matches entire strings.
+         */
+        LazyDfa match_dfa;
+
+        explicit Data(std::shared_ptr<const Program> program)
+            : program(std::move(program)),
+              search_dfa(this->program->forward, true, true),
+              reverse_dfa(this->program->reverse, false, false),
+              match_dfa(this->program->forward, false, false)
+        {}
+
+        bool match(std::string_view str)
+        {
+            auto state = match_dfa.get_start(true);
+            for (auto c : str)
+            {
+                state = match_dfa.get_next(state, uint8_t(c));
+                if (state == LazyDfa::DEAD)
+                    return false;
+            }
+            return match_dfa[state].matching
+                   || match_dfa[state].matching_at_end;
+        }
+
+        /**
+         * @brief Returns the end of the leftmost-first match that starts
+         *  at or after @a pos, or npos.
+         */
+        size_t find_end(std::string_view str, size_t pos)
+        {
+            constexpr auto npos = std::string_view::npos;
+            auto& prefix = program->prefix;
+            if (!prefix.empty())
+            {
+                pos = str.find(prefix, pos);
+                if (pos == npos)
+                    return npos;
+            }
+
+            auto& dfa = search_dfa;
+            auto state = dfa.get_start(pos == 0);
+            auto end = dfa[state].matching ? pos : npos;
+            for (; pos < str.size(); ++pos)
+            {
+                // When there are no partial matches in progress, skip
+                // ahead to the next occurrence of the prefix.
+                if (!prefix.empty() && state == dfa.get_start(false))
+                {
+                    pos = str.find(prefix, pos);
+                    if (pos == npos)
+                        return npos;
+                }
+
+                state = dfa.get_next(state, uint8_t(str[pos]));
+                if (state == LazyDfa::DEAD)
+                    return end;
+                if (dfa[state].matching)
+                    end = pos + 1;
+            }
+            if (dfa[state].matching_at_end)
+                end = str.size();
+            return end;
+        }
+
+        /**
+         * @brief Returns the start of the leftmost match that ends
+         *  at @a end and starts at or after @a offset.
+         */
+        size_t find_start(std::string_view str, size_t offset, size_t end)
+        {
+            auto& dfa = reverse_dfa;
+            auto state = dfa.get_start(end == str.size());
+            auto start = dfa[state].matching ? end : std::string_view::npos;
+            auto pos = end;
+            for (; pos > offset; --pos)
+            {
+                state = dfa.get_next(state, uint8_t(str[pos - 1]));
+                if (state == LazyDfa::DEAD)
+                    return start;
+                if (dfa[state].matching)
+                    start = pos - 1;
+            }
+            if (pos == 0 && dfa[state].matching_at_end)
+                start = 0;
+            return start;
+        }
+
+        Subrange find_first(std::string_view str, size_t offset)
+        {
+            if (offset > str.size())
+                return {};
+            auto end = find_end(str, offset);
+            if (end == std::string_view::npos)
+                return {};
+            auto start = find_start(str, offset, end);
+            if (start == std::string_view::npos)
+                return {};
+            return {start, end - start};
+        }
+    };
+
+    Regex::Regex(std::string_view pattern, RegexParams params)
+    {
+        auto root = RegexParser(pattern, params).parse();
+        auto program = std::make_shared<Program>();
+        program->forward = std::make_shared<Nfa>(
+            NfaCompiler(false).compile(root));
+        program->reverse = std::make_shared<Nfa>(
+            NfaCompiler(true).compile(root));
+        program->prefix = get_literal_prefix(root);
+        m_data = std::make_unique<Data>(std::move(program));
+    }
+
+    Regex::Regex(const Regex& other)
+        : m_data(std::make_unique<Data>(other.m_data->program))
+    {}
+
+    Regex::Regex(Regex&& other) noexcept = default;
+
+    Regex::~Regex() = default;
+
+    Regex& Regex::operator=(const Regex& other)
+    {
+        if (this != &other)
+            m_data = std::make_unique<Data>(other.m_data->program);
+        return *this;
+    }
+
+    Regex& Regex::operator=(Regex&& other) noexcept = default;
+
+    bool Regex::match(std::string_view str)
+    {
+        return m_data->match(str);
+    }
+
+    Subrange Regex::find_first(std::string_view str, size_t offset)
+    {
+        return m_data->find_first(str, offset);
+    }
+
+    std::vector<Subrange> Regex::find_all(std::string_view str)
+    {
+        std::vector<Subrange> result;
+        size_t pos = 0;
+        while (pos <= str.size())
+        {
+            auto match = m_data->find_first(str, pos);
+            if (match.offset == std::string_view::npos)
+                break;
+            result.push_back(match);
+            pos = match.end();
+            if (match.length == 0)
+            {
+                // Step past the code point after an empty match.
+                do
+                    ++pos;
+                while (pos < str.size() && (uint8_t(str[pos]) & 0xC0u) == 0x80);
+            }
+        }
+        return result;
+    }
+}
@@ -0,0 +1,537 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Sort.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <vector>
+#include "ByteSearch.hpp"
+#include "CaseInsensitiveSearch.hpp"
+#include "EncodeUtf8.hpp"
+
+namespace ystring
+{
+    namespace
+    {
+        /**
+         * @brief The position and size of a sort key in the key buffer,
+         *  with the key's first eight bytes stored as a big-endian number.
+         *
+         * Most comparisons are decided by the first eight bytes, and
+         * having them in the array that is sorted avoids a cache miss in
+         * the key buffer.
+         */
+        struct KeyRef
+        {
+            uint64_t prefix;
+            size_t offset;
+            size_t size;
+            size_t index;
+        };
+
+        uint64_t get_key_prefix(std::string_view key)
+        {
+            uint64_t prefix = 0;
+            if (key.size() >= sizeof(prefix))
+            {
+                // A fixed number of iterations lets the compiler turn
+                // the loop into a single load and byte swap.
+                for (size_t i = 0; i < sizeof(prefix); ++i)
+                    prefix |= uint64_t(uint8_t(key[i])) << (56u - 8u * i);
+                return prefix;
+            }
+
+            for (size_t i = 0; i < key.size(); ++i)
+                prefix |= uint64_t(uint8_t(key[i])) << (56u - 8u * i);
+            return prefix;
+        }
+
+        /**
+         * @brief A string in the radix sort and the next (up to) eight
+         *  bytes it is sorted by.
+         */
+        struct RadixItem
+        {
+            /**
+             * @brief The next bytes as a big-endian number, padded with
+             *  zeros.
+             */
+            uint64_t word = 0;
+            std::string_view str;
+            /**
+             * @brief The position in @a str after the bytes that have
+             *  been read.
+             */
+            size_t pos = 0;
+            /**
+             * @brief The number of bytes in @a word. Less than eight
+             *  means that the string ends after them.
+             */
+            uint8_t word_size = 0;
+            /**
+             * @brief The number of bytes of a converted code point that
+             *  didn't fit in @a word and are at the end of @a pending.
+             */
+            uint8_t pending_size = 0;
+            char pending[4] = {};
+        };
+
+        constexpr size_t WORD_SIZE = sizeof(uint64_t);
+
+        bool has_less_word(const RadixItem& a, const RadixItem& b)
+        {
+            if (a.word != b.word)
+                return a.word < b.word;
+            return a.word_size < b.word_size;
+        }
+
+        bool has_equal_word(const RadixItem& a, const RadixItem& b)
+        {
+            return a.word == b.word && a.word_size == b.word_size;
+        }
+
+        struct PlainReader
+        {
+            static constexpr bool HAS_TIE_BREAKER = false;
+
+            static void read_word(RadixItem& item)
+            {
+                auto n = std::min(item.str.size() - item.pos, WORD_SIZE);
+                item.word = get_key_prefix(item.str.substr(item.pos, n));
+                item.word_size = uint8_t(n);
+                item.pos += n;
+            }
+
+            static bool is_tie_less(const RadixItem&, const RadixItem&)
+            {
+                return false;
+            }
+        };
+
+        struct UpperCaseReader
+        {
+            static constexpr bool HAS_TIE_BREAKER = true;
+
+            static void read_word(RadixItem& item)
+            {
+                item.word = 0;
+                item.word_size = 0;
+                if (item.pending_size == 0
+                    && item.str.size() - item.pos >= WORD_SIZE)
+                {
+                    auto word = load_word(item.str.data() + item.pos);
+                    if ((word & HIGH_BITS) == 0)
+                    {
+                        word = to_upper_ascii_word(word);
+                        char bytes[WORD_SIZE];
+                        std::memcpy(bytes, &word, WORD_SIZE);
+                        item.word = get_key_prefix({bytes, WORD_SIZE});
+                        item.word_size = uint8_t(WORD_SIZE);
+                        item.pos += WORD_SIZE;
+                        return;
+                    }
+                }
+
+                while (item.word_size < WORD_SIZE)
+                {
+                    if (item.pending_size != 0)
+                    {
+                        auto i = sizeof(item.pending) - item.pending_size--;
+                        add_byte(item, item.pending[i]);
+                        continue;
+                    }
+
+                    if (item.pos == item.str.size())
+                        break;
+
+                    auto c = uint8_t(item.str[item.pos]);
+                    if (c < 0x80)
+                    {
+                        ++item.pos;
+                        add_byte(item, char(fold_for_search(c)));
+                        continue;
+                    }
+
+                    char32_t ch;
+                    auto it = item.str.begin() + ptrdiff_t(item.pos);
+                    safe_decode_next(it, item.str.end(), ch);
+                    item.pos = size_t(it - item.str.begin());
+                    char buffer[4] = {};
+                    auto size = encode_utf8(fold_for_search(ch), buffer,
+                                            sizeof(buffer));
+                    add_byte(item, buffer[0]);
+                    // Keep the remaining bytes at the end of pending.
+                    item.pending_size = uint8_t(size - 1);
+                    std::memcpy(item.pending + sizeof(item.pending) - (size - 1),
+                                buffer + 1, size - 1);
+                }
+            }
+
+            static bool is_tie_less(const RadixItem& a, const RadixItem& b)
+            {
+                return a.str < b.str;
+            }
+        private:
+            static void add_byte(RadixItem& item, char c)
+            {
+                auto shift = 8u * (WORD_SIZE - 1 - item.word_size++);
+                item.word |= uint64_t(uint8_t(c)) << shift;
+            }
+        };
+
+        /**
+         * @brief Compares @a a and @a b from their current words.
+         */
+        template <typename Reader>
+        bool is_item_less(RadixItem a, RadixItem b)
+        {
+            while (has_equal_word(a, b))
+            {
+                if (a.word_size != WORD_SIZE)
+                    return Reader::is_tie_less(a, b);
+                Reader::read_word(a);
+                Reader::read_word(b);
+            }
+            return has_less_word(a, b);
+        }
+
+        struct RadixRange
+        {
+            size_t first;
+            size_t last;
+        };
+
+        /**
+         * @brief Ranges with fewer items than this are sorted with
+         *  insertion sort.
+         */
+        constexpr size_t MIN_PARTITION_SIZE = 16;
+
+        /**
+         * @brief Sorts the items in @a range, which have ended and are
+         *  equal, with the reader's tie-breaker.
+         */
+        template <typename Reader>
+        void sort_ended(std::span<RadixItem> items, RadixRange range)
+        {
+            if constexpr (Reader::HAS_TIE_BREAKER)
+            {
+                std::sort(items.begin() + ptrdiff_t(range.first),
+                          items.begin() + ptrdiff_t(range.last),
+                          Reader::is_tie_less);
+            }
+        }
+
+        template <typename Reader>
+        void insertion_sort(std::span<RadixItem> items, RadixRange range)
+        {
+            for (auto i = range.first + 1; i < range.last; ++i)
+            {
+                auto item = items[i];
+                auto j = i;
+                for (; j > range.first && is_item_less<Reader>(item, items[j - 1]);
+                     --j)
+                {
+                    items[j] = items[j - 1];
+                }
+                items[j] = item;
+            }
+        }
+
+        /**
+         * @brief Returns the median of the words of the first, middle
+         *  and last items in @a range.
+         */
+        const RadixItem& get_pivot(std::span<RadixItem> items,
+                                   RadixRange range)
+        {
+            auto& a = items[range.first];
+            auto& b = items[range.first + (range.last - range.first) / 2];
+            auto& c = items[range.last - 1];
+            if (has_less_word(a, b))
+            {
+                if (has_less_word(b, c))
+                    return b;
+                return has_less_word(a, c) ? c : a;
+            }
+            if (has_less_word(a, c))
+                return a;
+            return has_less_word(b, c) ? c : b;
+        }
+
+        /**
+         * @brief Sorts the items in @a range, which all have the same
+         *  bytes before their current words, with a multikey quicksort.
+         *
+         * The items are partitioned into those whose words are less than,
+         * equal to and greater than the pivot's word. The first and last
+         * partitions are sorted the same way, while the items in the
+         * middle partition read their next words and are then sorted
+         * by those.
+         */
+        template <typename Reader>
+        void multikey_quicksort(std::span<RadixItem> items, RadixRange range)
+        {
+            std::vector<RadixRange> stack{range};
+            while (!stack.empty())
+            {
+                auto r = stack.back();
+                stack.pop_back();
+                if (r.last - r.first < MIN_PARTITION_SIZE)
+                {
+                    insertion_sort<Reader>(items, r);
+                    continue;
+                }
+
+                auto pivot = get_pivot(items, r);
+                // Items in [r.first, lt) are less than the pivot, those
+                // in [lt, i) are equal and those in [gt, r.last) are
+                // greater.
+                auto lt = r.first;
+                auto i = r.first;
+                auto gt = r.last;
+                while (i < gt)
+                {
+                    if (has_less_word(items[i], pivot))
+                        std::swap(items[lt++], items[i++]);
+                    else if (has_less_word(pivot, items[i]))
+                        std::swap(items[i], items[--gt]);
+                    else
+                        ++i;
+                }
+
+                if (lt - r.first > 1)
+                    stack.push_back({r.first, lt});
+                if (r.last - gt > 1)
+                    stack.push_back({gt, r.last});
+                if (pivot.word_size != WORD_SIZE)
+                {
+                    sort_ended<Reader>(items, {lt, gt});
+                }
+                else if (gt - lt > 1)
+                {
+                    for (auto j = lt; j < gt; ++j)
+                        Reader::read_word(items[j]);
+                    stack.push_back({lt, gt});
+                }
+            }
+        }
+
+        /**
+         * @brief Sorts the items in @a ranges, using up to
+         *  @a max_threads threads.
+         */
+        template <typename Reader>
+        void sort_ranges(std::span<RadixItem> items,
+                         std::vector<RadixRange> ranges,
+                         size_t max_threads)
+        {
+            // Start with the largest ranges to even out the work.
+            std::sort(ranges.begin(), ranges.end(),
+                      [](const RadixRange& a, const RadixRange& b)
+                      {
+                          return a.last - a.first > b.last - b.first;
+                      });
+
+            std::atomic<size_t> next_range = 0;
+            auto run = [&]
+            {
+                try
+                {
+                    size_t i;
+                    while ((i = next_range++) < ranges.size())
+                        multikey_quicksort<Reader>(items, ranges[i]);
+                    return std::exception_ptr();
+                }
+                catch (...)
+                {
+                    next_range = ranges.size();
+                    return std::current_exception();
+                }
+            };
+
+            // There may be no ranges to sort, but errors must still have
+            // room for the calling thread.
+            auto n = std::max<size_t>(std::min(max_threads, ranges.size()), 1);
+            std::vector<std::exception_ptr> errors(n);
+            std::vector<std::thread> threads;
+            threads.reserve(n);
+            try
+            {
+                for (size_t i = 1; i < n; ++i)
+                    threads.emplace_back([&, i] {errors[i] = run();});
+            }
+            catch (const std::system_error&)
+            {}
+
+            errors[0] = run();
+            for (auto& thread : threads)
+                thread.join();
+            for (auto& error : errors)
+            {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
+
+        /**
+         * @brief Distributes @a items into buckets by the first byte of
+         *  their words, and returns the ranges of the buckets.
+         *
+         * Items with empty words (i.e. empty strings) are put first, and
+         * are already sorted.
+         */
+        std::vector<RadixRange> distribute(std::vector<RadixItem>& items)
+        {
+            constexpr size_t BUCKETS = 257;
+            auto get_bucket = [](const RadixItem& item)
+            {
+                return item.word_size == 0 ? 0 : (item.word >> 56u) + 1;
+            };
+
+            std::array<size_t, BUCKETS> positions = {};
+            for (const auto& item : items)
+                ++positions[get_bucket(item)];
+
+            std::vector<RadixRange> ranges;
+            size_t pos = 0;
+            for (size_t b = 0; b < BUCKETS; ++b)
+            {
+                auto size = positions[b];
+                if (b != 0 && size > 1)
+                    ranges.push_back({pos, pos + size});
+                positions[b] = pos;
+                pos += size;
+            }
+
+            std::vector<RadixItem> result(items.size());
+            for (const auto& item : items)
+                result[positions[get_bucket(item)]++] = item;
+            items.swap(result);
+            return ranges;
+        }
+
+        template <typename Reader>
+        void radix_sort_impl(std::span<std::string_view> strs,
+                             const RadixSortParams& params)
+        {
+            std::vector<RadixItem> items(strs.size());
+            for (size_t i = 0; i < strs.size(); ++i)
+            {
+                items[i].str = strs[i];
+                Reader::read_word(items[i]);
+            }
+
+            size_t threads = params.max_threads;
+            if (threads == 0)
+                threads = std::max(std::thread::hardware_concurrency(), 1u);
+            if (threads == 1 || items.size() < params.min_parallel_size)
+            {
+                multikey_quicksort<Reader>(items, {0, items.size()});
+            }
+            else
+            {
+                auto ranges = distribute(items);
+                sort_ranges<Reader>(items, std::move(ranges), threads);
+            }
+
+            for (size_t i = 0; i < items.size(); ++i)
+                strs[i] = items[i].str;
+        }
+    }
+
+    std::string case_insensitive_sort_key(std::string_view str)
+    {
+        std::string result;
+        return case_insensitive_sort_key(str, result);
+    }
+
+    std::string& case_insensitive_sort_key(std::string_view str,
+                                           std::string& result)
+    {
+        auto pos = result.size();
+        // No code point's folded form is more than twice as long as the
+        // code point itself (zero bytes are the worst case).
+        result.resize(pos + 2 * str.size());
+        auto it = str.begin();
+        while (it != str.end())
+        {
+            if (str.end() - it >= 8)
+            {
+                auto word = load_word(&*it);
+                if ((word & HIGH_BITS) == 0 && get_zero_bytes(word) == 0)
+                {
+                    word = to_upper_ascii_word(word);
+                    std::memcpy(result.data() + pos, &word, sizeof(word));
+                    pos += sizeof(word);
+                    it += sizeof(word);
+                    continue;
+                }
+            }
+
+            char32_t ch;
+            safe_decode_next(it, str.end(), ch);
+            if (ch == 0)
+            {
+                result[pos++] = '\0';
+                result[pos++] = '\1';
+            }
+            else
+            {
+                pos += encode_utf8(fold_for_search(ch), result.data() + pos,
+                                   result.size() - pos);
+            }
+        }
+        result.resize(pos);
+        result.append(2, '\0');
+        result.append(str);
+        return result;
+    }
+
+    void sort_case_insensitive(std::span<std::string_view> strs)
+    {
+        std::string keys;
+        std::vector<KeyRef> refs;
+        refs.reserve(strs.size());
+        for (size_t i = 0; i < strs.size(); ++i)
+        {
+            auto offset = keys.size();
+            case_insensitive_sort_key(strs[i], keys);
+            auto key = std::string_view(keys).substr(offset);
+            refs.push_back({get_key_prefix(key), offset, key.size(), i});
+        }
+
+        std::sort(refs.begin(), refs.end(),
+                  [&](const KeyRef& a, const KeyRef& b)
+                  {
+                      if (a.prefix != b.prefix)
+                          return a.prefix < b.prefix;
+                      return std::string_view(keys).substr(a.offset, a.size)
+                             < std::string_view(keys).substr(b.offset, b.size);
+                  });
+
+        std::vector<std::string_view> sorted;
+        sorted.reserve(strs.size());
+        for (const auto& ref : refs)
+            sorted.push_back(strs[ref.index]);
+        std::copy(sorted.begin(), sorted.end(), strs.begin());
+    }
+
+    void radix_sort(std::span<std::string_view> strs, RadixSortParams params)
+    {
+        if (params.case_insensitive)
+            radix_sort_impl<UpperCaseReader>(strs, params);
+        else
+            radix_sort_impl<PlainReader>(strs, params);
+    }
+}
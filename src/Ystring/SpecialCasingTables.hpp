@@ -0,0 +1,134 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include "CharMappingTypes.hpp"
+
+namespace ystring
+{
+    /**
+     * @brief The unconditional mappings in SpecialCasing.txt where at
+     *  least one of the lower, title and upper case forms is several
+     *  code points, sorted.
+     *
+     * The UTF-8 tables for lower and upper case have UTF8_CASE_SPECIAL
+     * plus the index in this array for the code points whose lower or
+     * upper case form is several code points. Every code point with a
+     * title case form of several code points also has such an upper
+     * case form.
+     */
+    constexpr SpecialCaseMapping SPECIAL_CASING[] =
+    {
+        {0x0000DF, "\xC3\x9F", "\x53\x73", "\x53\x53"},
+        {0x000130, "\x69\xCC\x87", "\xC4\xB0", "\xC4\xB0"},
+        {0x000149, "\xC5\x89", "\xCA\xBC\x4E", "\xCA\xBC\x4E"},
+        {0x0001F0, "\xC7\xB0", "\x4A\xCC\x8C", "\x4A\xCC\x8C"},
+        {0x000390, "\xCE\x90", "\xCE\x99\xCC\x88\xCC\x81", "\xCE\x99\xCC\x88\xCC\x81"},
+        {0x0003B0, "\xCE\xB0", "\xCE\xA5\xCC\x88\xCC\x81", "\xCE\xA5\xCC\x88\xCC\x81"},
+        {0x000587, "\xD6\x87", "\xD4\xB5\xD6\x82", "\xD4\xB5\xD5\x92"},
+        {0x001E96, "\xE1\xBA\x96", "\x48\xCC\xB1", "\x48\xCC\xB1"},
+        {0x001E97, "\xE1\xBA\x97", "\x54\xCC\x88", "\x54\xCC\x88"},
+        {0x001E98, "\xE1\xBA\x98", "\x57\xCC\x8A", "\x57\xCC\x8A"},
+        {0x001E99, "\xE1\xBA\x99", "\x59\xCC\x8A", "\x59\xCC\x8A"},
+        {0x001E9A, "\xE1\xBA\x9A", "\x41\xCA\xBE", "\x41\xCA\xBE"},
+        {0x001F50, "\xE1\xBD\x90", "\xCE\xA5\xCC\x93", "\xCE\xA5\xCC\x93"},
+        {0x001F52, "\xE1\xBD\x92", "\xCE\xA5\xCC\x93\xCC\x80", "\xCE\xA5\xCC\x93\xCC\x80"},
+        {0x001F54, "\xE1\xBD\x94", "\xCE\xA5\xCC\x93\xCC\x81", "\xCE\xA5\xCC\x93\xCC\x81"},
+        {0x001F56, "\xE1\xBD\x96", "\xCE\xA5\xCC\x93\xCD\x82", "\xCE\xA5\xCC\x93\xCD\x82"},
+        {0x001F80, "\xE1\xBE\x80", "\xE1\xBE\x88", "\xE1\xBC\x88\xCE\x99"},
+        {0x001F81, "\xE1\xBE\x81", "\xE1\xBE\x89", "\xE1\xBC\x89\xCE\x99"},
+        {0x001F82, "\xE1\xBE\x82", "\xE1\xBE\x8A", "\xE1\xBC\x8A\xCE\x99"},
+        {0x001F83, "\xE1\xBE\x83", "\xE1\xBE\x8B", "\xE1\xBC\x8B\xCE\x99"},
+        {0x001F84, "\xE1\xBE\x84", "\xE1\xBE\x8C", "\xE1\xBC\x8C\xCE\x99"},
+        {0x001F85, "\xE1\xBE\x85", "\xE1\xBE\x8D", "\xE1\xBC\x8D\xCE\x99"},
+        {0x001F86, "\xE1\xBE\x86", "\xE1\xBE\x8E", "\xE1\xBC\x8E\xCE\x99"},
+        {0x001F87, "\xE1\xBE\x87", "\xE1\xBE\x8F", "\xE1\xBC\x8F\xCE\x99"},
+        {0x001F88, "\xE1\xBE\x80", "\xE1\xBE\x88", "\xE1\xBC\x88\xCE\x99"},
+        {0x001F89, "\xE1\xBE\x81", "\xE1\xBE\x89", "\xE1\xBC\x89\xCE\x99"},
+        {0x001F8A, "\xE1\xBE\x82", "\xE1\xBE\x8A", "\xE1\xBC\x8A\xCE\x99"},
+        {0x001F8B, "\xE1\xBE\x83", "\xE1\xBE\x8B", "\xE1\xBC\x8B\xCE\x99"},
+        {0x001F8C, "\xE1\xBE\x84", "\xE1\xBE\x8C", "\xE1\xBC\x8C\xCE\x99"},
+        {0x001F8D, "\xE1\xBE\x85", "\xE1\xBE\x8D", "\xE1\xBC\x8D\xCE\x99"},
+        {0x001F8E, "\xE1\xBE\x86", "\xE1\xBE\x8E", "\xE1\xBC\x8E\xCE\x99"},
+        {0x001F8F, "\xE1\xBE\x87", "\xE1\xBE\x8F", "\xE1\xBC\x8F\xCE\x99"},
+        {0x001F90, "\xE1\xBE\x90", "\xE1\xBE\x98", "\xE1\xBC\xA8\xCE\x99"},
+        {0x001F91, "\xE1\xBE\x91", "\xE1\xBE\x99", "\xE1\xBC\xA9\xCE\x99"},
+        {0x001F92, "\xE1\xBE\x92", "\xE1\xBE\x9A", "\xE1\xBC\xAA\xCE\x99"},
+        {0x001F93, "\xE1\xBE\x93", "\xE1\xBE\x9B", "\xE1\xBC\xAB\xCE\x99"},
+        {0x001F94, "\xE1\xBE\x94", "\xE1\xBE\x9C", "\xE1\xBC\xAC\xCE\x99"},
+        {0x001F95, "\xE1\xBE\x95", "\xE1\xBE\x9D", "\xE1\xBC\xAD\xCE\x99"},
+        {0x001F96, "\xE1\xBE\x96", "\xE1\xBE\x9E", "\xE1\xBC\xAE\xCE\x99"},
+        {0x001F97, "\xE1\xBE\x97", "\xE1\xBE\x9F", "\xE1\xBC\xAF\xCE\x99"},
+        {0x001F98, "\xE1\xBE\x90", "\xE1\xBE\x98", "\xE1\xBC\xA8\xCE\x99"},
+        {0x001F99, "\xE1\xBE\x91", "\xE1\xBE\x99", "\xE1\xBC\xA9\xCE\x99"},
+        {0x001F9A, "\xE1\xBE\x92", "\xE1\xBE\x9A", "\xE1\xBC\xAA\xCE\x99"},
+        {0x001F9B, "\xE1\xBE\x93", "\xE1\xBE\x9B", "\xE1\xBC\xAB\xCE\x99"},
+        {0x001F9C, "\xE1\xBE\x94", "\xE1\xBE\x9C", "\xE1\xBC\xAC\xCE\x99"},
+        {0x001F9D, "\xE1\xBE\x95", "\xE1\xBE\x9D", "\xE1\xBC\xAD\xCE\x99"},
+        {0x001F9E, "\xE1\xBE\x96", "\xE1\xBE\x9E", "\xE1\xBC\xAE\xCE\x99"},
+        {0x001F9F, "\xE1\xBE\x97", "\xE1\xBE\x9F", "\xE1\xBC\xAF\xCE\x99"},
+        {0x001FA0, "\xE1\xBE\xA0", "\xE1\xBE\xA8", "\xE1\xBD\xA8\xCE\x99"},
+        {0x001FA1, "\xE1\xBE\xA1", "\xE1\xBE\xA9", "\xE1\xBD\xA9\xCE\x99"},
+        {0x001FA2, "\xE1\xBE\xA2", "\xE1\xBE\xAA", "\xE1\xBD\xAA\xCE\x99"},
+        {0x001FA3, "\xE1\xBE\xA3", "\xE1\xBE\xAB", "\xE1\xBD\xAB\xCE\x99"},
+        {0x001FA4, "\xE1\xBE\xA4", "\xE1\xBE\xAC", "\xE1\xBD\xAC\xCE\x99"},
+        {0x001FA5, "\xE1\xBE\xA5", "\xE1\xBE\xAD", "\xE1\xBD\xAD\xCE\x99"},
+        {0x001FA6, "\xE1\xBE\xA6", "\xE1\xBE\xAE", "\xE1\xBD\xAE\xCE\x99"},
+        {0x001FA7, "\xE1\xBE\xA7", "\xE1\xBE\xAF", "\xE1\xBD\xAF\xCE\x99"},
+        {0x001FA8, "\xE1\xBE\xA0", "\xE1\xBE\xA8", "\xE1\xBD\xA8\xCE\x99"},
+        {0x001FA9, "\xE1\xBE\xA1", "\xE1\xBE\xA9", "\xE1\xBD\xA9\xCE\x99"},
+        {0x001FAA, "\xE1\xBE\xA2", "\xE1\xBE\xAA", "\xE1\xBD\xAA\xCE\x99"},
+        {0x001FAB, "\xE1\xBE\xA3", "\xE1\xBE\xAB", "\xE1\xBD\xAB\xCE\x99"},
+        {0x001FAC, "\xE1\xBE\xA4", "\xE1\xBE\xAC", "\xE1\xBD\xAC\xCE\x99"},
+        {0x001FAD, "\xE1\xBE\xA5", "\xE1\xBE\xAD", "\xE1\xBD\xAD\xCE\x99"},
+        {0x001FAE, "\xE1\xBE\xA6", "\xE1\xBE\xAE", "\xE1\xBD\xAE\xCE\x99"},
+        {0x001FAF, "\xE1\xBE\xA7", "\xE1\xBE\xAF", "\xE1\xBD\xAF\xCE\x99"},
+        {0x001FB2, "\xE1\xBE\xB2", "\xE1\xBE\xBA\xCD\x85", "\xE1\xBE\xBA\xCE\x99"},
+        {0x001FB3, "\xE1\xBE\xB3", "\xE1\xBE\xBC", "\xCE\x91\xCE\x99"},
+        {0x001FB4, "\xE1\xBE\xB4", "\xCE\x86\xCD\x85", "\xCE\x86\xCE\x99"},
+        {0x001FB6, "\xE1\xBE\xB6", "\xCE\x91\xCD\x82", "\xCE\x91\xCD\x82"},
+        {0x001FB7, "\xE1\xBE\xB7", "\xCE\x91\xCD\x82\xCD\x85", "\xCE\x91\xCD\x82\xCE\x99"},
+        {0x001FBC, "\xE1\xBE\xB3", "\xE1\xBE\xBC", "\xCE\x91\xCE\x99"},
+        {0x001FC2, "\xE1\xBF\x82", "\xE1\xBF\x8A\xCD\x85", "\xE1\xBF\x8A\xCE\x99"},
+        {0x001FC3, "\xE1\xBF\x83", "\xE1\xBF\x8C", "\xCE\x97\xCE\x99"},
+        {0x001FC4, "\xE1\xBF\x84", "\xCE\x89\xCD\x85", "\xCE\x89\xCE\x99"},
+        {0x001FC6, "\xE1\xBF\x86", "\xCE\x97\xCD\x82", "\xCE\x97\xCD\x82"},
+        {0x001FC7, "\xE1\xBF\x87", "\xCE\x97\xCD\x82\xCD\x85", "\xCE\x97\xCD\x82\xCE\x99"},
+        {0x001FCC, "\xE1\xBF\x83", "\xE1\xBF\x8C", "\xCE\x97\xCE\x99"},
+        {0x001FD2, "\xE1\xBF\x92", "\xCE\x99\xCC\x88\xCC\x80", "\xCE\x99\xCC\x88\xCC\x80"},
+        {0x001FD3, "\xE1\xBF\x93", "\xCE\x99\xCC\x88\xCC\x81", "\xCE\x99\xCC\x88\xCC\x81"},
+        {0x001FD6, "\xE1\xBF\x96", "\xCE\x99\xCD\x82", "\xCE\x99\xCD\x82"},
+        {0x001FD7, "\xE1\xBF\x97", "\xCE\x99\xCC\x88\xCD\x82", "\xCE\x99\xCC\x88\xCD\x82"},
+        {0x001FE2, "\xE1\xBF\xA2", "\xCE\xA5\xCC\x88\xCC\x80", "\xCE\xA5\xCC\x88\xCC\x80"},
+        {0x001FE3, "\xE1\xBF\xA3", "\xCE\xA5\xCC\x88\xCC\x81", "\xCE\xA5\xCC\x88\xCC\x81"},
+        {0x001FE4, "\xE1\xBF\xA4", "\xCE\xA1\xCC\x93", "\xCE\xA1\xCC\x93"},
+        {0x001FE6, "\xE1\xBF\xA6", "\xCE\xA5\xCD\x82", "\xCE\xA5\xCD\x82"},
+        {0x001FE7, "\xE1\xBF\xA7", "\xCE\xA5\xCC\x88\xCD\x82", "\xCE\xA5\xCC\x88\xCD\x82"},
+        {0x001FF2, "\xE1\xBF\xB2", "\xE1\xBF\xBA\xCD\x85", "\xE1\xBF\xBA\xCE\x99"},
+        {0x001FF3, "\xE1\xBF\xB3", "\xE1\xBF\xBC", "\xCE\xA9\xCE\x99"},
+        {0x001FF4, "\xE1\xBF\xB4", "\xCE\x8F\xCD\x85", "\xCE\x8F\xCE\x99"},
+        {0x001FF6, "\xE1\xBF\xB6", "\xCE\xA9\xCD\x82", "\xCE\xA9\xCD\x82"},
+        {0x001FF7, "\xE1\xBF\xB7", "\xCE\xA9\xCD\x82\xCD\x85", "\xCE\xA9\xCD\x82\xCE\x99"},
+        {0x001FFC, "\xE1\xBF\xB3", "\xE1\xBF\xBC", "\xCE\xA9\xCE\x99"},
+        {0x00FB00, "\xEF\xAC\x80", "\x46\x66", "\x46\x46"},
+        {0x00FB01, "\xEF\xAC\x81", "\x46\x69", "\x46\x49"},
+        {0x00FB02, "\xEF\xAC\x82", "\x46\x6C", "\x46\x4C"},
+        {0x00FB03, "\xEF\xAC\x83", "\x46\x66\x69", "\x46\x46\x49"},
+        {0x00FB04, "\xEF\xAC\x84", "\x46\x66\x6C", "\x46\x46\x4C"},
+        {0x00FB05, "\xEF\xAC\x85", "\x53\x74", "\x53\x54"},
+        {0x00FB06, "\xEF\xAC\x86", "\x53\x74", "\x53\x54"},
+        {0x00FB13, "\xEF\xAC\x93", "\xD5\x84\xD5\xB6", "\xD5\x84\xD5\x86"},
+        {0x00FB14, "\xEF\xAC\x94", "\xD5\x84\xD5\xA5", "\xD5\x84\xD4\xB5"},
+        {0x00FB15, "\xEF\xAC\x95", "\xD5\x84\xD5\xAB", "\xD5\x84\xD4\xBB"},
+        {0x00FB16, "\xEF\xAC\x96", "\xD5\x8E\xD5\xB6", "\xD5\x8E\xD5\x86"},
+        {0x00FB17, "\xEF\xAC\x97", "\xD5\x84\xD5\xAD", "\xD5\x84\xD4\xBD"},
+    };
+
+    constexpr size_t MAX_SPECIAL_CASING_SIZE = 6;
+}
+
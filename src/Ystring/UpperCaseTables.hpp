@@ -1,246 +1,814 @@
 //****************************************************************************
-// Copyright © 2025 Jan Erik Breimo. All rights reserved.
-// Created by Jan Erik Breimo on 2025-01-01.
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
 //
 // This file is distributed under the Zero-Clause BSD License.
 // License text is included with the source distribution.
 //****************************************************************************
 #pragma once
 
+#include <iterator>
 #include "CharMappingTypes.hpp"
 
 namespace ystring
 {
-    constexpr CompactCharMapping COMPACT_UPPER_CASE[] =
+    constexpr uint8_t UPPER_CASE_BLOCKS[] =
     {
-        {0x000060, 0xFFFFFFE0, 0x07FFFFFE, 0xF8000001},
-        {0x0000E0, 0xFFFFFFE0, 0x7F7FFFFF, 0x00800000},
-        {0x000100, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x000120, 0xFFFFFFFF, 0x54A8AAAA, 0xAB555555},
-        {0x000140, 0xFFFFFFFF, 0xAAAAA955, 0x555556AA},
-        {0x000160, 0xFFFFFFFF, 0x54AAAAAA, 0x2B555555},
-        {0x000180, 0xFFFFFFFF, 0x02041128, 0xB1DBEED6},
-        {0x0001A0, 0xFFFFFFFF, 0x2251212A, 0x5DAEDED5},
-        {0x0001C0, 0xFFFFFFFF, 0x95554920, 0x4AAAA49F},
-        {0x0001E0, 0xFFFFFFFF, 0xAA24AAAA, 0x55D35555},
-        {0x000200, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x000220, 0xFFFFFFFF, 0x100AAAA8, 0x6FF55557},
-        {0x000240, 0xFFFFFFFF, 0x0000AA84, 0xE520557A},
-        {0x000280, 0xFFFFFF26, 0x00000109, 0x9FFBE072},
-        {0x000360, 0xFFFFFFFF, 0x008A0000, 0xC775FFFF},
-        {0x0003A0, 0xFFFFFFE0, 0xFFFE0000, 0x00010FFF},
-        {0x0003C0, 0xFFFFFFE0, 0x00000FFB, 0x551C8000},
-        {0x0003E0, 0xFFFFFFFF, 0x0900AAAA, 0xF6D05555},
-        {0x000420, 0xFFFFFFE0, 0xFFFF0000, 0x0000FFFF},
-        {0x000440, 0xFFFFFFE0, 0x0000FFFF, 0x00000000},
-        {0x000460, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x000480, 0xFFFFFFFF, 0xAAAAA802, 0x555557FD},
-        {0x0004A0, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x0004C0, 0xFFFFFFFF, 0xAAAA5554, 0x55552AAB},
-        {0x0004E0, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x000500, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x000520, 0xFFFFFFFF, 0x0000AAAA, 0xFFFF5555},
-        {0x000560, 0xFFFFFFD0, 0xFFFFFFFE, 0x00000001},
-        {0x000580, 0xFFFFFFD0, 0x0000007F, 0xFFFFFF80},
-        {0x0010C0, 0x00000BC0, 0xFFFF0000, 0x0000FFFF},
-        {0x0010E0, 0x00000BC0, 0xE7FFFFFF, 0x18000000},
-        {0x0013E0, 0xFFFFFFF8, 0x3F000000, 0xC0FFFFFF},
-        {0x001E00, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x001E20, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x001E40, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x001E60, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x001E80, 0xFFFFFFFF, 0x002AAAAA, 0xF7D55555},
-        {0x001EA0, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x001EC0, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x001EE0, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x001F00, 0x00000008, 0x003F00FF, 0xFFC0FF00},
-        {0x001F20, 0x00000008, 0x00FF00FF, 0xFF00FF00},
-        {0x001F40, 0x00000008, 0x00AA003F, 0xFF55FFC0},
-        {0x001F60, 0x00000008, 0x000000FF, 0xC000FF00},
-        {0x001F80, 0x00000008, 0x00FF00FF, 0xFF00FF00},
-        {0x001FA0, 0x00000008, 0x000300FF, 0xBFF4FF00},
-        {0x002160, 0xFFFFFFF0, 0xFFFF0000, 0x0000FFFF},
-        {0x0024C0, 0xFFFFFFE6, 0xFFFF0000, 0x0000FFFF},
-        {0x0024E0, 0xFFFFFFE6, 0x000003FF, 0xFFFFFC00},
-        {0x002C20, 0xFFFFFFD0, 0xFFFF0000, 0x0000FFFF},
-        {0x002C40, 0xFFFFFFD0, 0xFFFFFFFF, 0x00000000},
-        {0x002C60, 0xFFFFFFFF, 0x00481502, 0xFFB7EA9D},
-        {0x002C80, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x002CA0, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x002CC0, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x002CE0, 0xFFFFFFFF, 0x0008500A, 0xFFF7AFF5},
-        {0x002D00, 0xFFFFE3A0, 0xFFFFFFFF, 0x00000000},
-        {0x002D20, 0xFFFFE3A0, 0x000020BF, 0xFFFFDF40},
-        {0x00A640, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x00A660, 0xFFFFFFFF, 0x00002AAA, 0xFFFFD555},
-        {0x00A680, 0xFFFFFFFF, 0x0AAAAAAA, 0xF5555555},
-        {0x00A720, 0xFFFFFFFF, 0xAAA8AAA8, 0x55575557},
-        {0x00A740, 0xFFFFFFFF, 0xAAAAAAAA, 0x55555555},
-        {0x00A760, 0xFFFFFFFF, 0x9400AAAA, 0x6BFF5555},
-        {0x00A780, 0xFFFFFFFF, 0xAA8A10AA, 0x5565EF55},
-        {0x00A7A0, 0xFFFFFFFF, 0xAAA002AA, 0x555FFD55},
-        {0x00A7C0, 0xFFFFFFFF, 0x0A82250A, 0xF57DDAF5},
-        {0x00AB60, 0xFFFF6830, 0xFFFF0000, 0x0000FFFF},
-        {0x00AB80, 0xFFFF6830, 0xFFFFFFFF, 0x00000000},
-        {0x00ABA0, 0xFFFF6830, 0xFFFFFFFF, 0x00000000},
-        {0x00FF40, 0xFFFFFFE0, 0x07FFFFFE, 0xF8000001},
-        {0x010420, 0xFFFFFFD8, 0xFFFFFF00, 0x000000FF},
-        {0x010440, 0xFFFFFFD8, 0x0000FFFF, 0xFFFF0000},
-        {0x0104C0, 0xFFFFFFD8, 0xFF000000, 0x00FFFFFF},
-        {0x0104E0, 0xFFFFFFD8, 0x0FFFFFFF, 0xF0000000},
-        {0x010580, 0xFFFFFFD9, 0xFF800000, 0x007FFFFF},
-        {0x0105A0, 0xFFFFFFD9, 0x1BFBFFFB, 0xE4040004},
-        {0x010CC0, 0xFFFFFFC0, 0xFFFFFFFF, 0x00000000},
-        {0x010CE0, 0xFFFFFFC0, 0x0007FFFF, 0xFFF80000},
-        {0x010D60, 0xFFFFFFE0, 0xFFFF0000, 0x0000FFFF},
-        {0x010D80, 0xFFFFFFE0, 0x0000003F, 0xFFFFFFC0},
-        {0x0118C0, 0xFFFFFFE0, 0xFFFFFFFF, 0x00000000},
-        {0x016E60, 0xFFFFFFE0, 0xFFFFFFFF, 0x00000000},
-        {0x01E920, 0xFFFFFFDE, 0xFFFFFFFC, 0x00000003},
-        {0x01E940, 0xFFFFFFDE, 0x0000000F, 0xFFFFFFF0},
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 0, 11, 12, 13,
+        14, 15, 16, 17, 18, 19, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 23, 0, 0, 24, 25, 0, 26, 26, 27, 26, 28, 29, 30, 31,
+        0, 0, 0, 0, 0, 32, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        35, 36, 26, 37, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 39, 40, 0, 41, 42, 43, 44,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 46, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        48, 49, 0, 50, 0, 0, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 52, 0, 14, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 56, 57,
     };
 
-    constexpr CharMapping UPPER_CASE[] =
+    constexpr uint8_t UPPER_CASE_DELTA_INDEXES[] =
     {
-        {0x0000B5, 0x00039C},
-        {0x0000FF, 0x000178},
-        {0x000131, 0x000049},
-        {0x00017F, 0x000053},
-        {0x000180, 0x000243},
-        {0x000195, 0x0001F6},
-        {0x00019A, 0x00023D},
-        {0x00019B, 0x00A7DC},
-        {0x00019E, 0x000220},
-        {0x0001BF, 0x0001F7},
-        {0x0001C6, 0x0001C4},
-        {0x0001C9, 0x0001C7},
-        {0x0001CC, 0x0001CA},
-        {0x0001DD, 0x00018E},
-        {0x0001F3, 0x0001F1},
-        {0x00023F, 0x002C7E},
-        {0x000240, 0x002C7F},
-        {0x000250, 0x002C6F},
-        {0x000251, 0x002C6D},
-        {0x000252, 0x002C70},
-        {0x000253, 0x000181},
-        {0x000254, 0x000186},
-        {0x000256, 0x000189},
-        {0x000257, 0x00018A},
-        {0x000259, 0x00018F},
-        {0x00025B, 0x000190},
-        {0x00025C, 0x00A7AB},
-        {0x000260, 0x000193},
-        {0x000261, 0x00A7AC},
-        {0x000263, 0x000194},
-        {0x000264, 0x00A7CB},
-        {0x000265, 0x00A78D},
-        {0x000266, 0x00A7AA},
-        {0x000268, 0x000197},
-        {0x000269, 0x000196},
-        {0x00026A, 0x00A7AE},
-        {0x00026B, 0x002C62},
-        {0x00026C, 0x00A7AD},
-        {0x00026F, 0x00019C},
-        {0x000271, 0x002C6E},
-        {0x000272, 0x00019D},
-        {0x000275, 0x00019F},
-        {0x00027D, 0x002C64},
-        {0x000282, 0x00A7C5},
-        {0x000287, 0x00A7B1},
-        {0x000289, 0x000244},
-        {0x00028A, 0x0001B1},
-        {0x00028B, 0x0001B2},
-        {0x00028C, 0x000245},
-        {0x000292, 0x0001B7},
-        {0x00029D, 0x00A7B2},
-        {0x00029E, 0x00A7B0},
-        {0x000345, 0x000399},
-        {0x00037B, 0x0003FD},
-        {0x00037C, 0x0003FE},
-        {0x00037D, 0x0003FF},
-        {0x0003AC, 0x000386},
-        {0x0003AD, 0x000388},
-        {0x0003AE, 0x000389},
-        {0x0003AF, 0x00038A},
-        {0x0003C2, 0x0003A3},
-        {0x0003CC, 0x00038C},
-        {0x0003CD, 0x00038E},
-        {0x0003CE, 0x00038F},
-        {0x0003D0, 0x000392},
-        {0x0003D1, 0x000398},
-        {0x0003D5, 0x0003A6},
-        {0x0003D6, 0x0003A0},
-        {0x0003D7, 0x0003CF},
-        {0x0003D9, 0x0003D8},
-        {0x0003DB, 0x0003DA},
-        {0x0003DD, 0x0003DC},
-        {0x0003DF, 0x0003DE},
-        {0x0003F0, 0x00039A},
-        {0x0003F1, 0x0003A1},
-        {0x0003F2, 0x0003F9},
-        {0x0003F3, 0x00037F},
-        {0x0003F5, 0x000395},
-        {0x000450, 0x000400},
-        {0x000451, 0x000401},
-        {0x000452, 0x000402},
-        {0x000453, 0x000403},
-        {0x000454, 0x000404},
-        {0x000455, 0x000405},
-        {0x000456, 0x000406},
-        {0x000457, 0x000407},
-        {0x000458, 0x000408},
-        {0x000459, 0x000409},
-        {0x00045A, 0x00040A},
-        {0x00045B, 0x00040B},
-        {0x00045C, 0x00040C},
-        {0x00045D, 0x00040D},
-        {0x00045E, 0x00040E},
-        {0x00045F, 0x00040F},
-        {0x0004CF, 0x0004C0},
-        {0x001C80, 0x000412},
-        {0x001C81, 0x000414},
-        {0x001C82, 0x00041E},
-        {0x001C83, 0x000421},
-        {0x001C84, 0x000422},
-        {0x001C85, 0x000422},
-        {0x001C86, 0x00042A},
-        {0x001C87, 0x000462},
-        {0x001C88, 0x00A64A},
-        {0x001C8A, 0x001C89},
-        {0x001D79, 0x00A77D},
-        {0x001D7D, 0x002C63},
-        {0x001D8E, 0x00A7C6},
-        {0x001E9B, 0x001E60},
-        {0x001F70, 0x001FBA},
-        {0x001F71, 0x001FBB},
-        {0x001F72, 0x001FC8},
-        {0x001F73, 0x001FC9},
-        {0x001F74, 0x001FCA},
-        {0x001F75, 0x001FCB},
-        {0x001F76, 0x001FDA},
-        {0x001F77, 0x001FDB},
-        {0x001F78, 0x001FF8},
-        {0x001F79, 0x001FF9},
-        {0x001F7A, 0x001FEA},
-        {0x001F7B, 0x001FEB},
-        {0x001F7C, 0x001FFA},
-        {0x001F7D, 0x001FFB},
-        {0x001FB3, 0x001FBC},
-        {0x001FBE, 0x000399},
-        {0x001FC3, 0x001FCC},
-        {0x001FD0, 0x001FD8},
-        {0x001FD1, 0x001FD9},
-        {0x001FE0, 0x001FE8},
-        {0x001FE1, 0x001FE9},
-        {0x001FE5, 0x001FEC},
-        {0x001FF3, 0x001FFC},
-        {0x00214E, 0x002132},
-        {0x002184, 0x002183},
-        {0x002C65, 0x00023A},
-        {0x002C66, 0x00023E},
-        {0x00A794, 0x00A7C4},
-        {0x00A7F6, 0x00A7F5},
-        {0x00AB53, 0x00A7B3},
+        // Block 0
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 1
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        // Block 2
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 3
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 3,
+        // Block 4
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 5, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0, 4, 0, 4, 0,
+        // Block 5
+        4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0, 4, 0, 4, 6,
+        // Block 6
+        7, 0, 0, 4, 0, 4, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0,
+        0, 0, 4, 0, 0, 8, 0, 0, 0, 4, 9, 10, 0, 0, 11, 0,
+        0, 4, 0, 4, 0, 4, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0,
+        4, 0, 0, 0, 4, 0, 4, 0, 0, 4, 0, 0, 0, 4, 0, 12,
+        // Block 7
+        0, 0, 0, 0, 0, 4, 13, 0, 4, 13, 0, 4, 13, 0, 4, 0,
+        4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 14, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 0, 4, 13, 0, 4, 0, 0, 0, 4, 0, 4, 0, 4, 0, 4,
+        // Block 8
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 15,
+        // Block 9
+        15, 0, 4, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        16, 17, 18, 19, 20, 0, 21, 21, 0, 22, 0, 23, 24, 0, 0, 0,
+        21, 25, 0, 26, 27, 28, 29, 0, 30, 31, 29, 32, 33, 0, 0, 31,
+        0, 34, 35, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 37, 0, 0,
+        // Block 10
+        38, 0, 39, 38, 0, 0, 0, 40, 38, 41, 42, 42, 43, 0, 0, 0,
+        0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 46, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 11
+        0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 11, 11, 11, 0, 0,
+        // Block 12
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 49, 49, 49,
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        // Block 13
+        1, 1, 50, 1, 1, 1, 1, 1, 1, 1, 1, 1, 51, 52, 52, 0,
+        53, 54, 0, 0, 0, 55, 56, 57, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        58, 59, 60, 61, 0, 62, 0, 0, 4, 0, 0, 4, 0, 0, 0, 0,
+        // Block 14
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        // Block 15
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 59,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        // Block 16
+        0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        // Block 17
+        0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 63,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        // Block 18
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 19
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        // Block 20
+        64, 64, 64, 64, 64, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 21
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+        65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+        65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 65, 65, 65,
+        // Block 22
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 57, 57, 57, 57, 57, 57, 0, 0,
+        // Block 23
+        66, 67, 68, 69, 69, 70, 71, 72, 73, 0, 4, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 24
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 75, 0, 0,
+        // Block 25
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 76, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 26
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        // Block 27
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 77, 0, 0, 0, 0,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        // Block 28
+        78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 29
+        78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 78, 0, 78, 0, 78, 0, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+        79, 79, 80, 80, 80, 80, 81, 81, 82, 82, 83, 83, 84, 84, 0, 0,
+        // Block 30
+        78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 78, 78, 78, 78, 78, 78, 78, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 78, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 0,
+        // Block 31
+        0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 78, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        78, 78, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 32
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88, 88,
+        // Block 33
+        0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 34
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 89,
+        89, 89, 89, 89, 89, 89, 89, 89, 89, 89, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 35
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        // Block 36
+        64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64, 64,
+        0, 4, 0, 0, 0, 90, 91, 0, 4, 0, 4, 0, 4, 0, 0, 0,
+        0, 0, 0, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 37
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0,
+        0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 38
+        92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+        92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92, 92,
+        92, 92, 92, 92, 92, 92, 0, 92, 0, 0, 0, 0, 0, 92, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 39
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 40
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 41
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        // Block 42
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 4,
+        // Block 43
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 4, 0, 0, 0,
+        0, 4, 0, 4, 93, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+        // Block 44
+        0, 4, 0, 4, 0, 0, 0, 0, 4, 0, 4, 0, 0, 4, 0, 0,
+        0, 4, 0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 45
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 94, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+        // Block 46
+        95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+        95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+        95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+        95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95, 95,
+        // Block 47
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 48
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96, 96, 96, 96, 96,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+        // Block 49
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 50
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 96, 96, 96, 96, 96, 96, 96, 96,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96,
+        96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0,
+        // Block 51
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+        97, 97, 0, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97, 97,
+        97, 97, 0, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 0, 0, 0,
+        // Block 52
+        51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+        51, 51, 51, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 53
+        1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 54
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 55
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        // Block 56
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+        98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98, 98,
+        // Block 57
+        98, 98, 98, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    constexpr int32_t UPPER_CASE_DELTAS[] =
+    {
+        0, -32, 743, 121, -1, -232, -300, 195,
+        97, 163, 42561, 130, 56, -2, -79, 10815,
+        10783, 10780, 10782, -210, -206, -205, -202, -203,
+        42319, 42315, -207, 42343, 42280, 42308, -209, -211,
+        10743, 42305, 10749, -213, -214, 10727, -218, 42307,
+        42282, -69, -217, -71, -219, 42261, 42258, 84,
+        -38, -37, -31, -64, -63, -62, -57, -47,
+        -54, -8, -86, -80, 7, -116, -96, -15,
+        -48, 3008, -6254, -6253, -6244, -6242, -6243, -6236,
+        -6181, 35266, 35332, 3814, 35384, -59, 8, 74,
+        86, 100, 128, 112, 126, 9, -7205, -28,
+        -16, -26, -10795, -10792, -7264, 48, -928, -38864,
+        -40, -39, -34,
+    };
+
+    constexpr CaseMappingTable UPPER_CASE_TABLE =
+    {
+        UPPER_CASE_BLOCKS,
+        std::size(UPPER_CASE_BLOCKS),
+        UPPER_CASE_DELTA_INDEXES,
+        UPPER_CASE_DELTAS
+    };
+
+    /**
+     * @brief The values that are added to the UTF-8 encodings of the
+     *  code points below U+10000, read as big-endian integers.
+     *
+     * Code points that are converted to several code points have
+     * UTF8_CASE_SPECIAL plus their index in SPECIAL_CASING.
+     */
+    constexpr uint8_t UPPER_CASE_UTF8_BLOCKS[] =
+    {
+        0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 10, 11, 12,
+        13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 21,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 22, 0, 0, 23, 24, 0, 25, 25, 26, 25, 27, 28, 29, 30,
+        0, 0, 0, 0, 0, 31, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        34, 35, 25, 36, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 38, 39, 0, 40, 41, 42, 43,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 45, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+    };
+
+    constexpr uint8_t UPPER_CASE_UTF8_DELTA_INDEXES[] =
+    {
+        // Block 0
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 1
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 2
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 4,
+        // Block 3
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 6, 0, 5, 0, 5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 0,
+        // Block 4
+        7, 0, 5, 0, 5, 0, 5, 0, 5, 8, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 5, 0, 5, 0, 5, 6,
+        // Block 5
+        9, 0, 0, 5, 0, 5, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0,
+        0, 0, 5, 0, 0, 10, 0, 0, 0, 5, 11, 6, 0, 0, 12, 0,
+        0, 5, 0, 5, 0, 5, 0, 0, 5, 0, 0, 0, 0, 5, 0, 0,
+        5, 0, 0, 0, 5, 0, 5, 0, 0, 5, 0, 0, 0, 5, 0, 13,
+        // Block 6
+        0, 0, 0, 0, 0, 5, 14, 0, 5, 14, 0, 5, 14, 0, 5, 0,
+        5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 15, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        16, 0, 5, 14, 0, 5, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5,
+        // Block 7
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 6,
+        // Block 8
+        6, 0, 5, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        6, 6, 6, 17, 18, 0, 19, 19, 0, 20, 0, 21, 6, 0, 0, 0,
+        19, 6, 0, 22, 6, 6, 6, 0, 23, 24, 6, 6, 6, 0, 0, 24,
+        0, 6, 25, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0,
+        // Block 9
+        27, 0, 6, 27, 0, 0, 0, 6, 27, 28, 29, 29, 30, 0, 0, 0,
+        0, 0, 31, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 10
+        0, 0, 0, 0, 0, 32, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 5, 0, 5, 0, 0, 0, 5, 0, 0, 0, 12, 12, 12, 0, 0,
+        // Block 11
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 34, 35, 35, 35,
+        36, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        // Block 12
+        37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 40, 40, 0,
+        41, 42, 0, 0, 0, 43, 44, 45, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        46, 47, 48, 49, 0, 50, 0, 0, 5, 0, 0, 5, 0, 0, 0, 0,
+        // Block 13
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+        // Block 14
+        37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+        47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        // Block 15
+        0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        // Block 16
+        0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 51,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        // Block 17
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 18
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+        // Block 19
+        52, 52, 52, 52, 52, 52, 52, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 20
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+        55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 0, 0, 55, 55, 55,
+        // Block 21
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 45, 45, 45, 45, 0, 0,
+        // Block 22
+        6, 6, 6, 6, 6, 6, 6, 6, 56, 0, 5, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 23
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 58, 0, 0,
+        // Block 24
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 25
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        // Block 26
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 60, 61, 62, 63, 64, 65, 0, 0, 0, 0,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        // Block 27
+        66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0, 0, 0, 0,
+        66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0, 0, 0, 0,
+        66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 28
+        66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        67, 66, 68, 66, 69, 66, 70, 66, 0, 0, 0, 0, 0, 0, 0, 0,
+        66, 66, 66, 66, 66, 66, 66, 66, 0, 0, 0, 0, 0, 0, 0, 0,
+        71, 71, 72, 72, 72, 72, 73, 73, 74, 74, 75, 75, 76, 76, 0, 0,
+        // Block 29
+        77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92,
+        93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+        109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
+        66, 66, 125, 126, 127, 0, 128, 129, 0, 0, 0, 0, 130, 0, 6, 0,
+        // Block 30
+        0, 0, 131, 132, 133, 0, 134, 135, 0, 0, 0, 0, 136, 0, 0, 0,
+        66, 66, 137, 138, 0, 0, 139, 140, 0, 0, 0, 0, 0, 0, 0, 0,
+        66, 66, 141, 142, 143, 48, 144, 145, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 146, 147, 148, 0, 149, 150, 0, 0, 0, 0, 151, 0, 0, 0,
+        // Block 31
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 152, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153, 153,
+        // Block 32
+        0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 33
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        154, 154, 154, 154, 154, 154, 154, 154, 154, 154, 155, 155, 155, 155, 155, 155,
+        155, 155, 155, 155, 155, 155, 155, 155, 155, 155, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 34
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+        // Block 35
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+        0, 5, 0, 0, 0, 6, 6, 0, 5, 0, 5, 0, 5, 0, 0, 0,
+        0, 0, 0, 5, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 36
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0,
+        0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 37
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156, 156,
+        157, 157, 157, 157, 157, 157, 0, 157, 0, 0, 0, 0, 0, 157, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 38
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 39
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 40
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        // Block 41
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5, 0, 0, 5,
+        // Block 42
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0,
+        0, 5, 0, 5, 158, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5, 0, 5,
+        // Block 43
+        0, 5, 0, 5, 0, 0, 0, 0, 5, 0, 5, 0, 0, 5, 0, 0,
+        0, 5, 0, 0, 0, 0, 0, 5, 0, 5, 0, 5, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 44
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 159, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+        // Block 45
+        161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161, 161,
+        160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+        160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+        160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+        // Block 46
+        162, 163, 164, 165, 166, 167, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 169, 170, 171, 172, 173, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        // Block 47
+        0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+        37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    };
+
+    constexpr int32_t UPPER_CASE_UTF8_DELTAS[] =
+    {
+        0, 3047, UTF8_CASE_SPECIAL + 0, -32, 505, -1, UTF8_CASE_FALLBACK, -193,
+        UTF8_CASE_SPECIAL + 2, 771, 289, 547, 514, 248, -2, -271,
+        UTF8_CASE_SPECIAL + 3, -786, -782, -781, -778, -779, -783, -785,
+        -787, -789, -790, -986, -261, -985, -263, -987,
+        276, UTF8_CASE_SPECIAL + 4, -38, -37, UTF8_CASE_SPECIAL + 5, -224, -223, -256,
+        -255, -254, -249, -239, -246, -8, -278, -272,
+        7, -500, -288, -15, -240, -48, UTF8_CASE_SPECIAL + 6, 12032,
+        583426, 583684, 64486, 583928, UTF8_CASE_SPECIAL + 7, UTF8_CASE_SPECIAL + 8, UTF8_CASE_SPECIAL + 9, UTF8_CASE_SPECIAL + 10,
+        UTF8_CASE_SPECIAL + 11, -251, 8, UTF8_CASE_SPECIAL + 12, UTF8_CASE_SPECIAL + 13, UTF8_CASE_SPECIAL + 14, UTF8_CASE_SPECIAL + 15, 266,
+        470, 484, 512, 496, 510, UTF8_CASE_SPECIAL + 16, UTF8_CASE_SPECIAL + 17, UTF8_CASE_SPECIAL + 18,
+        UTF8_CASE_SPECIAL + 19, UTF8_CASE_SPECIAL + 20, UTF8_CASE_SPECIAL + 21, UTF8_CASE_SPECIAL + 22, UTF8_CASE_SPECIAL + 23, UTF8_CASE_SPECIAL + 24, UTF8_CASE_SPECIAL + 25, UTF8_CASE_SPECIAL + 26,
+        UTF8_CASE_SPECIAL + 27, UTF8_CASE_SPECIAL + 28, UTF8_CASE_SPECIAL + 29, UTF8_CASE_SPECIAL + 30, UTF8_CASE_SPECIAL + 31, UTF8_CASE_SPECIAL + 32, UTF8_CASE_SPECIAL + 33, UTF8_CASE_SPECIAL + 34,
+        UTF8_CASE_SPECIAL + 35, UTF8_CASE_SPECIAL + 36, UTF8_CASE_SPECIAL + 37, UTF8_CASE_SPECIAL + 38, UTF8_CASE_SPECIAL + 39, UTF8_CASE_SPECIAL + 40, UTF8_CASE_SPECIAL + 41, UTF8_CASE_SPECIAL + 42,
+        UTF8_CASE_SPECIAL + 43, UTF8_CASE_SPECIAL + 44, UTF8_CASE_SPECIAL + 45, UTF8_CASE_SPECIAL + 46, UTF8_CASE_SPECIAL + 47, UTF8_CASE_SPECIAL + 48, UTF8_CASE_SPECIAL + 49, UTF8_CASE_SPECIAL + 50,
+        UTF8_CASE_SPECIAL + 51, UTF8_CASE_SPECIAL + 52, UTF8_CASE_SPECIAL + 53, UTF8_CASE_SPECIAL + 54, UTF8_CASE_SPECIAL + 55, UTF8_CASE_SPECIAL + 56, UTF8_CASE_SPECIAL + 57, UTF8_CASE_SPECIAL + 58,
+        UTF8_CASE_SPECIAL + 59, UTF8_CASE_SPECIAL + 60, UTF8_CASE_SPECIAL + 61, UTF8_CASE_SPECIAL + 62, UTF8_CASE_SPECIAL + 63, UTF8_CASE_SPECIAL + 64, UTF8_CASE_SPECIAL + 65, UTF8_CASE_SPECIAL + 66,
+        UTF8_CASE_SPECIAL + 67, UTF8_CASE_SPECIAL + 68, UTF8_CASE_SPECIAL + 69, UTF8_CASE_SPECIAL + 70, UTF8_CASE_SPECIAL + 71, UTF8_CASE_SPECIAL + 72, UTF8_CASE_SPECIAL + 73, UTF8_CASE_SPECIAL + 74,
+        UTF8_CASE_SPECIAL + 75, UTF8_CASE_SPECIAL + 76, UTF8_CASE_SPECIAL + 77, UTF8_CASE_SPECIAL + 78, UTF8_CASE_SPECIAL + 79, UTF8_CASE_SPECIAL + 80, UTF8_CASE_SPECIAL + 81, UTF8_CASE_SPECIAL + 82,
+        UTF8_CASE_SPECIAL + 83, UTF8_CASE_SPECIAL + 84, UTF8_CASE_SPECIAL + 85, UTF8_CASE_SPECIAL + 86, UTF8_CASE_SPECIAL + 87, UTF8_CASE_SPECIAL + 88, UTF8_CASE_SPECIAL + 89, UTF8_CASE_SPECIAL + 90,
+        -220, -16, -218, -26, -78304, -78112, 240, -3808,
+        -597776, -597968, UTF8_CASE_SPECIAL + 91, UTF8_CASE_SPECIAL + 92, UTF8_CASE_SPECIAL + 93, UTF8_CASE_SPECIAL + 94, UTF8_CASE_SPECIAL + 95, UTF8_CASE_SPECIAL + 96,
+        UTF8_CASE_SPECIAL + 97, UTF8_CASE_SPECIAL + 98, UTF8_CASE_SPECIAL + 99, UTF8_CASE_SPECIAL + 100, UTF8_CASE_SPECIAL + 101, UTF8_CASE_SPECIAL + 102,
+    };
+
+    constexpr CaseMappingTable UPPER_CASE_UTF8_TABLE =
+    {
+        UPPER_CASE_UTF8_BLOCKS,
+        std::size(UPPER_CASE_UTF8_BLOCKS),
+        UPPER_CASE_UTF8_DELTA_INDEXES,
+        UPPER_CASE_UTF8_DELTAS
     };
 }
 
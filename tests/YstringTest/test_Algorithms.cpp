@@ -8,6 +8,7 @@
 #include "Utf8Chars.hpp"
 #include "Ystring/Algorithms.hpp"
 #include "Ystring/CodepointPredicates.hpp"
+#include <unordered_map>
 #include <catch2/catch_test_macros.hpp>
 #include "U8Adapter.hpp"
 
@@ -42,6 +43,33 @@ TEST_CASE("Test case_insensitive::equal")
     REQUIRE(!case_insensitive::equal(U8("aBcæØå"), U8("AbCæØø")));
 }
 
+TEST_CASE("Test case_insensitive::hash")
+{
+    REQUIRE(case_insensitive::hash(U8("aBcØæ")) == case_insensitive::hash(U8("AbCøÆ")));
+    REQUIRE(case_insensitive::hash("abc") != case_insensitive::hash("abd"));
+    REQUIRE(case_insensitive::hash("abc") != case_insensitive::hash(std::string_view("abc\0", 4)));
+    // LATIN SMALL LETTER LONG S is equal to S and s, but has a two-byte
+    // encoding, which moves the following ASCII characters.
+    std::string a = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx ſ Long ASCII string after long s";
+    std::string b = "XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX S LONG ASCII STRING AFTER LONG S";
+    REQUIRE(case_insensitive::equal(a, b));
+    REQUIRE(case_insensitive::hash(a) == case_insensitive::hash(b));
+    REQUIRE_THROWS(case_insensitive::hash("abc\xFF"));
+}
+
+TEST_CASE("Test CaseInsensitiveHash and CaseInsensitiveStringEqual")
+{
+    std::unordered_map<std::string, int, CaseInsensitiveHash,
+                       CaseInsensitiveStringEqual> map;
+    map.emplace("Content-Type", 1);
+    map.emplace(U8("Blåbær"), 2);
+    REQUIRE(map.emplace("CONTENT-TYPE", 3).second == false);
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.find(std::string_view("content-type"))->second == 1);
+    REQUIRE(map.find(U8("BLÅBÆR"))->second == 2);
+    REQUIRE(map.find("content-length") == map.end());
+}
+
 TEST_CASE("Test case_insensitive::less")
 {
     REQUIRE(!case_insensitive::less(U8("aBcØæ"), U8("AbCøÆ")));
@@ -49,6 +77,33 @@ TEST_CASE("Test case_insensitive::less")
     REQUIRE(case_insensitive::less(U8("aBcæØå"), U8("AbCæØø")));
 }
 
+TEST_CASE("Test case_insensitive comparisons of long ASCII strings")
+{
+    std::string a = "Content-Type: text/plain; charset=utf-8 @[{";
+    std::string b = "CONTENT-TYPE: TEXT/PLAIN; CHARSET=UTF-8 @[{";
+    REQUIRE(case_insensitive::equal(a, b));
+    REQUIRE(case_insensitive::compare(a, b) == 0);
+    REQUIRE(case_insensitive::starts_with(a, b.substr(0, 30)));
+    REQUIRE(case_insensitive::ends_with(a, b.substr(10)));
+
+    for (size_t i = 0; i < b.size(); ++i)
+    {
+        auto c = b;
+        c[i] = char(c[i] + 1);
+        REQUIRE(!case_insensitive::equal(a, c));
+        REQUIRE(case_insensitive::less(a, c));
+        REQUIRE(case_insensitive::compare(c, a) > 0);
+        REQUIRE(!case_insensitive::starts_with(a, c));
+        REQUIRE(!case_insensitive::ends_with(a, c));
+    }
+
+    REQUIRE(case_insensitive::equal(a + U8("ÆØÅ"), b + U8("æøå")));
+    REQUIRE(case_insensitive::less(a + U8("ÆØ"), b + U8("æøå")));
+    REQUIRE(case_insensitive::equal(U8("abcdefghıjklmnopq"), "ABCDEFGHIJKLMNOPQ"));
+    REQUIRE(case_insensitive::starts_with(U8("abcdefghıjklmnopq"), "ABCDEFGHIJ"));
+    REQUIRE(case_insensitive::ends_with("ABCDEFGHIJKLMNOPQ", U8("ıjklmnopq")));
+}
+
 TEST_CASE("Test case_insensitive::ends_with")
 {
     REQUIRE(case_insensitive::ends_with(U8("ABCDÆøÅQRS"), U8("ØåQrS")));
@@ -58,6 +113,33 @@ TEST_CASE("Test case_insensitive::ends_with")
     REQUIRE(case_insensitive::ends_with(U8("ABCDÆØåQRS"), U8("")));
 }
 
+TEST_CASE("Test case_insensitive::find_all")
+{
+    std::string s = U8("aBæabÆABæÆabæ");
+    REQUIRE(case_insensitive::find_all(s, U8("abÆ")) == std::vector<Subrange>{{0, 4}, {4, 4}, {8, 4}, {14, 4}});
+    REQUIRE(case_insensitive::find_all("aaaaa", "AA") == std::vector<Subrange>{{0, 2}, {2, 2}});
+    REQUIRE(case_insensitive::find_all("abc", "d").empty());
+    REQUIRE(case_insensitive::find_all("abc", "").empty());
+
+    std::vector<Subrange> matches;
+    REQUIRE(case_insensitive::find_all("a-B-b", "b", matches) == 2);
+    REQUIRE(case_insensitive::find_all("c", "C", matches) == 1);
+    REQUIRE(matches == std::vector<Subrange>{{2, 1}, {4, 1}, {0, 1}});
+}
+
+TEST_CASE("Test case_insensitive::find_first with partial matches")
+{
+    REQUIRE(case_insensitive::find_first("aaaaaaaaab", "AAAB") == Subrange(6, 4));
+    REQUIRE(case_insensitive::find_first("abababac", "ABAC") == Subrange(4, 4));
+    REQUIRE(case_insensitive::find_first(U8("æææøæææå"), U8("ÆÆÅ")) == Subrange(10, 6));
+    REQUIRE(case_insensitive::find_first("xAbc xabc", "ABC", 2) == Subrange(6, 3));
+    REQUIRE(!case_insensitive::find_first("xAbc", "ABC", 4));
+
+    std::string long_str(10000, 'a');
+    REQUIRE(!case_insensitive::find_first(long_str, std::string(5000, 'A') + "b"));
+    REQUIRE(!case_insensitive::find_last(long_str, "b" + std::string(5000, 'A')));
+}
+
 TEST_CASE("Test case_insensitive::find_first")
 {
     std::string s = "ABCÆØÅäöü";
@@ -74,6 +156,14 @@ TEST_CASE("Test case_insensitive::find_first_of")
     REQUIRE(!case_insensitive::find_first_of("qwerty", chars).first);
 }
 
+TEST_CASE("Test case_insensitive::find_first_of with negated set")
+{
+    auto set = parse_codepoint_set("[^a]");
+    CHECK_CHAR_SEARCH(case_insensitive::find_first_of("abc", set), 1, 1, 'b');
+    CHECK_CHAR_SEARCH(case_insensitive::find_first_of("AaBc", set), 2, 1, 'B');
+    REQUIRE(!case_insensitive::find_first_of("aAa", set).first);
+}
+
 TEST_CASE("Test case_insensitive::find_last")
 {
     std::string s = "ABCÆØÅäöü";
@@ -81,6 +171,8 @@ TEST_CASE("Test case_insensitive::find_last")
     REQUIRE(case_insensitive::find_last(s, "abcæ") == Subrange(0, 5));
     REQUIRE(case_insensitive::find_last(s, "Åäöü") == Subrange(7, 8));
     REQUIRE(!case_insensitive::find_last(s, "åaBC"));
+    REQUIRE(case_insensitive::find_last("baaaaaaaa", "BAAA") == Subrange(0, 4));
+    REQUIRE(case_insensitive::find_last("xAbc xabc", "ABC", 8) == Subrange(1, 3));
 }
 
 TEST_CASE("Test case_insensitive::find_last_of")
@@ -112,6 +204,36 @@ TEST_CASE("Test contains")
     REQUIRE(contains(U8("ABC∑ßÖ’Ü‹›ƒ¸√EFG"), U'√'));
 }
 
+TEST_CASE("Test count")
+{
+    REQUIRE(count(U8("aåbåcåå"), U8("å")) == 4);
+    REQUIRE(count(U8("aåbåcåå"), U8("åå")) == 1);
+    REQUIRE(count("aaaaa", "aa") == 2);
+    REQUIRE(count("abc", "a") == 1);
+    REQUIRE(count("abc", "") == 0);
+    REQUIRE(count("", "a") == 0);
+}
+
+TEST_CASE("Test count_of")
+{
+    std::u32string chars = U"aå≠";
+    REQUIRE(count_of(U8("aåbå≠cå"), chars) == 5);
+    REQUIRE(count_of(U8("aåbå≠cå"), U"b") == 1);
+    CodepointSet set;
+    set.add_range('a', 'c');
+    set.add_codepoint(U'å');
+    REQUIRE(count_of(U8("aåbå≠cåd"), set) == 6);
+    REQUIRE(count_of("", set) == 0);
+}
+
+TEST_CASE("Test case_insensitive::count")
+{
+    REQUIRE(case_insensitive::count(U8("aÅbåcåÅ"), U8("å")) == 4);
+    REQUIRE(case_insensitive::count(U8("aÅbåcåÅ"), U8("Åå")) == 1);
+    REQUIRE(case_insensitive::count("aAaAa", "Aa") == 2);
+    REQUIRE(case_insensitive::count("abc", "") == 0);
+}
+
 TEST_CASE("Test count_chars")
 {
     REQUIRE(count_chars("P\u0310s") == 2);
@@ -132,6 +254,36 @@ TEST_CASE("Test ends_with")
     REQUIRE(ends_with(U8("ABCDÆØÅQRS"), U8("")));
 }
 
+TEST_CASE("Test find_all")
+{
+    std::string s = U8("abåabåaabå");
+    REQUIRE(find_all(s, U8("abå")) == std::vector<Subrange>{{0, 4}, {4, 4}, {9, 4}});
+    REQUIRE(find_all("aaaaa", "aa") == std::vector<Subrange>{{0, 2}, {2, 2}});
+    REQUIRE(find_all("abc", "").empty());
+
+    std::vector<Subrange> matches = {{100, 1}};
+    REQUIRE(find_all("a-b-c", "-", matches) == 2);
+    REQUIRE(matches == std::vector<Subrange>{{100, 1}, {1, 1}, {3, 1}});
+
+    std::vector<size_t> offsets;
+    find_all("a-b-c-d", "-", [&](Subrange m)
+    {
+        offsets.push_back(m.offset);
+        return offsets.size() < 2;
+    });
+    REQUIRE(offsets == std::vector<size_t>{1, 3});
+}
+
+TEST_CASE("Test find_all_of")
+{
+    REQUIRE(find_all_of(U8("aåbå≠c"), U"å≠") == std::vector<Subrange>{{1, 2}, {4, 2}, {6, 3}});
+    CodepointSet set;
+    set.add_range('b', 'c');
+    set.add_codepoint(U'≠');
+    REQUIRE(find_all_of(U8("aåbå≠c"), set) == std::vector<Subrange>{{3, 1}, {6, 3}, {9, 1}});
+    REQUIRE(find_all_of("xyz", set).empty());
+}
+
 TEST_CASE("Test find_first")
 {
     std::string s = "ABCDEFGHCDEIJK";
@@ -154,6 +306,33 @@ TEST_CASE("Test find_first_newline")
     REQUIRE(!find_first_newline("abcdef"));
 }
 
+TEST_CASE("Test find_first_newline in long strings")
+{
+    std::string prefix(37, 'x');
+    for (size_t i = 0; i < 20; ++i)
+    {
+        auto s = prefix.substr(0, i + 10);
+        REQUIRE(find_first_newline(s + "\r\n" + prefix) == Subrange(i + 10, 2));
+        REQUIRE(find_first_newline(s + "\r") == Subrange(i + 10, 1));
+        REQUIRE(find_first_newline(s + "\f" + prefix) == Subrange(i + 10, 1));
+        REQUIRE(find_first_newline(s + UTF8_NEXT_LINE + prefix) == Subrange(i + 10, 2));
+        REQUIRE(find_first_newline(s + UTF8_LINE_SEPARATOR + prefix) == Subrange(i + 10, 3));
+        REQUIRE(find_first_newline(s + UTF8_PARAGRAPH_SEPARATOR) == Subrange(i + 10, 3));
+        REQUIRE(find_first_newline(s + "\r\n", i + 11) == Subrange(i + 11, 1));
+    }
+    REQUIRE(find_first_newline(prefix + U8("\t\x0E\x09Å≠€" "\xE2\x80\xAA" "\xC2\xA0") + prefix + "\v")
+            == Subrange(2 * 37 + 16, 1));
+    REQUIRE(!find_first_newline(prefix + "\xE2\x80"));
+}
+
+TEST_CASE("Test find_first_newline with invalid UTF-8")
+{
+    REQUIRE(find_first_newline("a\xFF\r\xFF\n") == Subrange(2, 1));
+    REQUIRE(!find_first_newline("\x80\xC2\xE2\x80"));
+    REQUIRE(split_lines("a\xFF\nb")
+            == std::vector<std::string_view>{"a\xFF", "b"});
+}
+
 TEST_CASE("Test find_first_of")
 {
     char32_t chars[4] = {U'≠', 'A', 'B', U'¿'};
@@ -473,3 +652,41 @@ TEST_CASE("Test trim_start")
     REQUIRE(trim_start(U8("f oøo Ø"), CHAR_SPAN) == U8("f oøo Ø"));
     REQUIRE(trim_start(U8(" øf oøo Ø"), CHAR_SPAN) == U8("f oøo Ø"));
 }
+
+TEST_CASE("Test split and trim with few characters and invalid UTF-8")
+{
+    char32_t CHARS[] = {' ', U'Ø'};
+    std::u32string_view CHAR_SPAN(CHARS);
+    REQUIRE(split("a\xFF b", CHAR_SPAN) == sv({"a\xFF", "b"}));
+    REQUIRE(trim(" \xFFa\xC3 ", CHAR_SPAN) == "\xFFa\xC3");
+    REQUIRE(trim_end("\xFF \xC3\x98", CHAR_SPAN) == "\xFF");
+    REQUIRE(trim_start(" \x80", CHAR_SPAN) == "\x80");
+}
+
+TEST_CASE("Test find_first_of and find_last_of with many characters")
+{
+    std::u32string chars = U"0123456789≠";
+    CHECK_CHAR_SEARCH(find_first_of(U8("qwe≠1rty"), chars), 3, 3, U'≠');
+    CHECK_CHAR_SEARCH(find_last_of(U8("qwe≠1rty"), chars), 6, 1, U'1');
+    REQUIRE(!find_first_of("qwerty", chars).first);
+}
+
+TEST_CASE("Test find_first_of and find_last_of with offsets")
+{
+    char32_t chars[] = {U'Ø', U'Å', 'x'};
+    std::string s = U8("abcØdefghijklmnopqrÅstuvwxyz");
+    CHECK_CHAR_SEARCH(find_first_of(s, chars), 3, 2, U'Ø');
+    CHECK_CHAR_SEARCH(find_first_of(s, chars, 5), 20, 2, U'Å');
+    CHECK_CHAR_SEARCH(find_first_of(s, chars, 22), 27, 1, 'x');
+    CHECK_CHAR_SEARCH(find_last_of(s, chars), 27, 1, 'x');
+    CHECK_CHAR_SEARCH(find_last_of(s, chars, 27), 20, 2, U'Å');
+    CHECK_CHAR_SEARCH(find_last_of(s, chars, 21), 3, 2, U'Ø');
+    REQUIRE(!find_last_of(s, chars, 4).first);
+}
+
+TEST_CASE("Test contains with multi-byte code points")
+{
+    REQUIRE(contains(U8("abcæøå"), U'å'));
+    REQUIRE(!contains(U8("abcæøå"), U'Å'));
+    REQUIRE(!contains("abc", 0x110000));
+}
@@ -6,7 +6,12 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Ystring/CharClass.hpp"
+#include "Ystring/CodepointConstants.hpp"
+#include "Ystring/CodepointSet.hpp"
+#include "Ystring/DecodeUtf8.hpp"
+#include "Ystring/YstringException.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
 
 TEST_CASE("get_char_class on compressed double ranges")
 {
@@ -36,3 +41,104 @@ TEST_CASE("get_char_class on ASCII character")
 {
     REQUIRE(ystring::get_char_class('A') == ystring::CharClass::UPPERCASE_LETTER);
 }
+
+TEST_CASE("get_char_class inside ranges of ideographs")
+{
+    REQUIRE(ystring::get_char_class(0x3400) == ystring::CharClass::OTHER_LETTER);
+    REQUIRE(ystring::get_char_class(0x4E01) == ystring::CharClass::OTHER_LETTER);
+    REQUIRE(ystring::get_char_class(0x9FFF) == ystring::CharClass::OTHER_LETTER);
+    REQUIRE(ystring::get_char_class(0xA000) == ystring::CharClass::OTHER_LETTER);
+    REQUIRE(ystring::get_char_class(0xAC01) == ystring::CharClass::OTHER_LETTER);
+    REQUIRE(ystring::get_char_class(0x2A6E0) == ystring::CharClass::UNASSIGNED);
+}
+
+TEST_CASE("get_char_class agrees with make_codepoint_set")
+{
+    using namespace ystring;
+    for (auto cls : {CharClass::LETTER, CharClass::MARK, CharClass::NUMBER,
+                     CharClass::PUNCTUATION, CharClass::UNASSIGNED})
+    {
+        auto set = make_codepoint_set(cls);
+        for (char32_t ch = 0; ch <= UNICODE_MAX; ++ch)
+        {
+            if (set.contains(ch) != ((get_char_class(ch) & cls) != 0))
+                FAIL("Mismatch at " << uint32_t(ch) << " for " << cls);
+        }
+    }
+    REQUIRE(get_char_class(UNICODE_MAX + 1) == CharClass::UNASSIGNED);
+}
+
+TEST_CASE("get_char_classes")
+{
+    using namespace ystring;
+    std::string_view str = U8("Ab 1\u00E6\u0301\u4E2D.xyzXYZ01");
+    auto classes = get_char_classes(str);
+    REQUIRE(classes.size() == str.size());
+    REQUIRE(classes == std::vector<CharClass_t>{
+        CharClass::UPPERCASE_LETTER, CharClass::LOWERCASE_LETTER,
+        CharClass::SPACE_SEPARATOR, CharClass::DECIMAL_NUMBER,
+        CharClass::LOWERCASE_LETTER, CharClass_t(0),
+        CharClass::NONSPACING_MARK, CharClass_t(0),
+        CharClass::OTHER_LETTER, CharClass_t(0), CharClass_t(0),
+        CharClass::OTHER_PUNCTUATION,
+        CharClass::LOWERCASE_LETTER, CharClass::LOWERCASE_LETTER,
+        CharClass::LOWERCASE_LETTER, CharClass::UPPERCASE_LETTER,
+        CharClass::UPPERCASE_LETTER, CharClass::UPPERCASE_LETTER,
+        CharClass::DECIMAL_NUMBER, CharClass::DECIMAL_NUMBER});
+
+    std::vector<CharClass_t> buffer(3);
+    REQUIRE_THROWS_AS(get_char_classes("abcd", buffer), YstringException);
+    REQUIRE_THROWS_AS(get_char_classes("abc\xFF"), YstringException);
+    REQUIRE(get_char_classes("").empty());
+}
+
+TEST_CASE("get_char_classes agrees with get_char_class")
+{
+    using namespace ystring;
+    std::string str;
+    for (int i = 0; i < 500; ++i)
+    {
+        str += "word";
+        str += U8("\u00C6\u00F8");
+        str += " 42,\t";
+        str += U8("\u0418\u4E2D\U0001F600");
+    }
+    auto classes = get_char_classes(str);
+    auto it = str.begin();
+    char32_t ch;
+    while (it != str.end())
+    {
+        auto pos = size_t(it - str.begin());
+        REQUIRE(safe_decode_next(it, str.end(), ch));
+        REQUIRE(classes[pos] == get_char_class(ch));
+    }
+}
+
+TEST_CASE("get_char_class_runs")
+{
+    using namespace ystring;
+    std::string_view str = U8("Hello, w\u00F6rld 42!");
+    REQUIRE(get_char_class_runs(str) == std::vector<CharClassRun>{
+        {{0, 1}, CharClass::UPPERCASE_LETTER},
+        {{1, 4}, CharClass::LOWERCASE_LETTER},
+        {{5, 1}, CharClass::OTHER_PUNCTUATION},
+        {{6, 1}, CharClass::SPACE_SEPARATOR},
+        {{7, 6}, CharClass::LOWERCASE_LETTER},
+        {{13, 1}, CharClass::SPACE_SEPARATOR},
+        {{14, 2}, CharClass::DECIMAL_NUMBER},
+        {{16, 1}, CharClass::OTHER_PUNCTUATION}});
+
+    uint32_t groups[] = {CharClass::LETTER,
+                         CharClass::NUMBER | CharClass::SEPARATOR};
+    std::vector<CharClassRun> runs{{{9, 9}, 9}};
+    REQUIRE(get_char_class_runs(str, runs, groups) == 6);
+    REQUIRE(runs == std::vector<CharClassRun>{
+        {{9, 9}, 9},
+        {{0, 5}, CharClass::LETTER},
+        {{5, 1}, CharClass::OTHER_PUNCTUATION},
+        {{6, 1}, groups[1]},
+        {{7, 6}, CharClass::LETTER},
+        {{13, 3}, groups[1]},
+        {{16, 1}, CharClass::OTHER_PUNCTUATION}});
+    REQUIRE(get_char_class_runs("").empty());
+}
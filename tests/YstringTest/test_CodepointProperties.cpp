@@ -0,0 +1,47 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/ConvertCase.hpp"
+#include "Ystring/Normalize.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include "Ystring/CodepointPropertiesTables.hpp"
+
+using namespace ystring;
+
+TEST_CASE("Test CodepointProperties agree with the separate tables")
+{
+    const auto& table = CODEPOINT_PROPERTY_TABLE;
+    for (char32_t ch = 0; ch <= UNICODE_MAX; ++ch)
+    {
+        const auto& props = table.get(ch);
+        if (props.get_char_class() != get_char_class(ch)
+            || table.to_lower(ch, props) != to_lower(ch)
+            || table.to_title(ch, props) != to_title(ch)
+            || table.to_upper(ch, props) != to_upper(ch))
+        {
+            FAIL("Mismatch at " << uint32_t(ch));
+        }
+
+        auto decomposed = decompose(ch);
+        if ((props.decomposition == 0) != (ch < 0xC0 || decomposed.size() == 1))
+            FAIL("Mismatching decomposition at " << uint32_t(ch));
+    }
+}
+
+TEST_CASE("Test CodepointProperties of selected code points")
+{
+    const auto& table = CODEPOINT_PROPERTY_TABLE;
+    REQUIRE(table.get(0x301).combining_class == 230);
+    REQUIRE(table.get(0x301).is(CharClass::MARK));
+    REQUIRE(table.get(0x327).combining_class == 202);
+    REQUIRE(table.get('a').combining_class == 0);
+    REQUIRE(table.get(0xDF).special_casing != 0);
+    REQUIRE(table.get(0xE5).decomposition != 0);
+    REQUIRE(table.get(0x110000).get_char_class() == CharClass::UNASSIGNED);
+    REQUIRE(table.get(0xE0000).get_char_class() == CharClass::UNASSIGNED);
+    REQUIRE(table.get(0x10FFFD).get_char_class() == CharClass::PRIVATE_USE);
+}
@@ -0,0 +1,118 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/CodepointSet.hpp"
+#include "Ystring/CharClass.hpp"
+#include "Ystring/CodepointConstants.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+using namespace ystring;
+
+namespace
+{
+    std::vector<CodepointRange> r(std::vector<CodepointRange> ranges)
+    {
+        return ranges;
+    }
+}
+
+TEST_CASE("CodepointSet::add_range merges overlapping ranges")
+{
+    CodepointSet set;
+    set.add_range('m', 'p');
+    set.add_range('a', 'c');
+    set.add_range('x', 'z');
+    REQUIRE(set.ranges == r({{'a', 'c'}, {'m', 'p'}, {'x', 'z'}}));
+    set.add_range('d', 'n');
+    REQUIRE(set.ranges == r({{'a', 'p'}, {'x', 'z'}}));
+    set.add_range('r', 'w');
+    REQUIRE(set.ranges == r({{'a', 'p'}, {'r', 'z'}}));
+}
+
+TEST_CASE("CodepointSet::add_codepoints")
+{
+    CodepointSet set;
+    set.add_codepoints(U"dacbzx");
+    REQUIRE(set.ranges == r({{'a', 'd'}, {'x', 'x'}, {'z', 'z'}}));
+    set.add_codepoint('y');
+    REQUIRE(set.ranges == r({{'a', 'd'}, {'x', 'z'}}));
+}
+
+TEST_CASE("CodepointSet::canonicalize")
+{
+    CodepointSet set{{{'x', 'z'}, {'a', 'f'}, {'c', 'd'}, {'g', 'h'}}};
+    set.canonicalize();
+    REQUIRE(set.ranges == r({{'a', 'h'}, {'x', 'z'}}));
+}
+
+TEST_CASE("CodepointSet::contains")
+{
+    CodepointSet set;
+    set.add_range('a', 'f');
+    set.add_range('x', 'z');
+    set.add_codepoint(U'Ø');
+    REQUIRE(set.contains('a'));
+    REQUIRE(set.contains('f'));
+    REQUIRE(!set.contains('g'));
+    REQUIRE(set.contains('y'));
+    REQUIRE(set.contains(U'Ø'));
+    REQUIRE(!set.contains(U'ø'));
+    REQUIRE(set.case_insensitive_contains(U'ø'));
+    REQUIRE(set.case_insensitive_contains('Y'));
+    set.negated = true;
+    REQUIRE(!set.contains('a'));
+    REQUIRE(set.contains('g'));
+}
+
+TEST_CASE("CodepointSet::case_insensitive_contains with negated set")
+{
+    auto set = parse_codepoint_set("[^aØ]");
+    REQUIRE(!set.case_insensitive_contains('a'));
+    REQUIRE(!set.case_insensitive_contains('A'));
+    REQUIRE(!set.case_insensitive_contains(U'ø'));
+    REQUIRE(!set.case_insensitive_contains(U'Ø'));
+    REQUIRE(set.case_insensitive_contains('b'));
+    REQUIRE(set.case_insensitive_contains('B'));
+}
+
+TEST_CASE("CodepointSet set operations")
+{
+    CodepointSet a{{{'a', 'm'}}};
+    CodepointSet b{{{'f', 'z'}}};
+    REQUIRE(set_union(a, b).ranges == r({{'a', 'z'}}));
+    REQUIRE(set_intersection(a, b).ranges == r({{'f', 'm'}}));
+    REQUIRE(set_difference(a, b).ranges == r({{'a', 'e'}}));
+    REQUIRE(complement(a).ranges == r({{0, U'a' - 1}, {'n', UNICODE_MAX}}));
+
+    CodepointSet not_b{b.ranges, true};
+    REQUIRE(set_intersection(a, not_b).ranges == r({{'a', 'e'}}));
+    REQUIRE(complement(not_b).ranges == b.ranges);
+}
+
+TEST_CASE("make_codepoint_set from character classes")
+{
+    auto digits = make_codepoint_set(CharClass::DECIMAL_NUMBER);
+    REQUIRE(digits.contains('0'));
+    REQUIRE(digits.contains('9'));
+    REQUIRE(!digits.contains('a'));
+    REQUIRE(digits.contains(0x0660)); // ARABIC-INDIC DIGIT ZERO
+
+    auto upper = make_codepoint_set(CharClass::UPPERCASE_LETTER);
+    REQUIRE(upper.contains(0x1E0E));
+    REQUIRE(!upper.contains(0x1E0D));
+    REQUIRE(upper.contains(0xD6));
+    REQUIRE(!upper.contains(0xD7));
+
+    auto letters_and_marks = make_codepoint_set(CharClass::LETTER
+                                                | CharClass::MARK);
+    for (char32_t c = 0; c < 0x3000; ++c)
+    {
+        auto is_included = (get_char_class(c)
+                            & (CharClass::LETTER | CharClass::MARK)) != 0;
+        REQUIRE(letters_and_marks.contains(c) == is_included);
+    }
+}
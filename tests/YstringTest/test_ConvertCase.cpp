@@ -6,6 +6,7 @@
 // License text is included with the source distribution.
 //****************************************************************************
 #include "Ystring/ConvertCase.hpp"
+#include "Ystring/CodepointConstants.hpp"
 #include <catch2/catch_test_macros.hpp>
 
 using namespace ystring;
@@ -50,3 +51,188 @@ TEST_CASE("Test to_upper")
     REQUIRE(to_upper("AbCD æøå.") == "ABCD ÆØÅ.");
     REQUIRE(to_upper("Daß.") == "DASS.");
 }
+
+TEST_CASE("Test case conversion of long ASCII runs")
+{
+    std::string str = "The QUICK brown fOX jumps Over the lazy dog @[`{.";
+    REQUIRE(to_lower(str) == "the quick brown fox jumps over the lazy dog @[`{.");
+    REQUIRE(to_upper(str) == "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG @[`{.");
+    REQUIRE(to_title(str) == "The Quick Brown Fox Jumps Over The Lazy Dog @[`{.");
+}
+
+TEST_CASE("Test to_title with words spanning ASCII and non-ASCII")
+{
+    REQUIRE(to_title("abcdefgHIJK æble ÆBLEkake kakeÆBLE")
+            == "Abcdefghijk Æble Æblekake Kakeæble");
+    REQUIRE(to_title("1234567abcdefgh") == "1234567Abcdefgh");
+    REQUIRE(to_title("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa bbbb")
+            == "Aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa Bbbb");
+}
+
+TEST_CASE("Test case conversion into an existing string")
+{
+    std::string result = "> ";
+    REQUIRE(to_lower("ABC ÆØÅ", result) == "> abc æøå");
+    REQUIRE(to_upper(" daß", result) == "> abc æøå DASS");
+    REQUIRE(to_title(" ÆBLE", result) == "> abc æøå DASS Æble");
+}
+
+TEST_CASE("Test case conversion into a fixed buffer")
+{
+    char buffer[16];
+    auto size = to_upper("abc æøå ß", buffer);
+    REQUIRE(size == 13);
+    REQUIRE(std::string_view(buffer, size) == "ABC ÆØÅ SS");
+    REQUIRE(to_title("ßabcdefghijklmnop ßq", std::span<char>(buffer, 4)) == 22);
+    REQUIRE(to_lower("", buffer) == 0);
+}
+
+TEST_CASE("Test in-place case conversion")
+{
+    std::string str = "The QUICK brown ÆØÅ fox.";
+    auto* data = str.data();
+    REQUIRE(to_lower_in_place(str) == "the quick brown æøå fox.");
+    REQUIRE(str.data() == data);
+    REQUIRE(to_upper_in_place(str) == "THE QUICK BROWN ÆØÅ FOX.");
+    REQUIRE(to_title_in_place(str) == "The Quick Brown Æøå Fox.");
+    REQUIRE(str.data() == data);
+
+    str = "abcdefgh ß abcdefgh";
+    REQUIRE(to_upper_in_place(str) == "ABCDEFGH SS ABCDEFGH");
+    str = "abc ßx";
+    REQUIRE(to_title_in_place(str) == "Abc Ssx");
+    str = "aBC\xFF";
+    REQUIRE_THROWS(to_lower_in_place(str));
+}
+
+TEST_CASE("Test case conversion of two- and three-byte sequences")
+{
+    REQUIRE(to_upper("Съешь же ещё этих булочек") == "СЪЕШЬ ЖЕ ЕЩЁ ЭТИХ БУЛОЧЕК");
+    REQUIRE(to_lower("ΞΕΣΚΕΠΑΖΩ ΤΗΝ ΨΥΧΟΦΘΟΡΑ") == "ξεσκεπαζω την ψυχοφθορα");
+    REQUIRE(to_upper("ⓐⓑⓒ ǆ") == "ⒶⒷⒸ Ǆ");
+    REQUIRE(to_lower("ǅ") == "ǆ");
+}
+
+TEST_CASE("Test case conversion where the length changes")
+{
+    // KELVIN SIGN and ANGSTROM SIGN have lower case forms with fewer
+    // bytes, LATIN CAPITAL LETTER I WITH DOT ABOVE has a lower case form
+    // with a combining dot and more bytes.
+    std::string str = "KÅ İx";
+    REQUIRE(to_lower(str) == "kå i̇x");
+    REQUIRE(to_lower_in_place(str) == "kå i̇x");
+    // LATIN SMALL LETTER TURNED A has an upper case form with more bytes.
+    REQUIRE(to_upper("ɐbc") == "ⱯBC");
+}
+
+TEST_CASE("Test case conversion with SpecialCasing")
+{
+    REQUIRE(to_upper("ﬁne ŉ ǰ ΐ") == "FINE ʼN J̌ Ϊ́");
+    REQUIRE(to_upper("ᾳ ᾷ") == "ΑΙ Α͂Ι");
+    REQUIRE(to_upper("և") == "ԵՒ");
+    REQUIRE(to_title("ﬁne ﬀ ŉ ᾳ") == "Fine Ff ʼN ᾼ");
+    REQUIRE(to_title("ǆ") == "ǅ");
+    REQUIRE(to_lower("İ ᾼ") == "i̇ ᾳ");
+    REQUIRE(to_upper(U'ß') == U'ß');
+}
+
+TEST_CASE("Test sizes of case-converted strings")
+{
+    REQUIRE(get_upper_case_size("abc") == 3);
+    REQUIRE(get_upper_case_size("") == 0);
+    REQUIRE(get_upper_case_size("ßabcdefghijklmnopq ﬃ ΐ") == to_upper("ßabcdefghijklmnopq ﬃ ΐ").size());
+    REQUIRE(get_lower_case_size("KÅ İ") == to_lower("KÅ İ").size());
+    REQUIRE(get_title_case_size("ßß ﬁ aß") == to_title("ßß ﬁ aß").size());
+    REQUIRE(get_case_folded_size("Straße ﬃ") == fold_case("Straße ﬃ").size());
+    REQUIRE_THROWS(get_upper_case_size("ab\xFF"));
+
+    std::string result;
+    to_upper("ßßßßßßßßßßßßßßßß", result);
+    REQUIRE(result == "SSSSSSSSSSSSSSSSSSSSSSSSSSSSSSSS");
+}
+
+TEST_CASE("Test fold_case of code points")
+{
+    REQUIRE(fold_case(U'A') == U'a');
+    REQUIRE(fold_case(U'a') == U'a');
+    REQUIRE(fold_case(U'Σ') == U'σ');
+    REQUIRE(fold_case(U'ς') == U'σ');
+    REQUIRE(fold_case(U'ẞ') == U'ß');
+    REQUIRE(fold_case(U'K') == U'k');
+    REQUIRE(fold_case(U'ß') == U'ß');
+    // Case pairs added in Unicode 15 and 16.
+    REQUIRE(fold_case(U'\u1C89') == U'\u1C8A');
+    REQUIRE(fold_case(U'\uA7DC') == U'\u019B');
+    REQUIRE(fold_case(U'\U00010D50') == U'\U00010D70');
+    REQUIRE(fold_case("\u1C89") == fold_case("\u1C8A"));
+}
+
+TEST_CASE("Test that fold_case agrees with the case conversions")
+{
+    for (char32_t c = 0; c <= UNICODE_MAX; ++c)
+    {
+        // The dotted and dotless i are only case pairs with the Turkic
+        // foldings, which fold_case doesn't use.
+        if (c == U'İ' || c == U'ı')
+            continue;
+        auto folded = fold_case(c);
+        if (fold_case(to_upper(c)) != folded
+            || fold_case(to_lower(c)) != folded)
+        {
+            FAIL("Code point " << uint32_t(c));
+        }
+    }
+}
+
+TEST_CASE("Test fold_case of strings")
+{
+    REQUIRE(fold_case("Straße STRASSE") == "strasse strasse");
+    REQUIRE(fold_case("ẞ") == "ss");
+    REQUIRE(fold_case("ΣΑΣ σας") == "σασ σασ");
+    REQUIRE(fold_case("ﬃ") == "ffi");
+    REQUIRE(fold_case("ΐ") == "ΐ");
+    REQUIRE(fold_case("KÅ") == "kå");
+    REQUIRE(fold_case("İ") == "i̇");
+    REQUIRE(fold_case("") == "");
+    REQUIRE_THROWS(fold_case("ab\xFF"));
+}
+
+TEST_CASE("Test fold_case into a buffer, a string and in place")
+{
+    std::string result = "x";
+    REQUIRE(fold_case("ABC ß", result) == "xabc ss");
+
+    char buffer[8];
+    REQUIRE(fold_case("ABC ß", std::span(buffer)) == 6);
+    REQUIRE(std::string_view(buffer, 6) == "abc ss");
+    REQUIRE(fold_case("ABCDEFGH", std::span(buffer, 4)) == 8);
+
+    std::string str = "The Quick Brown ÆØÅ Fox.";
+    auto data = str.data();
+    REQUIRE(fold_case_in_place(str) == "the quick brown æøå fox.");
+    REQUIRE(str.data() == data);
+    str = "abcdefgh ﬃ ABCDEFGH";
+    REQUIRE(fold_case_in_place(str) == "abcdefgh ffi abcdefgh");
+}
+
+TEST_CASE("Test compare_folded and equal_folded")
+{
+    auto folded = fold_case("Straße");
+    REQUIRE(equal_folded(folded, "STRASSE"));
+    REQUIRE(equal_folded(folded, "strasse"));
+    REQUIRE(!equal_folded(folded, "STRASS"));
+    REQUIRE(!equal_folded(folded, "STRASSEN"));
+    REQUIRE(compare_folded(folded, "STRASS") > 0);
+    REQUIRE(compare_folded(folded, "STRASSEN") < 0);
+    REQUIRE(compare_folded(folded, "STRASSF") < 0);
+    REQUIRE(compare_folded(folded, "STRASSD") > 0);
+    REQUIRE(compare_folded("", "") == 0);
+
+    std::string long_str;
+    for (int i = 0; i < 100; ++i)
+        long_str += "ABCß ÆØÅ ";
+    auto long_folded = fold_case(long_str);
+    REQUIRE(equal_folded(long_folded, long_str));
+    REQUIRE(!equal_folded(long_folded, long_str + "x"));
+    REQUIRE_THROWS(equal_folded("ab", "AB\xFF"));
+}
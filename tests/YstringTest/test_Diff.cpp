@@ -0,0 +1,133 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Diff.hpp"
+#include "Ystring/YstringException.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace ystring;
+
+namespace
+{
+    DiffChunk keep(size_t old_offset, size_t new_offset, size_t length)
+    {
+        return {DiffOp::KEEP, {old_offset, length}, {new_offset, length}};
+    }
+
+    DiffChunk remove(size_t old_offset, size_t length, size_t new_offset)
+    {
+        return {DiffOp::REMOVE, {old_offset, length}, {new_offset, 0}};
+    }
+
+    DiffChunk insert(size_t old_offset, size_t new_offset, size_t length)
+    {
+        return {DiffOp::INSERT, {old_offset, 0}, {new_offset, length}};
+    }
+
+    std::string apply(std::string_view old_str, std::string_view new_str,
+                      const std::vector<DiffChunk>& chunks)
+    {
+        std::string result;
+        for (auto& chunk : chunks)
+        {
+            if (chunk.op == DiffOp::KEEP)
+                result += old_str.substr(chunk.old_range.offset,
+                                         chunk.old_range.length);
+            else if (chunk.op == DiffOp::INSERT)
+                result += new_str.substr(chunk.new_range.offset,
+                                         chunk.new_range.length);
+        }
+        return result;
+    }
+}
+
+TEST_CASE("Test diff of code points")
+{
+    auto chunks = diff("abcabba", "cbabac");
+    REQUIRE(apply("abcabba", "cbabac", chunks) == "cbabac");
+    size_t edits = 0;
+    for (auto& chunk : chunks)
+    {
+        if (chunk.op != DiffOp::KEEP)
+            edits += chunk.old_range.length + chunk.new_range.length;
+    }
+    REQUIRE(edits == 5);
+    REQUIRE(diff("abc", "abc") == std::vector<DiffChunk>{keep(0, 0, 3)});
+    REQUIRE(diff("", "abc") == std::vector<DiffChunk>{insert(0, 0, 3)});
+    REQUIRE(diff("abc", "") == std::vector<DiffChunk>{remove(0, 3, 0)});
+    REQUIRE(diff("", "").empty());
+}
+
+TEST_CASE("Test diff with multi-byte code points")
+{
+    // U+00E6 and U+00E5 have the same first byte.
+    auto a = U8("xæy");
+    auto b = U8("xåy");
+    REQUIRE(diff(a, b)
+            == std::vector<DiffChunk>{keep(0, 0, 1), remove(1, 2, 1),
+                                      insert(3, 1, 2), keep(3, 3, 1)});
+    REQUIRE_THROWS_AS(diff("abc\xFF", "abd"), YstringException);
+}
+
+TEST_CASE("Test diff of characters")
+{
+    auto a = U8("xéy");
+    auto b = U8("xey");
+    REQUIRE(diff(a, b)
+            == std::vector<DiffChunk>{keep(0, 0, 2), remove(2, 2, 2),
+                                      keep(4, 2, 1)});
+    REQUIRE(diff(a, b, {DiffUnit::CHARS})
+            == std::vector<DiffChunk>{keep(0, 0, 1), remove(1, 3, 1),
+                                      insert(4, 1, 1), keep(4, 2, 1)});
+}
+
+TEST_CASE("Test diff of lines")
+{
+    std::string a = "one\ntwo\r\nthree\nfour";
+    std::string b = "one\ntwo\nthree\nfive\nfour";
+    auto chunks = diff(a, b, {DiffUnit::LINES});
+    REQUIRE(chunks
+            == std::vector<DiffChunk>{keep(0, 0, 4), remove(4, 5, 4),
+                                      insert(9, 4, 4), keep(9, 8, 6),
+                                      insert(15, 14, 5), keep(15, 19, 4)});
+    REQUIRE(apply(a, b, chunks) == b);
+}
+
+TEST_CASE("Test diff appends to the caller's buffer")
+{
+    std::vector<DiffChunk> chunks{keep(0, 0, 1)};
+    REQUIRE(diff("abc", "abd", chunks) == 3);
+    REQUIRE(chunks.size() == 4);
+    REQUIRE(chunks[1] == keep(0, 0, 2));
+}
+
+TEST_CASE("Test diff of long strings")
+{
+    std::string a, b;
+    for (int i = 0; i < 2000; ++i)
+    {
+        auto line = "line " + std::to_string(i) + "\n";
+        a += line;
+        if (i % 100 != 50)
+            b += line;
+        if (i % 300 == 7)
+            b += "new\n";
+    }
+    auto chunks = diff(a, b, {DiffUnit::LINES});
+    REQUIRE(apply(a, b, chunks) == b);
+    size_t removed = 0, inserted = 0;
+    for (auto& chunk : chunks)
+    {
+        if (chunk.op == DiffOp::REMOVE)
+            ++removed;
+        else if (chunk.op == DiffOp::INSERT)
+            ++inserted;
+    }
+    REQUIRE(removed == 20);
+    REQUIRE(inserted == 7);
+}
@@ -0,0 +1,95 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/EditDistance.hpp"
+#include "Ystring/YstringException.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace ystring;
+
+TEST_CASE("Test edit_distance")
+{
+    REQUIRE(edit_distance("kitten", "sitting") == 3);
+    REQUIRE(edit_distance("sitting", "kitten") == 3);
+    REQUIRE(edit_distance("", "abc") == 3);
+    REQUIRE(edit_distance("abc", "") == 3);
+    REQUIRE(edit_distance("", "") == 0);
+    REQUIRE(edit_distance("flaw", "lawn") == 2);
+    REQUIRE(edit_distance(U8("blåbær"), U8("blabær")) == 1);
+    REQUIRE(edit_distance(U8("≠æ"), "ae") == 2);
+    REQUIRE_THROWS_AS(edit_distance("abc\xFF", U8("æ")), YstringException);
+}
+
+TEST_CASE("Test edit_distance with long strings")
+{
+    std::string a, b;
+    for (int i = 0; i < 300; ++i)
+    {
+        a += char('a' + i % 7);
+        b += char('a' + i % 7);
+    }
+    REQUIRE(edit_distance(a, b) == 0);
+    b[10] = 'x';
+    b.erase(100, 1);
+    b.insert(250, "yy");
+    REQUIRE(edit_distance(a, b) == 4);
+    REQUIRE(edit_distance(a, "") == 300);
+    REQUIRE(edit_distance(a + U8("æ"), b + U8("ø")) == 5);
+}
+
+TEST_CASE("Test case-insensitive edit_distance")
+{
+    EditDistanceParams params{true, false};
+    REQUIRE(edit_distance(U8("ÆBLE"), U8("æble"), params) == 0);
+    REQUIRE(edit_distance("Kitten", "SITTING", params) == 3);
+    REQUIRE(edit_distance(U8("ÆBLE"), U8("æble")) == 4);
+}
+
+TEST_CASE("Test case-insensitive edit_distance with code points that fold to ASCII")
+{
+    // LATIN SMALL LETTER LONG S folds to S.
+    EditDistanceParams params{true, false};
+    REQUIRE(edit_distance(U8("sé"), U8("ſé"), params) == 0);
+    REQUIRE(edit_distance(U8("ſé"), U8("Sé"), params) == 0);
+    REQUIRE(edit_distance(U8("ſſé"), U8("sxé"), params) == 1);
+    REQUIRE(edit_distance(U8("sé"), U8("ſé")) == 1);
+    REQUIRE(find_approximate(U8("xxſéxx"), U8("Sé"), 0, params)
+            == Subrange(2, 4));
+}
+
+TEST_CASE("Test edit_distance with characters")
+{
+    auto a = U8("xéy");
+    REQUIRE(edit_distance(a, "xey") == 1);
+    REQUIRE(edit_distance(a, "xy") == 2);
+    REQUIRE(edit_distance(a, "xey", {false, true}) == 1);
+    REQUIRE(edit_distance(a, "xy", {false, true}) == 1);
+    REQUIRE(edit_distance(a, U8("XÉY"), {true, true}) == 0);
+}
+
+TEST_CASE("Test bounded_edit_distance")
+{
+    REQUIRE(bounded_edit_distance("kitten", "sitting", 3) == 3);
+    REQUIRE(bounded_edit_distance("kitten", "sitting", 2) > 2);
+    REQUIRE(bounded_edit_distance(std::string(1000, 'a'), "b", 5) > 5);
+    REQUIRE(bounded_edit_distance("", "abcdef", 2) > 2);
+}
+
+TEST_CASE("Test find_approximate")
+{
+    REQUIRE(find_approximate("the quick brown fox", "quck", 1)
+            == Subrange(4, 5));
+    REQUIRE(find_approximate("the quick brown fox", "brwn", 1)
+            == Subrange(10, 5));
+    REQUIRE(find_approximate("the quick brown fox", "brwn", 0).offset
+            == std::string_view::npos);
+    REQUIRE(find_approximate(U8("røde bær"), U8("bar"), 1) == Subrange(6, 4));
+    REQUIRE(find_approximate(U8("RØDE BÆR"), U8("bær"), 0, {true, false})
+            == Subrange(6, 4));
+    REQUIRE(find_approximate("abc", "xy", 2) == Subrange(0, 0));
+}
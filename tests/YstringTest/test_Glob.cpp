@@ -0,0 +1,126 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Glob.hpp"
+#include "Ystring/YstringException.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace ystring;
+
+TEST_CASE("Glob without wildcards")
+{
+    REQUIRE(match_glob("abc", "abc"));
+    REQUIRE(!match_glob("abcd", "abc"));
+    REQUIRE(!match_glob("ab", "abc"));
+    REQUIRE(match_glob("", ""));
+    REQUIRE(!match_glob("a", ""));
+}
+
+TEST_CASE("Glob with *")
+{
+    Glob glob("*.txt");
+    REQUIRE(glob("a.txt"));
+    REQUIRE(glob(".txt"));
+    REQUIRE(!glob("a.txt.bak"));
+    REQUIRE(match_glob("abc", "*"));
+    REQUIRE(match_glob("", "*"));
+    REQUIRE(match_glob("abcabd", "a*b*d"));
+    REQUIRE(match_glob("abcabd", "*ab*"));
+    REQUIRE(!match_glob("abcabc", "a*b*d"));
+    REQUIRE(match_glob("aaa", "a*a"));
+    REQUIRE(!match_glob("a", "a*a"));
+    REQUIRE(match_glob("src/lib/x.cpp", "src/**/*.cpp"));
+}
+
+TEST_CASE("Glob with ?")
+{
+    REQUIRE(match_glob(U8("aøc"), "a?c"));
+    REQUIRE(!match_glob("ac", "a?c"));
+    REQUIRE(match_glob(U8("≠b≠"), "?*?"));
+    REQUIRE(match_glob(U8("xxaøcyy"), "*a?c*"));
+}
+
+TEST_CASE("Glob with sets")
+{
+    REQUIRE(match_glob("file7.txt", "file[0-9].txt"));
+    REQUIRE(!match_glob("fileA.txt", "file[0-9].txt"));
+    REQUIRE(match_glob("fileA.txt", "file[^0-9].txt"));
+    REQUIRE(match_glob(U8("x-æ-y"), U8("*-[a-zæøå]-*")));
+    REQUIRE(match_glob("a]b", "a[\\]]b"));
+    REQUIRE_THROWS_AS(Glob("a[b"), YstringException);
+    REQUIRE_THROWS_AS(Glob("a[z-a]"), YstringException);
+}
+
+TEST_CASE("Glob with escaped wildcards")
+{
+    REQUIRE(match_glob("a*b", "a\\*b"));
+    REQUIRE(!match_glob("axb", "a\\*b"));
+    REQUIRE(match_glob("a?", "*\\?"));
+    REQUIRE_THROWS_AS(Glob("ab\\"), YstringException);
+}
+
+TEST_CASE("Case-insensitive Glob")
+{
+    GlobParams params{true, false};
+    REQUIRE(match_glob(U8("ÆBLE.TXT"), U8("æble.*"), params));
+    REQUIRE(match_glob(U8("XÆBLEX.TXT"), U8("*æble*.t?t"), params));
+    REQUIRE(match_glob("Q", "[a-z]", params));
+    REQUIRE(!match_glob(U8("ÆBLE.TXT"), U8("æble.*")));
+}
+
+TEST_CASE("Case-insensitive Glob with negated set")
+{
+    GlobParams params{true, false};
+    REQUIRE(!match_glob("a", "[^a]", params));
+    REQUIRE(!match_glob("A", "[^a]", params));
+    REQUIRE(match_glob("b", "[^a]", params));
+    REQUIRE(!match_glob(U8("xØ"), U8("*[^ø]"), params));
+    REQUIRE(match_glob(U8("Øx"), U8("*[^ø]"), params));
+}
+
+TEST_CASE("Glob with character semantics")
+{
+    auto s = U8("xe\u0301y");
+    REQUIRE(!match_glob(s, "x?y"));
+    REQUIRE(match_glob(s, "x?y", {false, true}));
+    REQUIRE(match_glob(s, "x[e]y", {false, true}));
+    REQUIRE(match_glob(s, U8("*e\u0301?"), {false, true}));
+    REQUIRE(match_glob(s, U8("x*E\u0301*"), {true, true}));
+    REQUIRE(!match_glob(s, "xe*", {false, true}));
+}
+
+TEST_CASE("Glob with long segments")
+{
+    std::string pattern = "*";
+    std::string str(10000, 'a');
+    for (int i = 0; i < 70; ++i)
+        pattern += "a?";
+    REQUIRE(!match_glob(str, pattern + "b"));
+    REQUIRE(match_glob(str + "ab", pattern + "b"));
+    REQUIRE(!match_glob(str, "*a*a*a*a*a*a*a*a*b"));
+    REQUIRE(match_glob(str, "*a[a-c]a*a?a*"));
+}
+
+TEST_CASE("Glob with segments of more than 64 elements")
+{
+    // Middle segments are searched for, with 2 and 3 words of state.
+    for (int n : {70, 150})
+    {
+        std::string segment;
+        for (int i = 0; i < n; ++i)
+            segment += i % 2 == 0 ? "a" : "?";
+        std::string str = "x" + std::string(1000, 'a') + "b";
+        REQUIRE(!match_glob(str, "x*" + segment + "[b-c]*b"));
+        REQUIRE(match_glob(str, "x*" + segment + "*b"));
+        REQUIRE(match_glob(U8("xø") + str, "x*" + segment + "*b"));
+        REQUIRE(!match_glob(std::string(size_t(n - 1), 'a'),
+                            "*" + segment + "*"));
+        REQUIRE(match_glob(U8("Ø") + std::string(size_t(n), 'A'),
+                           "*" + segment + "*", {true, false}));
+    }
+}
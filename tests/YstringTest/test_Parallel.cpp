@@ -0,0 +1,98 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Algorithms.hpp"
+#include "Ystring/Parallel.hpp"
+#include "Ystring/YstringException.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace ystring;
+
+namespace
+{
+    constexpr ParallelParams SMALL_CHUNKS = {4, 7};
+
+    std::string repeat(std::string_view str, size_t n)
+    {
+        std::string result;
+        for (size_t i = 0; i < n; ++i)
+            result += str;
+        return result;
+    }
+}
+
+TEST_CASE("parallel::find_all")
+{
+    auto s = repeat(U8("abcæøå-"), 20);
+    REQUIRE(parallel::find_all(s, U8("øå-a"), SMALL_CHUNKS)
+            == find_all(s, U8("øå-a")));
+
+    for (size_t i = 1; i < 40; ++i)
+    {
+        std::string a(i, 'a');
+        REQUIRE(parallel::find_all(a, "aa", {4, 1}) == find_all(a, "aa"));
+        REQUIRE(parallel::find_all(a, "aaa", {3, 2}) == find_all(a, "aaa"));
+    }
+
+    auto t = repeat("abababababc", 5);
+    REQUIRE(parallel::find_all(t, "abab", {8, 3}) == find_all(t, "abab"));
+    REQUIRE(parallel::find_all(t, "", SMALL_CHUNKS).empty());
+}
+
+TEST_CASE("parallel::find_first")
+{
+    auto s = repeat(U8("abcæøå-"), 20) + "xyz";
+    REQUIRE(parallel::find_first(s, "xyz", SMALL_CHUNKS) == find_first(s, "xyz"));
+    REQUIRE(parallel::find_first(s, U8("å-"), SMALL_CHUNKS) == Subrange(7, 3));
+    REQUIRE(parallel::find_first(s, "xyzw", SMALL_CHUNKS) == find_first(s, "xyzw"));
+    for (size_t i = 0; i < 20; ++i)
+    {
+        std::string a(30, 'a');
+        a.insert(i, "bc");
+        REQUIRE(parallel::find_first(a, "bc", {5, 3}) == Subrange(i, 2));
+    }
+}
+
+TEST_CASE("parallel::find_first_of")
+{
+    auto s = repeat(U8("abcæøå-"), 20) + U8("≠");
+    std::u32string chars = U"≠";
+    REQUIRE(parallel::find_first_of(s, chars, SMALL_CHUNKS)
+            == find_first_of(s, chars));
+
+    CodepointSet set;
+    set.add_codepoint(U'≠');
+    set.add_range(0x2000, 0x2FFF);
+    REQUIRE(parallel::find_first_of(s, set, SMALL_CHUNKS)
+            == find_first_of(s, set));
+    REQUIRE(!parallel::find_first_of(s, CodepointSet(), SMALL_CHUNKS).first);
+}
+
+TEST_CASE("parallel::find_first_of with invalid UTF-8")
+{
+    CodepointSet set;
+    set.add_codepoint('x');
+    auto s = repeat("abc", 10) + "x" + repeat("abc", 10) + "\xFF" + repeat("abc", 10);
+    REQUIRE(parallel::find_first_of(s, set, SMALL_CHUNKS).first == Subrange(30, 1));
+    s[30] = 'a';
+    REQUIRE_THROWS_AS(parallel::find_first_of(s, set, SMALL_CHUNKS), YstringException);
+}
+
+TEST_CASE("parallel::is_valid_utf8")
+{
+    auto s = repeat(U8("abcæøå-≠"), 20);
+    REQUIRE(parallel::is_valid_utf8(s, SMALL_CHUNKS));
+    for (size_t i : {0, 5, 31, 100, 159})
+    {
+        auto t = s;
+        t[i] = '\x80';
+        REQUIRE(!parallel::is_valid_utf8(t, SMALL_CHUNKS));
+    }
+    REQUIRE(!parallel::is_valid_utf8(s + "\xE2\x89", SMALL_CHUNKS));
+    REQUIRE(!parallel::is_valid_utf8(repeat("\x80", 40), SMALL_CHUNKS));
+}
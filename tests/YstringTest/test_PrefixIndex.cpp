@@ -0,0 +1,98 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/PrefixIndex.hpp"
+#include "Ystring/YstringException.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace ystring;
+
+namespace
+{
+    std::vector<size_t> to_vector(std::span<const size_t> keys)
+    {
+        return {keys.begin(), keys.end()};
+    }
+}
+
+TEST_CASE("Test PrefixIndex::find_keys")
+{
+    std::vector<std::string> keys{"car", "cart", "care", "cat", "dog", "ca",
+                                  "cart"};
+    PrefixIndex index(keys);
+    REQUIRE(index.size() == 7);
+    REQUIRE(to_vector(index.find_keys("car"))
+            == std::vector<size_t>{0, 2, 1, 6});
+    REQUIRE(to_vector(index.find_keys("ca"))
+            == std::vector<size_t>{5, 0, 2, 1, 6, 3});
+    REQUIRE(to_vector(index.find_keys("cart")) == std::vector<size_t>{1, 6});
+    REQUIRE(to_vector(index.find_keys("d")) == std::vector<size_t>{4});
+    REQUIRE(index.find_keys("").size() == 7);
+    REQUIRE(index.find_keys("carts").empty());
+    REQUIRE(index.find_keys("b").empty());
+    REQUIRE(index.find_keys("CAR").empty());
+}
+
+TEST_CASE("Test case-insensitive PrefixIndex::find_keys")
+{
+    std::vector<std::string_view> keys{U8("Ærfugl"), U8("ærlig"), "Apple",
+                                       U8("ÆRE")};
+    PrefixIndex index(keys, {true});
+    REQUIRE(to_vector(index.find_keys(U8("ær")))
+            == std::vector<size_t>{3, 0, 1});
+    REQUIRE(to_vector(index.find_keys(U8("ÆrF"))) == std::vector<size_t>{0});
+    REQUIRE(to_vector(index.find_keys("aPP")) == std::vector<size_t>{2});
+    REQUIRE(index.find_keys("x").empty());
+    REQUIRE_THROWS_AS(index.find_keys("a\xFF"), YstringException);
+}
+
+TEST_CASE("Test PrefixIndex::find_longest_prefix")
+{
+    std::vector<std::string_view> keys{"/", "/usr", "/usr/lib", "/usr/local",
+                                       "/USR"};
+    PrefixIndex index(keys);
+    REQUIRE(index.find_longest_prefix("/usr/lib/x") == PrefixMatch{2, 8});
+    REQUIRE(index.find_longest_prefix("/usr/li") == PrefixMatch{1, 4});
+    REQUIRE(index.find_longest_prefix("/etc") == PrefixMatch{0, 1});
+    REQUIRE(!index.find_longest_prefix("usr"));
+
+    PrefixIndex ci_index(keys, {true});
+    REQUIRE(ci_index.find_longest_prefix("/USR/bin") == PrefixMatch{1, 4});
+    REQUIRE(ci_index.find_longest_prefix("/Usr/LOCAL") == PrefixMatch{3, 10});
+}
+
+TEST_CASE("Test PrefixIndex::find_longest_prefix with multi-byte code points")
+{
+    std::vector<std::string_view> keys{U8("blå"), U8("BLÅBÆR"), ""};
+    PrefixIndex index(keys, {true});
+    REQUIRE(index.find_longest_prefix(U8("Blåbærsyltetøy"))
+            == PrefixMatch{1, 8});
+    REQUIRE(index.find_longest_prefix(U8("BLÅBÆ")) == PrefixMatch{0, 4});
+    REQUIRE(index.find_longest_prefix("bla") == PrefixMatch{2, 0});
+}
+
+TEST_CASE("Test PrefixIndex::find_prefixes")
+{
+    std::vector<std::string_view> keys{"ab", "a", "abcd", "abc", "b", "ab"};
+    PrefixIndex index(keys);
+    std::vector<PrefixMatch> matches{{9, 9}};
+    REQUIRE(index.find_prefixes("abcx", matches) == 4);
+    REQUIRE(matches == std::vector<PrefixMatch>{{9, 9}, {1, 1}, {0, 2},
+                                                {5, 2}, {3, 3}});
+    matches.clear();
+    REQUIRE(index.find_prefixes("x", matches) == 0);
+}
+
+TEST_CASE("Test empty PrefixIndex")
+{
+    PrefixIndex index;
+    REQUIRE(index.empty());
+    REQUIRE(index.find_keys("").empty());
+    REQUIRE(index.find_keys("a").empty());
+    REQUIRE(!index.find_longest_prefix("a"));
+}
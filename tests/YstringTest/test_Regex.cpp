@@ -0,0 +1,149 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Regex.hpp"
+#include "Ystring/YstringException.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace ystring;
+
+namespace
+{
+    template <typename T>
+    concept ConstSearchable = requires(const T& re, std::string_view str)
+    {
+        re.match(str);
+        re.find_first(str);
+        re.find_all(str);
+    };
+
+    // The searches update the Regex's DFA cache.
+    static_assert(!ConstSearchable<Regex>);
+}
+
+TEST_CASE("Regex with literals")
+{
+    Regex re(U8("æøå"));
+    REQUIRE(re.match(U8("æøå")));
+    REQUIRE(!re.match(U8("æøåx")));
+    REQUIRE(re.find_first(U8("xxæøå")) == Subrange(2, 6));
+    REQUIRE(re.find_first(U8("xxæøå"), 3).offset == std::string_view::npos);
+    REQUIRE(Regex("a\\.b\\*").match("a.b*"));
+    REQUIRE(Regex("\\x41\\x{2260}").match(U8("A≠")));
+}
+
+TEST_CASE("Regex with classes")
+{
+    REQUIRE(Regex("[a-c]+").find_first("xxabcay") == Subrange(2, 4));
+    REQUIRE(Regex("[^a-c]").find_first("abcd") == Subrange(3, 1));
+    REQUIRE(Regex(".").find_first(U8("\n≠")) == Subrange(1, 3));
+    REQUIRE(Regex("\\d+").find_first(U8("ab١٢3c")) == Subrange(2, 5));
+    REQUIRE(Regex("\\w+").find_first(U8(" æ_1é ")) == Subrange(1, 6));
+    REQUIRE(Regex("\\s+").find_first(U8("a \t b")) == Subrange(1, 5));
+    REQUIRE(Regex("\\S+").find_first(" ab ") == Subrange(1, 2));
+}
+
+TEST_CASE("Regex with Unicode categories")
+{
+    Regex re("\\p{Lu}\\p{Ll}+");
+    REQUIRE(re.find_first(U8("xx Ærlig ")) == Subrange(3, 6));
+    REQUIRE(Regex("\\pN+").find_first(U8("x½2")) == Subrange(1, 3));
+    REQUIRE(Regex("\\P{L}+").find_first(U8("ab12cd")) == Subrange(2, 2));
+    REQUIRE_THROWS_AS(Regex("\\p{Xy}"), YstringException);
+}
+
+TEST_CASE("Regex with alternation")
+{
+    Regex re("abcd|bc|c");
+    REQUIRE(re.find_first("xabcd") == Subrange(1, 4));
+    REQUIRE(re.find_first("xabc") == Subrange(2, 2));
+    REQUIRE(Regex("a|ab").find_first("ab") == Subrange(0, 1));
+    REQUIRE(Regex("ab|a").find_first("ab") == Subrange(0, 2));
+    REQUIRE(Regex("(?:x|y)z").match("yz"));
+    REQUIRE(Regex("a|").find_first("b") == Subrange(0, 0));
+}
+
+TEST_CASE("Regex with repetition")
+{
+    REQUIRE(Regex("a*").find_first("baaa") == Subrange(0, 0));
+    REQUIRE(Regex("a+").find_first("baaa") == Subrange(1, 3));
+    REQUIRE(Regex("a+?").find_first("baaa") == Subrange(1, 1));
+    REQUIRE(Regex("a.*b").find_first("xaxbxbx") == Subrange(1, 5));
+    REQUIRE(Regex("a.*?b").find_first("xaxbxbx") == Subrange(1, 3));
+    REQUIRE(Regex("(ab){2}").find_first("abababab") == Subrange(0, 4));
+    REQUIRE(Regex("a{2,3}").find_first("aaaa") == Subrange(0, 3));
+    REQUIRE(Regex("a{2,3}?").find_first("aaaa") == Subrange(0, 2));
+    REQUIRE(Regex("x(a{2,})").find_first("xaaaaay") == Subrange(0, 6));
+    REQUIRE(Regex(U8("ø?å")).match(U8("å")));
+    REQUIRE_THROWS_AS(Regex("*a"), YstringException);
+    REQUIRE_THROWS_AS(Regex("a{3,2}"), YstringException);
+    REQUIRE_THROWS_AS(Regex("a{1001}"), YstringException);
+}
+
+TEST_CASE("Regex with repetitions of empty matches")
+{
+    REQUIRE(Regex("(?:^|[ab])*").find_first("abb") == Subrange(0, 3));
+    REQUIRE(Regex("(?:|a)*").find_first("aa") == Subrange(0, 2));
+    REQUIRE(Regex("(?:a?)*b").find_first("aab") == Subrange(0, 3));
+    REQUIRE(Regex("(?:a*?)*").find_first("aa") == Subrange(0, 1));
+}
+
+TEST_CASE("Regex with anchors")
+{
+    REQUIRE(Regex("^ab").find_first("abab") == Subrange(0, 2));
+    REQUIRE(Regex("^ab").find_first("abab", 1).offset == std::string_view::npos);
+    REQUIRE(Regex("ab$").find_first("abab") == Subrange(2, 2));
+    REQUIRE(Regex("^$").match(""));
+    REQUIRE(Regex("^$").find_first("").offset == 0);
+    REQUIRE(Regex("a$|b").find_first("ab") == Subrange(1, 1));
+    REQUIRE(!Regex("a^b").match("ab"));
+}
+
+TEST_CASE("Case-insensitive Regex")
+{
+    RegexParams params{true};
+    REQUIRE(Regex(U8("æble"), params).find_first(U8("xÆBLE")) == Subrange(1, 5));
+    REQUIRE(Regex("[a-c]+", params).find_first("xAbC") == Subrange(1, 3));
+    REQUIRE(Regex("[^a-c]", params).find_first("AbCd") == Subrange(3, 1));
+    REQUIRE(!Regex(U8("æble")).match(U8("ÆBLE")));
+}
+
+TEST_CASE("Regex find_all")
+{
+    Regex re("\\d+");
+    REQUIRE(re.find_all("a1b22c333")
+            == std::vector<Subrange>{{1, 1}, {3, 2}, {6, 3}});
+    REQUIRE(Regex("a*").find_all(U8("baæ"))
+            == std::vector<Subrange>{{0, 0}, {1, 1}, {2, 0}, {4, 0}});
+}
+
+TEST_CASE("Regex with invalid patterns")
+{
+    REQUIRE_THROWS_AS(Regex("(ab"), YstringException);
+    REQUIRE_THROWS_AS(Regex("ab)"), YstringException);
+    REQUIRE_THROWS_AS(Regex("[ab"), YstringException);
+    REQUIRE_THROWS_AS(Regex("ab\\"), YstringException);
+    REQUIRE_THROWS_AS(Regex("\\q"), YstringException);
+}
+
+TEST_CASE("Regex does not match invalid UTF-8")
+{
+    REQUIRE(!Regex(".").match("\xFF"));
+    REQUIRE(Regex(".+").find_first("ab\xC3" "cd") == Subrange(0, 2));
+}
+
+TEST_CASE("Regex with adversarial input")
+{
+    std::string str(100000, 'a');
+    REQUIRE(!Regex("(a|aa)*b").match(str));
+    REQUIRE(Regex("(a|aa)*").match(str));
+    REQUIRE(Regex("(a*)*b").find_first(str).offset == std::string_view::npos);
+    REQUIRE(Regex("a{20}$").find_first(str) == Subrange(str.size() - 20, 20));
+    REQUIRE(Regex("[a-q][^u-z]{13}x").find_first(str + "x")
+            == Subrange(str.size() - 14, 15));
+}
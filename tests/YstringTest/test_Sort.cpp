@@ -0,0 +1,148 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/Sort.hpp"
+#include "Ystring/Algorithms.hpp"
+#include "Ystring/YstringException.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace ystring;
+
+TEST_CASE("Test case_insensitive_sort_key")
+{
+    REQUIRE(case_insensitive_sort_key("Ab") == std::string("AB\0\0Ab", 6));
+    REQUIRE(case_insensitive_sort_key(std::string_view("a\0b", 3))
+            == std::string("A\0\1B\0\0a\0b", 9));
+    REQUIRE(case_insensitive_sort_key(U8("blåbær")) == U8("BLÅBÆR") + std::string(2, '\0') + U8("blåbær"));
+    REQUIRE(case_insensitive_sort_key("") == std::string(2, '\0'));
+
+    std::string key = "x";
+    REQUIRE(case_insensitive_sort_key("abcdefghijk", key)
+            == std::string("xABCDEFGHIJK\0\0abcdefghijk", 25));
+    REQUIRE_THROWS_AS(case_insensitive_sort_key("ab\xFF"), YstringException);
+}
+
+TEST_CASE("Test that sort keys have the same order as the strings")
+{
+    std::vector<std::string> strs{"", "a", "A", "ab", "aB", "b", "B",
+                                  U8("æ"), U8("Æ"), U8("ø"),
+                                  std::string("a\0", 2),
+                                  std::string("a\0b", 3), "a\x01",
+                                  "abcdefghij", "ABCDEFGHIJ", "abcdefghi"};
+    for (auto& a : strs)
+    {
+        for (auto& b : strs)
+        {
+            auto cmp = case_insensitive::compare(a, b);
+            if (cmp == 0)
+                cmp = a.compare(b);
+            auto key_cmp = case_insensitive_sort_key(a)
+                .compare(case_insensitive_sort_key(b));
+            REQUIRE((cmp < 0) == (key_cmp < 0));
+            REQUIRE((cmp == 0) == (key_cmp == 0));
+        }
+    }
+}
+
+TEST_CASE("Test sort_case_insensitive")
+{
+    std::vector<std::string_view> strs{"banana", "Apple", "apple", U8("Ærlig"),
+                                       "cherry", "APPLE", "Banana", U8("ærlig"),
+                                       "Applesauce", ""};
+    sort_case_insensitive(strs);
+    REQUIRE(strs == std::vector<std::string_view>{"", "APPLE", "Apple",
+                                                  "apple", "Applesauce",
+                                                  "Banana", "banana", "cherry",
+                                                  U8("Ærlig"), U8("ærlig")});
+    std::vector<std::string_view> empty;
+    sort_case_insensitive(empty);
+    REQUIRE(empty.empty());
+}
+
+TEST_CASE("Test radix_sort")
+{
+    std::vector<std::string> strs;
+    for (int i = 0; i < 3000; ++i)
+    {
+        auto n = (i * 7919) % 1000;
+        std::string s = "item" + std::to_string(n);
+        if (i % 3 == 0)
+            s += U8("æøå");
+        if (i % 5 == 0)
+            s = "ITEM" + s.substr(4);
+        strs.push_back(s);
+    }
+    strs.emplace_back();
+    strs.emplace_back("a\0b", 3);
+    strs.emplace_back("a");
+
+    std::vector<std::string_view> expected(strs.begin(), strs.end());
+    std::sort(expected.begin(), expected.end());
+    for (unsigned threads : {1u, 4u})
+    {
+        std::vector<std::string_view> views(strs.begin(), strs.end());
+        radix_sort(views, {false, threads, 100});
+        REQUIRE(views == expected);
+    }
+}
+
+TEST_CASE("Test case-insensitive radix_sort")
+{
+    std::vector<std::string> strs;
+    for (int i = 0; i < 3000; ++i)
+    {
+        auto n = (i * 7919) % 1000;
+        std::string s = "item" + std::to_string(n);
+        if (i % 3 == 0)
+            s += U8("ÆØÅ");
+        else if (i % 3 == 1)
+            s += U8("æøå");
+        if (i % 5 == 0)
+            s = "ITEM" + s.substr(4);
+        strs.push_back(s);
+    }
+    // LATIN SMALL LETTER LONG S has upper case S, LATIN SMALL LETTER
+    // TURNED A has an upper case form with more bytes.
+    strs.emplace_back(U8("ſa"));
+    strs.emplace_back("Sa");
+    strs.emplace_back(U8("ɐ"));
+    strs.emplace_back(U8("Ɐ"));
+
+    std::vector<std::string_view> expected(strs.begin(), strs.end());
+    sort_case_insensitive(expected);
+    for (unsigned threads : {1u, 4u})
+    {
+        std::vector<std::string_view> views(strs.begin(), strs.end());
+        radix_sort(views, {true, threads, 100});
+        REQUIRE(views == expected);
+    }
+}
+
+TEST_CASE("Test parallel radix_sort with nothing left to sort")
+{
+    // Every string has a different first byte, so there are no buckets
+    // with more than one item after the first pass.
+    std::vector<std::string_view> strs{"b", "a"};
+    radix_sort(strs, {false, 4, 1});
+    REQUIRE(strs == std::vector<std::string_view>{"a", "b"});
+    strs = {"c", "", "b", "a"};
+    radix_sort(strs, {true, 4, 1});
+    REQUIRE(strs == std::vector<std::string_view>{"", "a", "b", "c"});
+    std::vector<std::string_view> empty;
+    radix_sort(empty, {false, 4, 0});
+    REQUIRE(empty.empty());
+}
+
+TEST_CASE("Test radix_sort with invalid UTF-8")
+{
+    std::vector<std::string_view> strs{"b", "a\xFF", "A"};
+    radix_sort(strs);
+    REQUIRE(strs == std::vector<std::string_view>{"A", "a\xFF", "b"});
+    REQUIRE_THROWS_AS(radix_sort(strs, {true}), YstringException);
+    REQUIRE(strs == std::vector<std::string_view>{"A", "a\xFF", "b"});
+}
@@ -0,0 +1,93 @@
+//****************************************************************************
+// Copyright © 2026 Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on 2026-10-18.
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#include "Ystring/StaticCodepointSet.hpp"
+#include <sstream>
+#include <catch2/catch_test_macros.hpp>
+#include "U8Adapter.hpp"
+
+using namespace ystring;
+using namespace ystring::literals;
+
+namespace
+{
+    constexpr auto& IDENTIFIER_CHARS = "[a-zA-Z_À-ɏ]"_cps;
+
+    static_assert(IDENTIFIER_CHARS.contains('q'));
+    static_assert(IDENTIFIER_CHARS.contains('_'));
+    static_assert(!IDENTIFIER_CHARS.contains('-'));
+    static_assert(IDENTIFIER_CHARS.contains(U'Ø'));
+    static_assert(!IDENTIFIER_CHARS.contains(U'Ω'));
+    static_assert(IDENTIFIER_CHARS.ranges.size() == 4);
+    static_assert("[^0-9]"_cps.contains('a'));
+    static_assert(!"[^0-9]"_cps.contains('5'));
+    static_assert("[a-fb-z]"_cps.ranges.size() == 1);
+    static_assert("[\\]\\-]"_cps.contains(']'));
+    static_assert("[-a]"_cps.contains('-'));
+}
+
+TEST_CASE("StaticCodepointSet with find_first_of and find_last_of")
+{
+    auto [sub, ch] = find_first_of(U8("12 øl3"), "[a-zø]"_cps);
+    REQUIRE(sub == Subrange(3, 2));
+    REQUIRE(ch == U'ø');
+    std::tie(sub, ch) = find_last_of(U8("12 øl3"), "[a-zø]"_cps);
+    REQUIRE(sub == Subrange(5, 1));
+    REQUIRE(ch == U'l');
+}
+
+TEST_CASE("StaticCodepointSet with count_of and find_all_of")
+{
+    REQUIRE(count_of(U8("12 øl3"), "[a-zø]"_cps) == 2);
+    REQUIRE(find_all_of(U8("12 øl3"), "[0-9]"_cps)
+            == std::vector<Subrange>{{0, 1}, {1, 1}, {6, 1}});
+}
+
+TEST_CASE("StaticCodepointSet with split and trim_where")
+{
+    REQUIRE(split("ab,cd;ef", "[,;]"_cps)
+            == std::vector<std::string_view>{"ab", "cd", "ef"});
+    REQUIRE(trim_where("  \tab c\t", "[ \\t]"_cps) == "ab c");
+}
+
+TEST_CASE("StaticCodepointSet::case_insensitive_contains")
+{
+    REQUIRE("[aØ]"_cps.case_insensitive_contains('A'));
+    REQUIRE("[aØ]"_cps.case_insensitive_contains(U'ø'));
+    REQUIRE(!"[aØ]"_cps.case_insensitive_contains('b'));
+    REQUIRE(!"[^aØ]"_cps.case_insensitive_contains('a'));
+    REQUIRE(!"[^aØ]"_cps.case_insensitive_contains('A'));
+    REQUIRE(!"[^aØ]"_cps.case_insensitive_contains(U'ø'));
+    REQUIRE("[^aØ]"_cps.case_insensitive_contains('B'));
+}
+
+TEST_CASE("StaticCodepointSet::to_codepoint_set")
+{
+    auto set = "[^a-cx]"_cps.to_codepoint_set();
+    REQUIRE(set.negated);
+    REQUIRE(set.ranges == std::vector<CodepointRange>{{'a', 'c'}, {'x', 'x'}});
+}
+
+TEST_CASE("parse_codepoint_set")
+{
+    auto set = parse_codepoint_set(U8("[z\\^a-cÅ]"));
+    REQUIRE(set.ranges == std::vector<CodepointRange>{
+        {'^', '^'}, {'a', 'c'}, {'z', 'z'}, {U'Å', U'Å'}});
+    REQUIRE_THROWS(parse_codepoint_set("[a-"));
+    REQUIRE_THROWS(parse_codepoint_set("[z-a]"));
+    REQUIRE_THROWS(parse_codepoint_set("a-z"));
+}
+
+TEST_CASE("CodepointSet written with operator<< can be parsed")
+{
+    CodepointSet set{{{'-', '-'}, {'a', 'c'}, {']', ']'}}};
+    set.canonicalize();
+    std::ostringstream ss;
+    ss << set;
+    REQUIRE(ss.str() == "[\\-\\]a-c]");
+    REQUIRE(parse_codepoint_set(ss.str()).ranges == set.ranges);
+}
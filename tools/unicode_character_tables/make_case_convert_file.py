@@ -19,31 +19,136 @@ AlternativeIndexes = {
 }
 
 
-def get_most_prevalent_diff(values):
-    diffs = {}
-    for v, w in values:
-        if not diffs.get(w - v):
-            diffs[w - v] = 1
-        else:
-            diffs[w - v] += 1
-    best_diff, max_count = 0, 0
-    for diff in diffs:
-        if diffs[diff] > max_count:
-            best_diff, max_count = diff, diffs[diff]
-    return best_diff, max_count
-
-
-def make_diff_set(major, diff, values):
-    bit_set = 0
-    nbit_set = 0xFFFFFFFF
-    remainder = []
-    for v, w in values:
-        if w - v == diff:
-            bit_set |= 1 << (v - major)
-        else:
-            remainder.append((v, w))
-        nbit_set ^= 1 << (v - major)
-    return (major, diff, bit_set, nbit_set), remainder
+# The number of bits in the lower part of a code point, i.e. the part
+# that is an index into a block. Must match CASE_BLOCK_SHIFT in
+# CharMappingTypes.hpp.
+BLOCK_SHIFT = 6
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+
+# The value in the UTF-8 delta tables for code points whose conversion
+# must be decoded. Must match UTF8_CASE_FALLBACK in CharMappingTypes.hpp.
+UTF8_FALLBACK = "UTF8_CASE_FALLBACK"
+
+# The value in the UTF-8 delta tables for the first entry in
+# SPECIAL_CASING. Must match UTF8_CASE_SPECIAL in CharMappingTypes.hpp.
+UTF8_SPECIAL = "UTF8_CASE_SPECIAL"
+
+
+def read_special_casing(file_name):
+    """Returns the unconditional mappings in SpecialCasing.txt where at
+    least one of the mappings is several code points.
+
+    The result is a list of (code point, lower, title, upper) tuples
+    sorted by code point, where each mapping is a list of code points.
+    """
+    result = []
+    for line in open(file_name):
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        parts = [p.strip() for p in line.split(";")]
+        # Conditional mappings have a fifth field with the conditions.
+        if len(parts) > 5 or parts[4]:
+            continue
+        ch = int(parts[0], 16)
+        mappings = [[int(s, 16) for s in part.split()] for part in parts[1:4]]
+        if any(len(m) > 1 for m in mappings):
+            result.append((ch, *mappings))
+    result.sort()
+    return result
+
+
+def get_special_codepoints(special_casing, name):
+    """Returns the code points in special_casing that are converted to
+    several code points by the conversion called name, mapped to their
+    index in special_casing.
+
+    Title case uses the upper case table's indexes, which requires that
+    every code point with a special title case also has a special upper
+    case.
+    """
+    index = {"Lower": 1, "Title": 3, "Upper": 3}[name]
+    result = {}
+    for i, entry in enumerate(special_casing):
+        if len(entry[index]) > 1:
+            result[entry[0]] = i
+    if name == "Title":
+        for entry in special_casing:
+            if len(entry[2]) > 1 and entry[0] not in result:
+                raise Exception("U+%04X has a special title case, but not"
+                                " a special upper case." % entry[0])
+    return result
+
+
+def make_tables(get_delta, end):
+    """Splits the deltas for the code points below end into three tables:
+
+    - the distinct deltas.
+    - blocks of BLOCK_SIZE indices into the deltas, one for each distinct
+      block of code points.
+    - the index of the block for each range of BLOCK_SIZE code points.
+      Trailing blocks where all the deltas are 0 are omitted.
+    """
+    deltas = [0]
+    delta_indexes = {0: 0}
+    blocks = []
+    block_indexes = {}
+    block_table = []
+    for block_start in range(0, end, BLOCK_SIZE):
+        block = []
+        for ch in range(block_start, block_start + BLOCK_SIZE):
+            delta = get_delta(ch)
+            if delta not in delta_indexes:
+                delta_indexes[delta] = len(deltas)
+                deltas.append(delta)
+            block.append(delta_indexes[delta])
+        block = tuple(block)
+        if block not in block_indexes:
+            block_indexes[block] = len(blocks)
+            blocks.append(block)
+        block_table.append(block_indexes[block])
+    zero_block = block_indexes.get((0,) * BLOCK_SIZE)
+    while block_table and block_table[-1] == zero_block:
+        block_table.pop()
+    if len(deltas) > 256 or len(blocks) > 256:
+        raise Exception("Too many distinct deltas or blocks for uint8_t.")
+    return block_table, blocks, deltas
+
+
+def get_packed_utf8(ch):
+    """Returns the UTF-8 encoding of ch as a big-endian integer."""
+    return int.from_bytes(chr(ch).encode("utf-8"), "big")
+
+
+def make_utf8_delta_function(chars, special_codepoints):
+    """Returns a function that returns the value that must be added to
+    the UTF-8 encoding of a code point, read as a big-endian integer,
+    to get the encoding of the converted code point.
+
+    The function returns UTF8_SPECIAL plus the index from
+    special_codepoints for the code points in it, and UTF8_FALLBACK if
+    the two encodings have different lengths.
+    """
+    def get_delta(ch):
+        if ch < 0x80 or 0xD800 <= ch < 0xE000:
+            return 0
+        if ch in special_codepoints:
+            return "%s + %d" % (UTF8_SPECIAL, special_codepoints[ch])
+        alt_ch = chars.get(ch, ch)
+        if len(chr(ch).encode("utf-8")) != len(chr(alt_ch).encode("utf-8")):
+            return UTF8_FALLBACK
+        return get_packed_utf8(alt_ch) - get_packed_utf8(ch)
+
+    return get_delta
+
+
+def format_values(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(" ".join((fmt % v if type(v) == int else v) + ","
+                              for v in values[i:i + per_line]))
+    return lines
 
 
 template = """\
@@ -56,48 +161,102 @@ template = """\
 //****************************************************************************
 #pragma once
 
+#include <iterator>
 #include "CharMappingTypes.hpp"
 
 namespace ystring
 {
-    constexpr CompactCharMapping COMPACT_[[[name]]]_CASE[] =
+    constexpr uint8_t [[[name]]]_CASE_BLOCKS[] =
     {
-        [[[compact_mappings]]]
+        [[[block_table]]]
     };
 
-    constexpr CharMapping [[[name]]]_CASE[] =
+    constexpr uint8_t [[[name]]]_CASE_DELTA_INDEXES[] =
     {
-        [[[mappings]]]
+        [[[blocks]]]
     };
+
+    constexpr int32_t [[[name]]]_CASE_DELTAS[] =
+    {
+        [[[deltas]]]
+    };
+
+    constexpr CaseMappingTable [[[name]]]_CASE_TABLE =
+    {
+        [[[name]]]_CASE_BLOCKS,
+        std::size([[[name]]]_CASE_BLOCKS),
+        [[[name]]]_CASE_DELTA_INDEXES,
+        [[[name]]]_CASE_DELTAS
+    };
+[[[IF utf8_block_table]]]
+
+    /**
+     * @brief The values that are added to the UTF-8 encodings of the
+     *  code points below U+10000, read as big-endian integers.
+     *
+     * Code points that are converted to several code points have
+     * UTF8_CASE_SPECIAL plus their index in SPECIAL_CASING.
+     */
+    constexpr uint8_t [[[name]]]_CASE_UTF8_BLOCKS[] =
+    {
+        [[[utf8_block_table]]]
+    };
+
+    constexpr uint8_t [[[name]]]_CASE_UTF8_DELTA_INDEXES[] =
+    {
+        [[[utf8_blocks]]]
+    };
+
+    constexpr int32_t [[[name]]]_CASE_UTF8_DELTAS[] =
+    {
+        [[[utf8_deltas]]]
+    };
+
+    constexpr CaseMappingTable [[[name]]]_CASE_UTF8_TABLE =
+    {
+        [[[name]]]_CASE_UTF8_BLOCKS,
+        std::size([[[name]]]_CASE_UTF8_BLOCKS),
+        [[[name]]]_CASE_UTF8_DELTA_INDEXES,
+        [[[name]]]_CASE_UTF8_DELTAS
+    };
+[[[ENDIF]]]
 }
 """
 
 
-def write_cpp(diff_sets, mappings, name):
-    compact_mappings = []
-    for diff_set in diff_sets:
-        if diff_set[1] < 0:
-            s = "{0x%06X, 0x%08X, 0x%08X, 0x%08X}," % (
-                diff_set[0], 2**32 + diff_set[1], diff_set[2], diff_set[3])
-        else:
-            s = "{0x%06X, 0x%08X, 0x%08X, 0x%08X}," % diff_set
-        compact_mappings.append(s)
-    expanded_mappings = []
-    for ch, alt_ch in mappings:
-        expanded_mappings.append("{0x%06X, 0x%06X}," % (ch, alt_ch))
+def format_blocks(blocks):
+    lines = []
+    for i, block in enumerate(blocks):
+        lines.append("// Block %d" % i)
+        lines.extend(format_values(block, "%d", 16))
+    return lines
+
+
+def write_cpp(tables, utf8_tables, name):
+    block_table, blocks, deltas = tables
     date = datetime.date.today()
     codegen_params = dict(
         year=date.year,
         date="%d-%02d-%02d" % (date.year, date.month, date.day),
         name=name.upper(),
-        compact_mappings=compact_mappings,
-        mappings=expanded_mappings)
+        block_table=format_values(block_table, "%d", 16),
+        blocks=format_blocks(blocks),
+        deltas=format_values(deltas, "%d", 8),
+        utf8_block_table=None,
+        utf8_blocks=None,
+        utf8_deltas=None)
+    if utf8_tables:
+        block_table, blocks, deltas = utf8_tables
+        codegen_params.update(
+            utf8_block_table=format_values(block_table, "%d", 16),
+            utf8_blocks=format_blocks(blocks),
+            utf8_deltas=format_values(deltas, "%d", 8))
     print(codegen.make_text(template, codegen.DictExpander(codegen_params)))
 
 
 def main(args):
-    if len(args) != 2:
-        print("usage: %s <name> <unicode data file>"
+    if len(args) != 3:
+        print("usage: %s <name> <unicode data file> <special casing file>"
               % os.path.basename(sys.argv[0]))
         print("<name> must be 'upper', 'lower' or 'title'")
         return 1
@@ -109,24 +268,18 @@ def main(args):
         parts[alternative_index] = parts[alternative_index].strip()
         if parts[alternative_index]:
             ch = int(parts[0], 16)
-            alt_ch = int(parts[alternative_index], 16)
-            major = (ch // 32) * 32
-            char_list = chars.get(major)
-            if not char_list:
-                chars[major] = [(ch, alt_ch)]
-            else:
-                char_list.append((ch, alt_ch))
-    diff_sets = []
-    mappings = []
-    for major in sorted(chars):
-        diff, count = get_most_prevalent_diff(chars[major])
-        if count > 2:
-            diff_set, remainder = make_diff_set(major, diff, chars[major])
-            diff_sets.append(diff_set)
-            mappings.extend(remainder)
-        else:
-            mappings.extend(chars[major])
-    write_cpp(diff_sets, mappings, name)
+            chars[ch] = int(parts[alternative_index], 16)
+    special_codepoints = get_special_codepoints(
+        read_special_casing(args[2]), name)
+    tables = make_tables(lambda ch: chars.get(ch, ch) - ch, max(chars) + 1)
+    # Title case is only converted after the code points are decoded,
+    # as it depends on whether they are letters.
+    utf8_tables = None
+    if name != "Title":
+        utf8_tables = make_tables(
+            make_utf8_delta_function(chars, special_codepoints),
+            0x10000)
+    write_cpp(tables, utf8_tables, name)
     return 0
 
 
@@ -0,0 +1,156 @@
+# -*- coding: utf-8 -*-
+# ****************************************************************************
+# Copyright © 2026 Jan Erik Breimo. All rights reserved.
+# Created by Jan Erik Breimo on 2026-10-18.
+#
+# This file is distributed under the Zero-Clause BSD License.
+# License text is included with the source distribution.
+# ****************************************************************************
+import datetime
+import os
+import sys
+import codegen
+from make_case_convert_file import format_blocks, format_values, \
+    make_tables, make_utf8_delta_function
+
+
+template = """\
+//****************************************************************************
+// Copyright © [[[year]]] Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on [[[date]]].
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include <iterator>
+#include "CharMappingTypes.hpp"
+
+namespace ystring
+{
+    /**
+     * @brief The simple case folding (status C and S in CaseFolding.txt).
+     */
+    constexpr uint8_t FOLD_CASE_BLOCKS[] =
+    {
+        [[[block_table]]]
+    };
+
+    constexpr uint8_t FOLD_CASE_DELTA_INDEXES[] =
+    {
+        [[[blocks]]]
+    };
+
+    constexpr int32_t FOLD_CASE_DELTAS[] =
+    {
+        [[[deltas]]]
+    };
+
+    constexpr CaseMappingTable FOLD_CASE_TABLE =
+    {
+        FOLD_CASE_BLOCKS,
+        std::size(FOLD_CASE_BLOCKS),
+        FOLD_CASE_DELTA_INDEXES,
+        FOLD_CASE_DELTAS
+    };
+
+    /**
+     * @brief The values that are added to the UTF-8 encodings of the
+     *  code points below U+10000, read as big-endian integers.
+     *
+     * Code points with a full case folding have UTF8_CASE_SPECIAL plus
+     * their index in FULL_FOLD_CASE.
+     */
+    constexpr uint8_t FOLD_CASE_UTF8_BLOCKS[] =
+    {
+        [[[utf8_block_table]]]
+    };
+
+    constexpr uint8_t FOLD_CASE_UTF8_DELTA_INDEXES[] =
+    {
+        [[[utf8_blocks]]]
+    };
+
+    constexpr int32_t FOLD_CASE_UTF8_DELTAS[] =
+    {
+        [[[utf8_deltas]]]
+    };
+
+    constexpr CaseMappingTable FOLD_CASE_UTF8_TABLE =
+    {
+        FOLD_CASE_UTF8_BLOCKS,
+        std::size(FOLD_CASE_UTF8_BLOCKS),
+        FOLD_CASE_UTF8_DELTA_INDEXES,
+        FOLD_CASE_UTF8_DELTAS
+    };
+
+    /**
+     * @brief The code points whose full case folding (status F in
+     *  CaseFolding.txt) is several code points, sorted.
+     */
+    constexpr FullCaseMapping FULL_FOLD_CASE[] =
+    {
+        [[[full_mappings]]]
+    };
+
+    constexpr size_t MAX_FULL_FOLD_CASE_SIZE = [[[max_full_size]]];
+}
+"""
+
+
+def encode_as_literal(codepoints):
+    data = "".join(chr(ch) for ch in codepoints).encode("utf-8")
+    return '"%s"' % "".join("\\x%02X" % b for b in data), len(data)
+
+
+def write_cpp(tables, utf8_tables, full_mappings):
+    date = datetime.date.today()
+    full_lines = []
+    max_full_size = 0
+    for ch in sorted(full_mappings):
+        literal, size = encode_as_literal(full_mappings[ch])
+        full_lines.append("{0x%06X, %s}," % (ch, literal))
+        max_full_size = max(max_full_size, size)
+    codegen_params = dict(
+        year=date.year,
+        date="%d-%02d-%02d" % (date.year, date.month, date.day),
+        block_table=format_values(tables[0], "%d", 16),
+        blocks=format_blocks(tables[1]),
+        deltas=format_values(tables[2], "%d", 8),
+        utf8_block_table=format_values(utf8_tables[0], "%d", 16),
+        utf8_blocks=format_blocks(utf8_tables[1]),
+        utf8_deltas=format_values(utf8_tables[2], "%d", 8),
+        full_mappings=full_lines,
+        max_full_size=max_full_size)
+    print(codegen.make_text(template, codegen.DictExpander(codegen_params)))
+
+
+def main(args):
+    if len(args) != 1:
+        print("usage: %s <CaseFolding.txt>" % os.path.basename(sys.argv[0]))
+        return 1
+    simple = {}
+    full = {}
+    for line in open(args[0]):
+        line = line.split("#", 1)[0].strip()
+        if not line:
+            continue
+        parts = [p.strip() for p in line.split(";")]
+        ch = int(parts[0], 16)
+        mapping = [int(s, 16) for s in parts[2].split()]
+        if parts[1] in ("C", "S"):
+            simple[ch] = mapping[0]
+        elif parts[1] == "F":
+            full[ch] = mapping
+    tables = make_tables(lambda ch: simple.get(ch, ch) - ch,
+                         max(simple) + 1)
+    full_indexes = {ch: i for i, ch in enumerate(sorted(full))}
+    utf8_tables = make_tables(make_utf8_delta_function(simple, full_indexes),
+                              0x10000)
+    write_cpp(tables, utf8_tables, full)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
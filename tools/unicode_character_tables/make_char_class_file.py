@@ -127,10 +127,6 @@ ClassNames = {
     "XLu":  "Alternating upper and lower case, ends on upper"
 }
 
-KnownRanges = {0x4DB5, 0x9FCC, 0xD7A3, 0xDB7F, 0xDBFF, 0xDFFF, 0xF8FF,
-               0x2A6D6, 0x2B734, 0x2B81D, 0xFFFFD, 0x10FFFD}
-
-
 Template = """\
 //****************************************************************************
 // Copyright © [[[year]]] Jan Erik Breimo. All rights reserved.
@@ -175,7 +171,8 @@ def get_class_ranges(file_name):
         parts = line.split(";")
         char_class = parts[2]
         char_id = int(parts[0], 16)
-        if (char_id == range_end + 1 or char_id in KnownRanges) and char_class == range_class:
+        is_range_end = parts[1].endswith(", Last>")
+        if (char_id == range_end + 1 or is_range_end) and char_class == range_class:
             range_end = char_id
         else:
             if range_class:
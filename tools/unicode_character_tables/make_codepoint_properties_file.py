@@ -0,0 +1,226 @@
+# -*- coding: utf-8 -*-
+# ****************************************************************************
+# Copyright © 2026 Jan Erik Breimo. All rights reserved.
+# Created by Jan Erik Breimo on 2026-10-18.
+#
+# This file is distributed under the Zero-Clause BSD License.
+# License text is included with the source distribution.
+# ****************************************************************************
+import datetime
+import os
+import sys
+import codegen
+from make_case_convert_file import format_values, read_special_casing
+from make_char_class_file import Classes
+from make_normalization_file import get_rules
+
+
+# Must match PROPERTY_BLOCK_SHIFT and PROPERTY_GROUP_SHIFT in
+# CodepointProperties.hpp.
+BLOCK_SHIFT = 4
+GROUP_SHIFT = 5
+
+UNICODE_END = 0x110000
+
+
+template = """\
+//****************************************************************************
+// Copyright © [[[year]]] Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on [[[date]]].
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include "CodepointProperties.hpp"
+
+namespace ystring
+{
+    /**
+     * @brief The index of each code point's group of blocks.
+     *
+     * The sizes of the tables, in bytes:
+     *  - groups: [[[groups_size]]]
+     *  - blocks: [[[blocks_size]]]
+     *  - record indexes: [[[indexes_size]]]
+     *  - records: [[[records_size]]]
+     */
+    constexpr uint8_t CODEPOINT_PROPERTY_GROUPS[] =
+    {
+        [[[groups]]]
+    };
+
+    constexpr uint16_t CODEPOINT_PROPERTY_BLOCKS[] =
+    {
+        [[[blocks]]]
+    };
+
+    constexpr uint16_t CODEPOINT_PROPERTY_INDEXES[] =
+    {
+        [[[indexes]]]
+    };
+
+    /**
+     * @brief The distinct records. The first one belongs to the
+     *  unassigned code points.
+     */
+    constexpr CodepointProperties CODEPOINT_PROPERTY_RECORDS[] =
+    {
+        [[[records]]]
+    };
+
+    constexpr int32_t CODEPOINT_PROPERTY_CASE_DELTAS[] =
+    {
+        [[[case_deltas]]]
+    };
+
+    constexpr CodepointPropertyTable CODEPOINT_PROPERTY_TABLE =
+    {
+        CODEPOINT_PROPERTY_GROUPS,
+        CODEPOINT_PROPERTY_BLOCKS,
+        CODEPOINT_PROPERTY_INDEXES,
+        CODEPOINT_PROPERTY_RECORDS,
+        CODEPOINT_PROPERTY_CASE_DELTAS
+    };
+}
+"""
+
+
+def read_unicode_data(file_name):
+    """Returns a dict from code point to the fields in the code point's
+    line in UnicodeData.txt.
+
+    The code points in the ranges that are given as a pair of
+    "<..., First>" and "<..., Last>" lines all get the fields from the
+    first line.
+    """
+    result = {}
+    range_start = None
+    for line in open(file_name):
+        parts = line.rstrip("\n").split(";")
+        ch = int(parts[0], 16)
+        if parts[1].endswith(", First>"):
+            range_start = ch
+        elif parts[1].endswith(", Last>"):
+            for i in range(range_start, ch + 1):
+                result[i] = parts
+        else:
+            result[ch] = parts
+    return result
+
+
+def make_records(unicode_data, special_casing, decompositions):
+    """Returns the distinct records, the index of each code point's
+    record, and the distinct case deltas.
+
+    A record is a tuple of the fields in the C++ CodepointProperties
+    struct, and the unassigned code points' record is the first one.
+    """
+    case_deltas = [0]
+    case_delta_indexes = {0: 0}
+
+    def get_case_index(ch, field):
+        delta = int(field, 16) - ch if field.strip() else 0
+        if delta not in case_delta_indexes:
+            case_delta_indexes[delta] = len(case_deltas)
+            case_deltas.append(delta)
+        return case_delta_indexes[delta]
+
+    special_indexes = {entry[0]: i + 1
+                       for i, entry in enumerate(special_casing)}
+    decomposition_indexes = {rule[0]: i + 1
+                             for i, rule in enumerate(decompositions)}
+    unassigned = (Classes["Cn"] - 1, 0, 0, 0, 0, 0, 0)
+    records = [unassigned]
+    record_indexes = {unassigned: 0}
+    codepoint_records = []
+    for ch in range(UNICODE_END):
+        parts = unicode_data.get(ch)
+        if parts:
+            record = (Classes[parts[2]] - 1,
+                      int(parts[3]),
+                      get_case_index(ch, parts[13]),
+                      get_case_index(ch, parts[14]),
+                      get_case_index(ch, parts[12]),
+                      special_indexes.get(ch, 0),
+                      decomposition_indexes.get(ch, 0))
+        else:
+            record = unassigned
+        if record not in record_indexes:
+            record_indexes[record] = len(records)
+            records.append(record)
+        codepoint_records.append(record_indexes[record])
+    if len(case_deltas) > 256 or len(special_casing) >= 256:
+        raise Exception("Too many case deltas or special casings for uint8_t.")
+    if len(records) > 0x10000 or len(decompositions) >= 0x10000:
+        raise Exception("Too many records or decompositions for uint16_t.")
+    return records, codepoint_records, case_deltas
+
+
+def split_into_blocks(values, block_size):
+    """Returns the distinct blocks of block_size values in values, and
+    the index of the block for each block_size values."""
+    blocks = []
+    block_indexes = {}
+    index_table = []
+    for i in range(0, len(values), block_size):
+        block = tuple(values[i:i + block_size])
+        if block not in block_indexes:
+            block_indexes[block] = len(blocks)
+            blocks.append(block)
+        index_table.append(block_indexes[block])
+    return blocks, index_table
+
+
+def make_tables(codepoint_records):
+    record_blocks, block_table = split_into_blocks(codepoint_records,
+                                                   1 << BLOCK_SHIFT)
+    groups, group_table = split_into_blocks(block_table, 1 << GROUP_SHIFT)
+    if len(groups) > 256 or len(record_blocks) > 0x10000:
+        raise Exception("Too many distinct groups or blocks.")
+    return group_table, groups, record_blocks
+
+
+def format_blocks(blocks, per_line):
+    lines = []
+    for i, block in enumerate(blocks):
+        lines.append("// Block %d" % i)
+        lines.extend(format_values(block, "%d", per_line))
+    return lines
+
+
+def write_cpp(records, tables, case_deltas):
+    group_table, groups, record_blocks = tables
+    date = datetime.date.today()
+    codegen_params = dict(
+        year=date.year,
+        date="%d-%02d-%02d" % (date.year, date.month, date.day),
+        groups_size=len(group_table),
+        blocks_size=2 * len(groups) * (1 << GROUP_SHIFT),
+        indexes_size=2 * len(record_blocks) * (1 << BLOCK_SHIFT),
+        records_size=8 * len(records),
+        groups=format_values(group_table, "%d", 16),
+        blocks=format_blocks(groups, 12),
+        indexes=format_blocks(record_blocks, 12),
+        records=format_values(["{%s}" % ", ".join(str(v) for v in record)
+                               for record in records], "%s", 2),
+        case_deltas=format_values(case_deltas, "%d", 8))
+    print(codegen.make_text(template, codegen.DictExpander(codegen_params)))
+
+
+def main(args):
+    if len(args) != 2:
+        print("usage: %s <unicode data file> <special casing file>"
+              % os.path.basename(sys.argv[0]))
+        return 1
+    records, codepoint_records, case_deltas = make_records(
+        read_unicode_data(args[0]),
+        read_special_casing(args[1]),
+        get_rules(args[0]))
+    write_cpp(records, make_tables(codepoint_records), case_deltas)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
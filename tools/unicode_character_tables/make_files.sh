@@ -1,19 +1,39 @@
 #!/bin/bash
 
+# Generates the table headers in the current directory. The headers in
+# src/Ystring are generated from the files in data/unicode:
+#
+#   cd src/Ystring
+#   ../../tools/unicode_character_tables/make_files.sh \
+#       ../../data/unicode/UnicodeData16.0.0.txt \
+#       ../../data/unicode/ReconstructedCaseFolding16.0.0.txt \
+#       ../../data/unicode/SpecialCasing14.0.0.txt
+#
+# ReconstructedCaseFolding16.0.0.txt stands in for the UCD's
+# CaseFolding-16.0.0.txt, see the comments at its beginning. The
+# unconditional mappings in SpecialCasing.txt, which are the ones the
+# tables use, are the same in Unicode 14.0 and 16.0.
+
 SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" >/dev/null 2>&1 && pwd)"
 
-if [ ! -e "$1" ]; then
-  echo "Usage: $0 <unicode database>"
+if [ ! -e "$1" ] || [ ! -e "$2" ] || [ ! -e "$3" ]; then
+  echo "Usage: $0 <unicode database> <case folding file> <special casing file>"
   exit 1
 fi
 
 echo Making UpperCaseTables.hpp
-python3 "$SCRIPT_DIR/make_case_convert_file.py" upper $1 >UpperCaseTables.hpp
+python3 "$SCRIPT_DIR/make_case_convert_file.py" upper $1 $3 >UpperCaseTables.hpp
 echo Making LowerCaseTables.hpp
-python3 "$SCRIPT_DIR/make_case_convert_file.py" lower $1 >LowerCaseTables.hpp
+python3 "$SCRIPT_DIR/make_case_convert_file.py" lower $1 $3 >LowerCaseTables.hpp
 echo Making TitleCaseTables.hpp
-python3 "$SCRIPT_DIR/make_case_convert_file.py" title $1 >TitleCaseTables.hpp
+python3 "$SCRIPT_DIR/make_case_convert_file.py" title $1 $3 >TitleCaseTables.hpp
+echo Making SpecialCasingTables.hpp
+python3 "$SCRIPT_DIR/make_special_casing_file.py" $3 >SpecialCasingTables.hpp
+echo Making CaseFoldingTables.hpp
+python3 "$SCRIPT_DIR/make_case_folding_file.py" $2 >CaseFoldingTables.hpp
 echo Making CharClassTables.cpp
 python3 "$SCRIPT_DIR/make_char_class_file.py" $1 >CharClassTables.hpp
+echo Making CodepointPropertiesTables.hpp
+python3 "$SCRIPT_DIR/make_codepoint_properties_file.py" $1 $3 >CodepointPropertiesTables.hpp
 echo Making NormalizationTables.cpp
 python3 "$SCRIPT_DIR/make_normalization_file.py" $1 >NormalizationTables.hpp
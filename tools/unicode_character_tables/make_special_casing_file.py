@@ -0,0 +1,80 @@
+# -*- coding: utf-8 -*-
+# ****************************************************************************
+# Copyright © 2026 Jan Erik Breimo. All rights reserved.
+# Created by Jan Erik Breimo on 2026-10-18.
+#
+# This file is distributed under the Zero-Clause BSD License.
+# License text is included with the source distribution.
+# ****************************************************************************
+import datetime
+import os
+import sys
+import codegen
+from make_case_convert_file import read_special_casing
+from make_case_folding_file import encode_as_literal
+
+
+template = """\
+//****************************************************************************
+// Copyright © [[[year]]] Jan Erik Breimo. All rights reserved.
+// Created by Jan Erik Breimo on [[[date]]].
+//
+// This file is distributed under the Zero-Clause BSD License.
+// License text is included with the source distribution.
+//****************************************************************************
+#pragma once
+
+#include "CharMappingTypes.hpp"
+
+namespace ystring
+{
+    /**
+     * @brief The unconditional mappings in SpecialCasing.txt where at
+     *  least one of the lower, title and upper case forms is several
+     *  code points, sorted.
+     *
+     * The UTF-8 tables for lower and upper case have UTF8_CASE_SPECIAL
+     * plus the index in this array for the code points whose lower or
+     * upper case form is several code points. Every code point with a
+     * title case form of several code points also has such an upper
+     * case form.
+     */
+    constexpr SpecialCaseMapping SPECIAL_CASING[] =
+    {
+        [[[mappings]]]
+    };
+
+    constexpr size_t MAX_SPECIAL_CASING_SIZE = [[[max_size]]];
+}
+"""
+
+
+def write_cpp(special_casing):
+    date = datetime.date.today()
+    lines = []
+    max_size = 0
+    for ch, lower, title, upper in special_casing:
+        literals = []
+        for mapping in (lower, title, upper):
+            literal, size = encode_as_literal(mapping)
+            literals.append(literal)
+            max_size = max(max_size, size)
+        lines.append("{0x%06X, %s}," % (ch, ", ".join(literals)))
+    codegen_params = dict(
+        year=date.year,
+        date="%d-%02d-%02d" % (date.year, date.month, date.day),
+        mappings=lines,
+        max_size=max_size)
+    print(codegen.make_text(template, codegen.DictExpander(codegen_params)))
+
+
+def main(args):
+    if len(args) != 1:
+        print("usage: %s <SpecialCasing.txt>" % os.path.basename(sys.argv[0]))
+        return 1
+    write_cpp(read_special_casing(args[0]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))